@@ -0,0 +1,1185 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_CHARREF_H_
+#define STPL_HTML_CHARREF_H_
+
+#include <string>
+#include <cctype>
+
+#include "../../utils/simd.h"
+#include "../../utils/xml.h"
+
+/**
+ * Decoding of the HTML character references, the named ones (all of the HTML5
+ * list, including the legacy names that may go without the ';') and the
+ * numeric ones
+ *
+ * The names are kept in a radix trie laid out breadth first in static tables,
+ * the children of a node are contiguous and sorted by the first character of
+ * their label. The tables below are generated from the HTML5 entity list.
+ */
+namespace stpl {
+	namespace HTML {
+
+		struct CharRefNode {
+			unsigned short	label;			/// offset of the edge label in the label table
+			unsigned char	label_length;
+			unsigned char	children;
+			unsigned short	first_child;
+			unsigned short	value;			/// offset of the UTF-8 replacement in the value table
+			unsigned char	value_length;	/// 0 if the name ending here is not a reference
+			unsigned char	legacy;			/// the reference is also recognised without the ';'
+		};
+
+		class CharRef {
+			public:
+				enum {
+					MAX_UTF8_LENGTH = 8
+				};
+
+			public:
+				/**
+				 * @brief whether [begin, end) holds anything that may be a reference
+				 */
+				static bool has_refs(const char* begin, const char* end) {
+					return utils::find_char(begin, end, '&') != end;
+				}
+
+				/**
+				 * @brief decode the reference starting with the '&' at p
+				 *
+				 * in an attribute value a legacy name followed by '=' or an
+				 * alphanumeric character is left alone, as browsers do
+				 *
+				 * @param out receives the UTF-8 replacement, at least MAX_UTF8_LENGTH bytes
+				 * @return the length of the reference, 0 if there is none at p
+				 */
+				static size_t match(const char* p, const char* end, bool in_attribute, char* out, size_t& out_len) {
+					out_len = 0;
+					if (p + 1 >= end || *p != '&')
+						return 0;
+					if (p[1] == '#')
+						return match_numeric(p, end, out, out_len);
+					return match_named(p, end, in_attribute, out, out_len);
+				}
+
+				/**
+				 * @brief append [begin, end) to out with the references decoded
+				 */
+				static void decode(const char* begin, const char* end, std::string& out, bool in_attribute = false) {
+					char buf[MAX_UTF8_LENGTH];
+					size_t buf_len;
+					const char* p = begin;
+					while (p < end) {
+						const char* amp = utils::find_char(p, end, '&');
+						out.append(p, amp - p);
+						if (amp == end)
+							break;
+						size_t len = match(amp, end, in_attribute, buf, buf_len);
+						if (len > 0) {
+							out.append(buf, buf_len);
+							p = amp + len;
+						}
+						else {
+							out.push_back('&');
+							p = amp + 1;
+						}
+					}
+				}
+
+				static std::string decode(const std::string& text, bool in_attribute = false) {
+					std::string out;
+					out.reserve(text.length());
+					decode(text.data(), text.data() + text.length(), out, in_attribute);
+					return out;
+				}
+
+			private:
+				static size_t match_named(const char* p, const char* end, bool in_attribute, char* out, size_t& out_len) {
+					const CharRefNode* trie = nodes();
+					const char* label_table = labels();
+					const char* q = p + 1;
+					const CharRefNode* best = NULL;
+					size_t best_len = 0;
+
+					const CharRefNode* node = trie;
+					while (node->children > 0 && q < end) {
+						// the first characters of the child labels are unique and sorted
+						const CharRefNode* lo = trie + node->first_child;
+						const CharRefNode* hi = lo + node->children;
+						while (lo < hi) {
+							const CharRefNode* mid = lo + (hi - lo) / 2;
+							if ((unsigned char) label_table[mid->label] < (unsigned char) *q)
+								lo = mid + 1;
+							else
+								hi = mid;
+						}
+						if (lo == trie + node->first_child + node->children || label_table[lo->label] != *q)
+							break;
+						if ((size_t) (end - q) < lo->label_length
+								|| memcmp(q, label_table + lo->label, lo->label_length) != 0)
+							break;
+
+						node = lo;
+						q += node->label_length;
+						if (node->value_length > 0) {
+							if (q < end && *q == ';') {
+								best = node;
+								best_len = q + 1 - p;
+							}
+							else if (node->legacy) {
+								if (!(in_attribute && q < end && (isalnum((unsigned char) *q) || *q == '='))) {
+									best = node;
+									best_len = q - p;
+								}
+								else {
+									best = NULL;
+									best_len = 0;
+								}
+							}
+						}
+					}
+
+					if (best) {
+						memcpy(out, values() + best->value, best->value_length);
+						out_len = best->value_length;
+					}
+					return best_len;
+				}
+
+				static size_t match_numeric(const char* p, const char* end, char* out, size_t& out_len) {
+					const char* q = p + 2;
+					bool hex = false;
+					if (q < end && (*q == 'x' || *q == 'X')) {
+						hex = true;
+						++q;
+					}
+
+					const char* digits = q;
+					unsigned long cp = 0;
+					for (; q < end; ++q) {
+						int d;
+						if (*q >= '0' && *q <= '9')
+							d = *q - '0';
+						else if (hex && *q >= 'a' && *q <= 'f')
+							d = *q - 'a' + 10;
+						else if (hex && *q >= 'A' && *q <= 'F')
+							d = *q - 'A' + 10;
+						else
+							break;
+						cp = cp * (hex ? 16 : 10) + d;
+						if (cp > 0x10FFFF)
+							cp = 0x110000;
+					}
+					if (q == digits)
+						return 0;
+					if (q < end && *q == ';')
+						++q;
+
+					out_len = utils::encode_utf8(code_point(cp), out);
+					return q - p;
+				}
+
+				/**
+				 * @brief the code point a numeric reference stands for, the C1 controls
+				 * are read as windows-1252 and the invalid ones become U+FFFD
+				 */
+				static unsigned int code_point(unsigned long cp) {
+					static const unsigned short windows_1252[32] = {
+						0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+						0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+						0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+						0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+					};
+					if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+						return 0xFFFD;
+					if (cp >= 0x80 && cp <= 0x9F)
+						return windows_1252[cp - 0x80];
+					return (unsigned int) cp;
+				}
+
+				static const CharRefNode* nodes() {
+					static const CharRefNode table[] = {
+						{0, 0, 52, 1, 0, 0, 0}, {0, 1, 16, 53, 0, 0, 0}, {1, 1, 8, 69, 0, 0, 0}, {2, 1, 14, 77, 0, 0, 0},
+						{3, 1, 11, 91, 0, 0, 0}, {4, 1, 16, 102, 0, 0, 0}, {5, 1, 5, 118, 0, 0, 0}, {6, 1, 12, 123, 0, 0, 0},
+						{7, 1, 8, 135, 0, 0, 0}, {8, 1, 14, 143, 0, 0, 0}, {9, 1, 5, 157, 0, 0, 0}, {10, 1, 7, 162, 0, 0, 0},
+						{11, 1, 11, 169, 0, 0, 0}, {12, 1, 8, 180, 0, 0, 0}, {13, 1, 9, 188, 0, 0, 0}, {14, 1, 14, 197, 0, 0, 0},
+						{15, 1, 9, 211, 0, 0, 0}, {16, 1, 4, 220, 0, 0, 0}, {17, 1, 12, 224, 0, 0, 0}, {18, 1, 13, 236, 0, 0, 0},
+						{19, 1, 11, 249, 0, 0, 0}, {20, 1, 14, 260, 0, 0, 0}, {21, 1, 9, 274, 0, 0, 0}, {22, 1, 5, 283, 0, 0, 0},
+						{23, 1, 4, 288, 0, 0, 0}, {24, 1, 9, 292, 0, 0, 0}, {25, 1, 8, 301, 0, 0, 0}, {26, 1, 16, 309, 0, 0, 0},
+						{27, 1, 16, 325, 0, 0, 0}, {28, 1, 15, 341, 0, 0, 0}, {29, 1, 19, 356, 0, 0, 0}, {30, 1, 18, 375, 0, 0, 0},
+						{31, 1, 12, 393, 0, 0, 0}, {32, 1, 17, 405, 0, 0, 0}, {33, 1, 10, 422, 0, 0, 0}, {34, 1, 15, 432, 0, 0, 0},
+						{35, 1, 6, 447, 0, 0, 0}, {36, 1, 8, 453, 0, 0, 0}, {37, 1, 23, 461, 0, 0, 0}, {38, 1, 14, 484, 0, 0, 0},
+						{39, 1, 24, 498, 0, 0, 0}, {40, 1, 18, 522, 0, 0, 0}, {41, 1, 12, 540, 0, 0, 0}, {42, 1, 6, 552, 0, 0, 0},
+						{43, 1, 21, 558, 0, 0, 0}, {44, 1, 19, 579, 0, 0, 0}, {45, 1, 13, 598, 0, 0, 0}, {46, 1, 18, 611, 0, 0, 0},
+						{47, 1, 15, 629, 0, 0, 0}, {48, 1, 7, 644, 0, 0, 0}, {49, 1, 14, 651, 0, 0, 0}, {50, 1, 8, 665, 0, 0, 0},
+						{51, 1, 10, 673, 0, 0, 0}, {52, 4, 0, 0, 0, 2, 1}, {56, 2, 0, 0, 2, 1, 1}, {58, 5, 0, 0, 3, 2, 1},
+						{63, 5, 0, 0, 5, 2, 0}, {28, 1, 2, 683, 0, 0, 0}, {68, 2, 0, 0, 7, 4, 0}, {70, 5, 0, 0, 11, 2, 1},
+						{75, 4, 0, 0, 13, 2, 0}, {79, 4, 0, 0, 15, 2, 0}, {83, 2, 0, 0, 17, 3, 0}, {40, 1, 2, 685, 0, 0, 0},
+						{85, 12, 0, 0, 20, 3, 0}, {97, 4, 0, 0, 23, 2, 1}, {44, 1, 2, 687, 0, 0, 0}, {101, 5, 0, 0, 25, 2, 1},
+						{106, 3, 0, 0, 27, 2, 1}, {26, 1, 2, 689, 0, 0, 0}, {109, 2, 0, 0, 29, 2, 0}, {30, 1, 3, 691, 0, 0, 0},
+						{68, 2, 0, 0, 31, 4, 0}, {111, 3, 0, 0, 35, 4, 0}, {64, 4, 0, 0, 39, 2, 0}, {114, 3, 0, 0, 41, 3, 0},
+						{117, 5, 0, 0, 44, 3, 0}, {122, 3, 0, 0, 47, 2, 0}, {125, 3, 0, 0, 49, 2, 1}, {26, 1, 3, 694, 0, 0, 0},
+						{28, 1, 4, 697, 0, 0, 0}, {128, 3, 0, 0, 51, 2, 0}, {30, 1, 2, 701, 0, 0, 0}, {68, 2, 0, 0, 53, 3, 0},
+						{33, 2, 0, 0, 56, 2, 0}, {131, 5, 4, 703, 0, 0, 0}, {136, 2, 2, 707, 0, 0, 0}, {40, 1, 4, 709, 0, 0, 0},
+						{138, 4, 0, 0, 58, 3, 0}, {114, 3, 0, 0, 61, 4, 0}, {142, 2, 1, 713, 65, 3, 0}, {3, 1, 1, 714, 68, 3, 0},
+						{144, 3, 0, 0, 71, 2, 0}, {147, 3, 0, 0, 73, 2, 0}, {150, 3, 0, 0, 75, 2, 0}, {26, 1, 3, 715, 0, 0, 0},
+						{28, 1, 2, 718, 0, 0, 0}, {74, 2, 1, 720, 77, 3, 0}, {68, 2, 0, 0, 80, 4, 0}, {34, 1, 2, 721, 0, 0, 0},
+						{40, 1, 4, 723, 0, 0, 0}, {44, 1, 2, 727, 0, 0, 0}, {153, 2, 0, 0, 84, 2, 0}, {155, 2, 0, 0, 86, 2, 1},
+						{58, 5, 0, 0, 88, 2, 1}, {28, 1, 3, 729, 0, 0, 0}, {128, 3, 0, 0, 90, 2, 0}, {68, 2, 0, 0, 92, 4, 0},
+						{70, 5, 0, 0, 96, 2, 1}, {157, 6, 0, 0, 98, 3, 0}, {38, 1, 2, 732, 0, 0, 0}, {40, 1, 2, 734, 0, 0, 0},
+						{163, 6, 0, 0, 101, 2, 0}, {169, 2, 2, 736, 0, 0, 0}, {44, 1, 2, 738, 0, 0, 0}, {171, 2, 0, 0, 103, 2, 0},
+						{106, 3, 0, 0, 105, 2, 1}, {49, 1, 2, 740, 0, 0, 0}, {109, 2, 0, 0, 107, 2, 0}, {68, 2, 0, 0, 109, 4, 0},
+						{173, 5, 2, 742, 0, 0, 0}, {40, 1, 3, 744, 0, 0, 0}, {114, 3, 0, 0, 113, 3, 0}, {144, 3, 0, 0, 116, 2, 0},
+						{19, 1, 0, 0, 118, 1, 1}, {178, 4, 1, 747, 119, 2, 0}, {63, 5, 0, 0, 121, 2, 0}, {28, 1, 3, 748, 0, 0, 0},
+						{128, 3, 0, 0, 123, 2, 0}, {68, 2, 0, 0, 125, 4, 0}, {32, 1, 0, 0, 129, 3, 0}, {111, 3, 0, 0, 132, 4, 0},
+						{182, 6, 6, 751, 0, 0, 0}, {114, 3, 0, 0, 136, 4, 0}, {45, 1, 0, 0, 140, 3, 0}, {188, 5, 0, 0, 143, 2, 0},
+						{26, 1, 2, 757, 0, 0, 0}, {193, 4, 0, 0, 145, 2, 0}, {68, 2, 0, 0, 147, 3, 0}, {197, 11, 0, 0, 150, 3, 0},
+						{40, 1, 2, 759, 0, 0, 0}, {44, 1, 2, 761, 0, 0, 0}, {117, 3, 2, 763, 0, 0, 0}, {208, 3, 0, 0, 153, 2, 0},
+						{211, 4, 0, 0, 155, 2, 0}, {215, 3, 0, 0, 157, 2, 0}, {58, 5, 0, 0, 159, 2, 1}, {28, 1, 2, 765, 0, 0, 0},
+						{128, 3, 0, 0, 161, 2, 0}, {68, 2, 0, 0, 163, 3, 0}, {70, 5, 0, 0, 166, 2, 1}, {38, 1, 2, 767, 163, 3, 0},
+						{39, 1, 2, 769, 0, 0, 0}, {40, 1, 3, 771, 0, 0, 0}, {114, 3, 0, 0, 168, 3, 0}, {101, 5, 0, 0, 171, 2, 0},
+						{46, 1, 2, 774, 0, 0, 0}, {28, 1, 2, 776, 0, 0, 0}, {68, 2, 0, 0, 173, 4, 0}, {111, 3, 0, 0, 177, 4, 0},
+						{44, 1, 2, 778, 0, 0, 0}, {218, 4, 0, 0, 181, 2, 0}, {122, 3, 0, 0, 183, 2, 0}, {144, 3, 0, 0, 185, 2, 0},
+						{222, 4, 0, 0, 187, 2, 0}, {28, 1, 2, 780, 0, 0, 0}, {68, 2, 0, 0, 189, 4, 0}, {111, 3, 0, 0, 193, 4, 0},
+						{114, 3, 0, 0, 197, 4, 0}, {144, 3, 0, 0, 201, 2, 0}, {19, 1, 0, 0, 203, 1, 1}, {26, 1, 5, 782, 0, 0, 0},
+						{28, 1, 3, 787, 0, 0, 0}, {30, 1, 2, 790, 0, 0, 0}, {68, 2, 0, 0, 204, 4, 0}, {37, 1, 1, 792, 208, 3, 0},
+						{226, 5, 0, 0, 211, 2, 0}, {40, 1, 3, 793, 0, 0, 0}, {44, 1, 3, 796, 0, 0, 0}, {45, 1, 0, 0, 213, 3, 0},
+						{222, 2, 0, 0, 216, 3, 0}, {109, 2, 0, 0, 219, 2, 0}, {30, 1, 2, 799, 0, 0, 0}, {68, 2, 0, 0, 221, 4, 0},
+						{231, 8, 0, 0, 225, 3, 0}, {111, 3, 0, 0, 228, 4, 0}, {114, 3, 0, 0, 232, 3, 0}, {46, 1, 0, 0, 235, 2, 0},
+						{144, 3, 0, 0, 237, 2, 0}, {58, 5, 0, 0, 239, 2, 0}, {28, 1, 3, 801, 0, 0, 0}, {30, 1, 3, 804, 0, 0, 0},
+						{68, 2, 0, 0, 241, 4, 0}, {40, 1, 4, 807, 0, 0, 0}, {114, 3, 0, 0, 245, 4, 0}, {101, 5, 0, 0, 249, 2, 1},
+						{46, 1, 0, 0, 251, 2, 0}, {52, 4, 0, 0, 253, 2, 0}, {58, 5, 0, 0, 255, 2, 1}, {28, 1, 2, 811, 0, 0, 0},
+						{239, 5, 0, 0, 257, 2, 0}, {68, 2, 0, 0, 259, 4, 0}, {70, 5, 0, 0, 263, 2, 1}, {38, 1, 3, 813, 0, 0, 0},
+						{111, 3, 0, 0, 265, 4, 0}, {244, 8, 2, 816, 0, 0, 0}, {43, 1, 0, 0, 269, 3, 0}, {44, 1, 2, 818, 0, 0, 0},
+						{93, 2, 2, 820, 0, 0, 0}, {106, 3, 0, 0, 272, 2, 1}, {252, 3, 2, 822, 0, 0, 0}, {255, 7, 0, 0, 274, 3, 0},
+						{109, 2, 0, 0, 277, 2, 0}, {68, 2, 0, 0, 279, 4, 0}, {33, 2, 0, 0, 283, 2, 0}, {34, 1, 0, 0, 285, 2, 0},
+						{262, 8, 0, 0, 287, 2, 0}, {40, 1, 2, 824, 0, 0, 0}, {43, 1, 3, 826, 289, 3, 0}, {44, 1, 2, 829, 0, 0, 0},
+						{270, 3, 0, 0, 292, 1, 1}, {68, 2, 0, 0, 293, 4, 0}, {111, 3, 0, 0, 297, 3, 0}, {114, 3, 0, 0, 300, 4, 0},
+						{273, 4, 0, 0, 304, 3, 0}, {277, 2, 0, 0, 307, 2, 1}, {26, 1, 3, 831, 0, 0, 0}, {28, 1, 3, 834, 0, 0, 0},
+						{30, 1, 1, 837, 309, 3, 0}, {68, 2, 0, 0, 309, 3, 0}, {279, 2, 0, 0, 312, 2, 0}, {281, 4, 8, 838, 0, 0, 0},
+						{40, 1, 2, 846, 0, 0, 0}, {285, 10, 0, 0, 314, 3, 0}, {44, 1, 2, 848, 0, 0, 0}, {295, 10, 0, 0, 317, 3, 0},
+						{7, 1, 2, 850, 0, 0, 0}, {305, 5, 0, 0, 320, 2, 0}, {58, 5, 0, 0, 322, 2, 0}, {28, 1, 4, 852, 324, 3, 0},
+						{68, 2, 0, 0, 327, 4, 0}, {310, 4, 4, 856, 0, 0, 0}, {314, 4, 0, 0, 331, 2, 0}, {318, 10, 0, 0, 333, 3, 0},
+						{111, 3, 0, 0, 336, 4, 0}, {42, 1, 2, 860, 0, 0, 0}, {114, 3, 0, 0, 340, 4, 0}, {289, 3, 0, 0, 344, 3, 0},
+						{46, 1, 4, 862, 0, 0, 0}, {328, 4, 0, 0, 347, 2, 1}, {332, 4, 0, 0, 349, 3, 0}, {18, 1, 2, 866, 0, 0, 0},
+						{26, 1, 2, 868, 0, 0, 0}, {28, 1, 3, 870, 0, 0, 0}, {68, 2, 0, 0, 352, 4, 0}, {33, 1, 2, 873, 0, 0, 0},
+						{102, 4, 3, 875, 356, 3, 0}, {111, 3, 0, 0, 359, 4, 0}, {336, 8, 0, 0, 363, 3, 0}, {44, 1, 2, 878, 0, 0, 0},
+						{26, 1, 2, 880, 0, 0, 0}, {63, 2, 2, 882, 0, 0, 0}, {28, 1, 2, 884, 0, 0, 0}, {239, 5, 0, 0, 366, 2, 0},
+						{68, 2, 0, 0, 368, 4, 0}, {70, 5, 0, 0, 372, 2, 1}, {79, 4, 0, 0, 374, 2, 0}, {39, 1, 2, 886, 0, 0, 0},
+						{40, 1, 2, 888, 0, 0, 0}, {41, 1, 8, 890, 0, 0, 0}, {97, 4, 0, 0, 376, 2, 0}, {114, 3, 0, 0, 378, 4, 0},
+						{101, 5, 0, 0, 382, 2, 0}, {106, 3, 0, 0, 384, 2, 1}, {344, 4, 0, 0, 386, 3, 0}, {348, 3, 0, 0, 389, 3, 0},
+						{109, 2, 0, 0, 392, 2, 0}, {351, 4, 1, 898, 394, 3, 0}, {30, 1, 2, 899, 0, 0, 0}, {68, 2, 0, 0, 397, 4, 0},
+						{111, 3, 0, 0, 401, 4, 0}, {114, 3, 0, 0, 405, 4, 0}, {355, 5, 0, 0, 409, 3, 0}, {193, 4, 0, 0, 412, 2, 0},
+						{360, 4, 0, 0, 414, 3, 0}, {68, 2, 0, 0, 417, 4, 0}, {111, 3, 0, 0, 421, 4, 0}, {114, 3, 0, 0, 425, 4, 0},
+						{68, 2, 0, 0, 429, 4, 0}, {34, 1, 0, 0, 433, 2, 0}, {111, 3, 0, 0, 435, 4, 0}, {114, 3, 0, 0, 439, 4, 0},
+						{364, 3, 0, 0, 443, 2, 0}, {367, 3, 0, 0, 445, 2, 0}, {370, 3, 0, 0, 447, 2, 0}, {58, 5, 0, 0, 449, 2, 1},
+						{28, 1, 2, 901, 0, 0, 0}, {68, 2, 0, 0, 451, 4, 0}, {111, 3, 0, 0, 455, 4, 0}, {114, 3, 0, 0, 459, 4, 0},
+						{106, 3, 0, 0, 463, 2, 0}, {122, 3, 0, 0, 465, 2, 0}, {58, 5, 0, 0, 467, 2, 0}, {28, 1, 2, 903, 0, 0, 0},
+						{128, 3, 0, 0, 469, 2, 0}, {30, 1, 2, 905, 0, 0, 0}, {68, 2, 0, 0, 471, 3, 0}, {111, 3, 0, 0, 474, 3, 0},
+						{114, 3, 0, 0, 477, 4, 0}, {58, 5, 0, 0, 481, 2, 1}, {63, 5, 0, 0, 483, 2, 0}, {28, 1, 5, 907, 485, 3, 0},
+						{373, 4, 0, 0, 488, 2, 1}, {31, 1, 1, 912, 20, 3, 0}, {70, 5, 0, 0, 490, 2, 1}, {37, 1, 2, 913, 0, 0, 0},
+						{38, 1, 2, 915, 0, 0, 0}, {39, 1, 2, 917, 0, 0, 0}, {40, 1, 2, 919, 0, 0, 0}, {41, 1, 6, 921, 492, 3, 0},
+						{97, 4, 0, 0, 495, 2, 1}, {44, 1, 3, 927, 0, 0, 0}, {101, 5, 0, 0, 497, 2, 1}, {106, 3, 0, 0, 499, 2, 1},
+						{48, 1, 2, 930, 0, 0, 0}, {377, 3, 0, 0, 501, 3, 0}, {26, 1, 2, 932, 0, 0, 0}, {380, 3, 1, 934, 504, 3, 0},
+						{28, 1, 2, 935, 0, 0, 0}, {383, 4, 0, 0, 507, 3, 0}, {30, 1, 5, 937, 0, 0, 0}, {68, 2, 0, 0, 510, 4, 0},
+						{54, 2, 7, 942, 0, 0, 0}, {387, 5, 0, 0, 514, 3, 0}, {37, 1, 3, 949, 0, 0, 0}, {39, 1, 2, 952, 0, 0, 0},
+						{40, 1, 4, 954, 0, 0, 0}, {392, 5, 0, 0, 517, 3, 0}, {43, 1, 2, 958, 0, 0, 0}, {44, 1, 4, 960, 0, 0, 0},
+						{46, 1, 2, 964, 0, 0, 0}, {26, 1, 3, 966, 0, 0, 0}, {28, 1, 4, 969, 0, 0, 0}, {128, 3, 0, 0, 520, 2, 0},
+						{30, 1, 3, 973, 0, 0, 0}, {68, 2, 0, 0, 522, 4, 0}, {33, 1, 3, 976, 0, 0, 0}, {131, 2, 6, 979, 526, 3, 0},
+						{397, 4, 1, 985, 529, 3, 0}, {40, 1, 4, 986, 0, 0, 0}, {43, 1, 2, 990, 0, 0, 0}, {44, 1, 2, 992, 0, 0, 0},
+						{401, 4, 0, 0, 532, 3, 0}, {46, 1, 7, 994, 0, 0, 0}, {48, 1, 2, 1001, 0, 0, 0}, {405, 5, 0, 0, 535, 3, 0},
+						{410, 3, 0, 0, 538, 3, 0}, {413, 3, 0, 0, 541, 3, 0}, {26, 1, 4, 1003, 0, 0, 0}, {27, 1, 2, 1007, 0, 0, 0},
+						{28, 1, 2, 1009, 0, 0, 0}, {29, 1, 2, 1011, 544, 3, 0}, {30, 1, 3, 1013, 0, 0, 0}, {31, 1, 2, 1016, 0, 0, 0},
+						{416, 3, 2, 1018, 0, 0, 0}, {34, 1, 5, 1020, 0, 0, 0}, {419, 3, 0, 0, 547, 2, 0}, {108, 2, 2, 1025, 0, 0, 0},
+						{40, 1, 5, 1027, 0, 0, 0}, {43, 1, 2, 1032, 0, 0, 0}, {44, 1, 3, 1034, 0, 0, 0}, {45, 1, 2, 1037, 0, 0, 0},
+						{46, 1, 2, 1039, 0, 0, 0}, {422, 6, 0, 0, 549, 3, 0}, {51, 1, 2, 1041, 0, 0, 0}, {3, 1, 2, 1043, 0, 0, 0},
+						{26, 1, 2, 1045, 0, 0, 0}, {28, 1, 4, 1047, 0, 0, 0}, {128, 3, 0, 0, 552, 2, 0}, {30, 1, 0, 0, 554, 3, 0},
+						{31, 1, 2, 1051, 0, 0, 0}, {32, 1, 2, 1053, 557, 3, 0}, {37, 1, 3, 1055, 560, 3, 0}, {38, 1, 3, 1058, 0, 0, 0},
+						{39, 1, 2, 1061, 0, 0, 0}, {40, 1, 2, 1063, 0, 0, 0}, {41, 1, 3, 1065, 0, 0, 0}, {42, 1, 4, 1068, 0, 0, 0},
+						{43, 1, 2, 1072, 0, 0, 0}, {44, 1, 3, 1074, 0, 0, 0}, {45, 1, 2, 1077, 0, 0, 0}, {46, 1, 2, 1079, 0, 0, 0},
+						{49, 1, 3, 1081, 0, 0, 0}, {428, 12, 0, 0, 563, 3, 0}, {109, 2, 0, 0, 566, 2, 0}, {440, 5, 0, 0, 568, 3, 0},
+						{31, 1, 3, 1084, 0, 0, 0}, {445, 4, 0, 0, 571, 3, 0}, {449, 4, 0, 0, 574, 2, 0}, {37, 1, 3, 1087, 0, 0, 0},
+						{453, 3, 0, 0, 576, 2, 0}, {40, 1, 2, 1090, 0, 0, 0}, {456, 7, 0, 0, 578, 3, 0}, {43, 1, 2, 1092, 0, 0, 0},
+						{114, 3, 0, 0, 581, 4, 0}, {4, 1, 1, 1094, 585, 3, 0}, {26, 1, 3, 1095, 0, 0, 0}, {63, 5, 0, 0, 588, 2, 0},
+						{28, 1, 2, 1098, 0, 0, 0}, {128, 3, 0, 0, 590, 2, 0}, {30, 1, 3, 1100, 592, 3, 0}, {68, 2, 0, 0, 595, 4, 0},
+						{32, 1, 1, 1103, 140, 3, 0}, {394, 4, 0, 0, 599, 3, 0}, {419, 3, 0, 0, 602, 2, 0}, {37, 1, 3, 1104, 604, 3, 0},
+						{39, 1, 4, 1107, 0, 0, 0}, {111, 3, 0, 0, 607, 4, 0}, {71, 4, 0, 0, 611, 1, 0}, {44, 1, 2, 1111, 0, 0, 0},
+						{45, 1, 5, 1113, 118, 1, 1}, {47, 1, 2, 1118, 0, 0, 0}, {410, 3, 0, 0, 612, 3, 0}, {26, 1, 4, 1120, 0, 0, 0},
+						{348, 3, 0, 0, 615, 3, 0}, {193, 4, 0, 0, 618, 2, 0}, {30, 1, 3, 1124, 0, 0, 0}, {68, 2, 0, 0, 620, 4, 0},
+						{463, 2, 2, 1127, 0, 0, 0}, {40, 1, 5, 1129, 0, 0, 0}, {44, 1, 3, 1134, 0, 0, 0}, {50, 1, 2, 1137, 0, 0, 0},
+						{58, 5, 0, 0, 624, 2, 1}, {28, 1, 2, 1139, 626, 3, 0}, {30, 1, 2, 1141, 0, 0, 0}, {31, 1, 2, 1143, 0, 0, 0},
+						{70, 5, 0, 0, 629, 2, 1}, {34, 1, 3, 1145, 631, 3, 0}, {449, 4, 0, 0, 634, 2, 0}, {38, 1, 3, 1148, 0, 0, 0},
+						{39, 1, 4, 1151, 98, 3, 0}, {40, 1, 4, 1155, 0, 0, 0}, {465, 4, 0, 0, 636, 3, 0}, {469, 5, 0, 0, 639, 2, 1},
+						{44, 1, 2, 1159, 0, 0, 0}, {45, 1, 1, 1161, 641, 3, 0}, {46, 1, 2, 1162, 0, 0, 0}, {28, 1, 2, 1164, 0, 0, 0},
+						{68, 2, 0, 0, 644, 4, 0}, {474, 4, 0, 0, 648, 2, 0}, {111, 3, 0, 0, 650, 4, 0}, {44, 1, 2, 1166, 0, 0, 0},
+						{218, 4, 0, 0, 654, 2, 0}, {222, 4, 1, 1168, 656, 2, 0}, {28, 1, 2, 1169, 0, 0, 0}, {68, 2, 0, 0, 658, 4, 0},
+						{478, 5, 0, 0, 662, 2, 0}, {483, 3, 0, 0, 664, 2, 0}, {419, 3, 0, 0, 666, 2, 0}, {111, 3, 0, 0, 668, 4, 0},
+						{114, 3, 0, 0, 672, 4, 0}, {0, 1, 3, 1171, 0, 0, 0}, {273, 4, 0, 0, 676, 3, 0}, {4, 1, 1, 1174, 679, 3, 0},
+						{413, 3, 0, 0, 682, 3, 0}, {26, 1, 9, 1175, 0, 0, 0}, {27, 1, 3, 1184, 0, 0, 0}, {28, 1, 4, 1187, 0, 0, 0},
+						{29, 1, 4, 1191, 0, 0, 0}, {30, 1, 4, 1195, 685, 3, 0}, {31, 1, 3, 1199, 0, 0, 0}, {32, 1, 1, 1202, 688, 3, 0},
+						{33, 1, 2, 1203, 0, 0, 0}, {419, 3, 0, 0, 691, 2, 0}, {37, 1, 4, 1205, 213, 3, 0}, {38, 1, 2, 1209, 0, 0, 0},
+						{39, 1, 4, 1211, 0, 0, 0}, {40, 1, 8, 1215, 0, 0, 0}, {456, 3, 1, 1223, 693, 1, 0}, {43, 1, 5, 1224, 0, 0, 0},
+						{44, 1, 6, 1229, 0, 0, 0}, {45, 1, 7, 1235, 203, 1, 1}, {248, 2, 2, 1242, 0, 0, 0}, {47, 1, 2, 1244, 0, 0, 0},
+						{486, 4, 0, 0, 694, 3, 0}, {26, 1, 4, 1246, 0, 0, 0}, {28, 1, 2, 1250, 0, 0, 0}, {351, 4, 0, 0, 697, 3, 0},
+						{490, 12, 0, 0, 700, 3, 0}, {68, 2, 0, 0, 703, 4, 0}, {279, 2, 0, 0, 707, 3, 0}, {34, 1, 3, 1252, 0, 0, 0},
+						{37, 1, 2, 1255, 0, 0, 0}, {502, 5, 0, 0, 225, 3, 0}, {40, 1, 2, 1257, 0, 0, 0}, {41, 1, 0, 0, 225, 3, 0},
+						{44, 1, 2, 1259, 0, 0, 0}, {46, 1, 2, 1261, 710, 2, 0}, {6, 1, 2, 1263, 0, 0, 0}, {11, 1, 3, 1265, 0, 0, 0},
+						{507, 10, 0, 0, 712, 3, 0}, {21, 1, 2, 1268, 0, 0, 0}, {26, 1, 5, 1270, 0, 0, 0}, {27, 1, 2, 1275, 0, 0, 0},
+						{28, 1, 5, 1277, 0, 0, 0}, {351, 4, 0, 0, 715, 3, 0}, {30, 1, 6, 1282, 718, 3, 0}, {68, 2, 0, 0, 721, 4, 0},
+						{32, 1, 4, 1288, 0, 0, 0}, {33, 1, 3, 1292, 0, 0, 0}, {34, 1, 2, 1295, 725, 3, 0}, {419, 3, 0, 0, 728, 2, 0},
+						{37, 1, 7, 1297, 0, 0, 0}, {226, 3, 0, 0, 730, 3, 0}, {40, 1, 2, 1304, 0, 0, 0}, {41, 1, 3, 1306, 0, 0, 0},
+						{43, 1, 4, 1309, 0, 0, 0}, {44, 1, 7, 1313, 0, 0, 0}, {45, 1, 4, 1320, 0, 0, 0}, {46, 1, 1, 1324, 733, 2, 0},
+						{47, 1, 9, 1325, 0, 0, 0}, {48, 1, 3, 1334, 0, 0, 0}, {18, 1, 0, 0, 735, 3, 0}, {26, 1, 2, 1337, 0, 0, 0},
+						{28, 1, 2, 1339, 0, 0, 0}, {29, 1, 5, 1341, 0, 0, 0}, {373, 4, 0, 0, 738, 2, 0}, {31, 1, 2, 1346, 0, 0, 0},
+						{32, 1, 3, 1348, 0, 0, 0}, {33, 1, 2, 1351, 0, 0, 0}, {460, 3, 0, 0, 740, 3, 0}, {37, 1, 4, 1353, 0, 0, 0},
+						{38, 1, 3, 1357, 0, 0, 0}, {111, 3, 0, 0, 743, 4, 0}, {41, 1, 3, 1360, 0, 0, 0}, {43, 1, 6, 1363, 747, 3, 0},
+						{44, 1, 3, 1369, 0, 0, 0}, {93, 2, 2, 1372, 0, 0, 0}, {106, 3, 0, 0, 750, 2, 1}, {517, 4, 0, 0, 752, 3, 0},
+						{181, 2, 3, 1374, 755, 3, 0}, {109, 2, 0, 0, 758, 2, 0}, {186, 2, 5, 1377, 0, 0, 0}, {68, 2, 0, 0, 760, 4, 0},
+						{33, 1, 3, 1382, 0, 0, 0}, {34, 1, 2, 1385, 764, 2, 0}, {37, 1, 2, 1387, 0, 0, 0}, {38, 1, 0, 0, 287, 2, 0},
+						{40, 1, 3, 1389, 0, 0, 0}, {43, 1, 9, 1392, 766, 3, 0}, {44, 1, 2, 1401, 0, 0, 0}, {521, 5, 0, 0, 769, 3, 0},
+						{68, 2, 0, 0, 772, 4, 0}, {460, 3, 0, 0, 776, 3, 0}, {111, 3, 0, 0, 779, 4, 0}, {392, 5, 0, 0, 783, 3, 0},
+						{114, 3, 0, 0, 786, 4, 0}, {46, 1, 3, 1403, 0, 0, 0}, {0, 1, 3, 1406, 0, 0, 0}, {273, 4, 0, 0, 790, 3, 0},
+						{413, 3, 0, 0, 793, 3, 0}, {26, 1, 7, 1409, 0, 0, 0}, {27, 1, 3, 1416, 0, 0, 0}, {28, 1, 4, 1419, 0, 0, 0},
+						{29, 1, 4, 1423, 0, 0, 0}, {30, 1, 3, 1427, 0, 0, 0}, {31, 1, 3, 1430, 0, 0, 0}, {33, 1, 2, 1433, 0, 0, 0},
+						{34, 1, 3, 1435, 0, 0, 0}, {37, 1, 3, 1438, 0, 0, 0}, {526, 5, 1, 1441, 796, 3, 0}, {531, 4, 0, 0, 799, 3, 0},
+						{40, 1, 4, 1442, 0, 0, 0}, {41, 1, 2, 1446, 0, 0, 0}, {535, 4, 0, 0, 802, 3, 0}, {44, 1, 4, 1448, 0, 0, 0},
+						{45, 1, 3, 1452, 0, 0, 0}, {539, 6, 0, 0, 805, 3, 0}, {49, 1, 0, 0, 808, 3, 0}, {58, 5, 0, 0, 811, 2, 0},
+						{545, 4, 0, 0, 813, 3, 0}, {28, 1, 9, 1455, 816, 3, 0}, {128, 3, 2, 1464, 819, 3, 0}, {30, 1, 7, 1466, 0, 0, 0},
+						{68, 2, 1, 1473, 822, 4, 0}, {33, 1, 4, 1474, 0, 0, 0}, {34, 1, 2, 1478, 0, 0, 0}, {549, 4, 0, 0, 826, 3, 0},
+						{38, 1, 4, 1480, 0, 0, 0}, {40, 1, 3, 1484, 0, 0, 0}, {204, 2, 2, 1487, 0, 0, 0}, {42, 1, 3, 1489, 0, 0, 0},
+						{535, 4, 0, 0, 829, 3, 0}, {44, 1, 4, 1492, 0, 0, 0}, {45, 1, 2, 1496, 0, 0, 0}, {46, 1, 5, 1498, 0, 0, 0},
+						{48, 1, 3, 1503, 0, 0, 0}, {553, 4, 0, 0, 832, 2, 1}, {26, 1, 2, 1506, 0, 0, 0}, {380, 3, 0, 0, 834, 3, 0},
+						{28, 1, 3, 1508, 0, 0, 0}, {128, 3, 0, 0, 363, 3, 0}, {557, 5, 0, 0, 837, 3, 0}, {68, 2, 0, 0, 840, 4, 0},
+						{33, 1, 4, 1511, 0, 0, 0}, {34, 1, 3, 1515, 0, 0, 0}, {40, 1, 3, 1518, 0, 0, 0}, {392, 5, 0, 0, 844, 3, 0},
+						{43, 1, 3, 1521, 0, 0, 0}, {44, 1, 3, 1524, 0, 0, 0}, {48, 1, 2, 1527, 0, 0, 0}, {410, 3, 0, 0, 847, 3, 0},
+						{413, 3, 0, 0, 850, 3, 0}, {26, 1, 2, 1529, 0, 0, 0}, {63, 2, 2, 1531, 0, 0, 0}, {28, 1, 2, 1533, 0, 0, 0},
+						{29, 1, 3, 1535, 0, 0, 0}, {31, 1, 2, 1538, 0, 0, 0}, {70, 5, 0, 0, 853, 2, 1}, {33, 1, 2, 1540, 0, 0, 0},
+						{37, 1, 2, 1542, 0, 0, 0}, {38, 1, 2, 1544, 0, 0, 0}, {40, 1, 2, 1546, 0, 0, 0}, {41, 1, 6, 1548, 0, 0, 0},
+						{43, 1, 3, 1554, 0, 0, 0}, {114, 3, 0, 0, 855, 4, 0}, {45, 1, 3, 1557, 0, 0, 0}, {46, 1, 2, 1560, 0, 0, 0},
+						{422, 6, 0, 0, 859, 3, 0}, {410, 3, 0, 0, 862, 3, 0}, {273, 3, 1, 1562, 865, 3, 0}, {344, 4, 0, 0, 868, 3, 0},
+						{26, 1, 2, 1563, 0, 0, 0}, {109, 2, 0, 0, 871, 2, 0}, {351, 4, 0, 0, 873, 3, 0}, {30, 1, 3, 1565, 0, 0, 0},
+						{68, 2, 0, 0, 876, 4, 0}, {562, 4, 0, 0, 880, 3, 0}, {566, 3, 2, 1568, 0, 0, 0}, {111, 3, 0, 0, 883, 4, 0},
+						{569, 4, 0, 0, 887, 3, 0}, {573, 4, 0, 0, 890, 3, 0}, {44, 1, 2, 1570, 0, 0, 0}, {577, 6, 0, 0, 893, 3, 0},
+						{193, 4, 0, 0, 896, 2, 0}, {30, 1, 2, 1572, 0, 0, 0}, {68, 2, 0, 0, 898, 4, 0}, {111, 3, 0, 0, 902, 4, 0},
+						{41, 1, 0, 0, 906, 3, 0}, {43, 1, 1, 1574, 909, 3, 0}, {114, 3, 0, 0, 912, 4, 0}, {28, 1, 3, 1575, 0, 0, 0},
+						{583, 4, 0, 0, 916, 3, 0}, {68, 2, 0, 0, 919, 4, 0}, {33, 1, 2, 1578, 0, 0, 0}, {34, 1, 0, 0, 923, 2, 0},
+						{37, 1, 2, 1580, 0, 0, 0}, {587, 3, 0, 0, 925, 3, 0}, {590, 3, 0, 0, 928, 3, 0}, {40, 1, 3, 1582, 0, 0, 0},
+						{43, 1, 2, 1585, 0, 0, 0}, {44, 1, 2, 1587, 0, 0, 0}, {46, 1, 2, 1589, 0, 0, 0}, {593, 3, 0, 0, 931, 3, 0},
+						{596, 5, 0, 0, 414, 3, 0}, {58, 2, 2, 1591, 0, 0, 0}, {28, 1, 2, 1593, 0, 0, 0}, {160, 2, 0, 0, 934, 2, 1},
+						{68, 2, 0, 0, 936, 4, 0}, {601, 3, 0, 0, 940, 2, 0}, {111, 3, 0, 0, 942, 4, 0}, {114, 3, 0, 0, 946, 4, 0},
+						{46, 1, 2, 1595, 0, 0, 0}, {58, 5, 0, 0, 950, 2, 0}, {28, 1, 2, 1597, 0, 0, 0}, {128, 3, 0, 0, 952, 2, 0},
+						{30, 1, 2, 1599, 0, 0, 0}, {68, 2, 0, 0, 954, 4, 0}, {483, 3, 0, 0, 958, 2, 0}, {604, 6, 0, 0, 960, 3, 0},
+						{111, 3, 0, 0, 963, 4, 0}, {114, 3, 0, 0, 967, 4, 0}, {48, 1, 2, 1601, 0, 0, 0}, {131, 3, 0, 0, 971, 2, 1},
+						{50, 1, 0, 0, 973, 2, 0}, {610, 3, 0, 0, 975, 2, 0}, {112, 2, 0, 0, 977, 4, 0}, {81, 2, 0, 0, 981, 4, 0},
+						{613, 4, 0, 0, 985, 3, 0}, {617, 7, 0, 0, 988, 3, 0}, {43, 1, 2, 1603, 0, 0, 0}, {624, 5, 0, 0, 991, 3, 0},
+						{629, 8, 0, 0, 41, 3, 0}, {171, 2, 0, 0, 994, 2, 0}, {59, 4, 0, 0, 996, 2, 0}, {41, 1, 1, 1605, 998, 3, 0},
+						{637, 5, 0, 0, 53, 3, 0}, {642, 4, 0, 0, 1001, 2, 0}, {646, 4, 0, 0, 1003, 2, 1}, {131, 3, 0, 0, 1005, 2, 0},
+						{650, 5, 0, 0, 1007, 3, 0}, {655, 5, 0, 0, 1010, 2, 0}, {660, 7, 0, 0, 1012, 2, 0}, {341, 3, 0, 0, 1014, 3, 0},
+						{265, 5, 0, 0, 1017, 3, 0}, {235, 4, 0, 0, 1020, 3, 0}, {667, 5, 0, 0, 1023, 3, 0}, {672, 21, 0, 0, 1026, 3, 0},
+						{693, 7, 2, 1606, 0, 0, 0}, {166, 3, 1, 1608, 1029, 3, 0}, {39, 1, 3, 1609, 0, 0, 0}, {41, 1, 2, 1612, 0, 0, 0},
+						{700, 29, 0, 0, 1032, 3, 0}, {729, 3, 0, 0, 1035, 3, 0}, {732, 6, 0, 0, 1038, 3, 0}, {738, 4, 0, 0, 1041, 3, 0},
+						{275, 2, 0, 0, 1044, 3, 0}, {353, 3, 0, 0, 1047, 3, 0}, {642, 4, 0, 0, 1050, 2, 0}, {50, 1, 0, 0, 1052, 2, 0},
+						{171, 2, 0, 0, 1054, 2, 0}, {26, 1, 2, 1614, 0, 0, 0}, {742, 11, 0, 0, 544, 3, 0}, {112, 2, 0, 0, 1056, 4, 0},
+						{45, 1, 2, 1616, 1060, 2, 0}, {753, 4, 6, 1618, 0, 0, 0}, {757, 2, 6, 1624, 0, 0, 0}, {81, 2, 0, 0, 1062, 4, 0},
+						{759, 4, 0, 0, 1066, 2, 0}, {642, 4, 0, 0, 1068, 2, 0}, {131, 3, 0, 0, 1070, 2, 1}, {50, 1, 0, 0, 1072, 2, 0},
+						{80, 3, 0, 0, 1074, 2, 0}, {763, 3, 2, 1630, 0, 0, 0}, {610, 3, 0, 0, 1076, 2, 0}, {112, 2, 0, 0, 1078, 4, 0},
+						{259, 2, 1, 1632, 1082, 3, 0}, {766, 8, 0, 0, 1085, 3, 0}, {81, 2, 0, 0, 1088, 3, 0}, {394, 2, 0, 0, 1091, 3, 0},
+						{774, 4, 0, 0, 1094, 3, 0}, {778, 10, 0, 0, 554, 3, 0}, {788, 11, 0, 0, 1097, 3, 0}, {799, 15, 0, 0, 1100, 3, 0},
+						{112, 2, 0, 0, 1103, 4, 0}, {814, 4, 0, 0, 1107, 3, 0}, {818, 8, 0, 0, 113, 3, 0}, {29, 1, 0, 0, 1110, 2, 0},
+						{646, 4, 0, 0, 1112, 2, 0}, {131, 3, 0, 0, 1114, 2, 0}, {50, 1, 0, 0, 1116, 2, 0}, {826, 5, 1, 1633, 592, 3, 0},
+						{831, 9, 0, 0, 585, 3, 0}, {840, 7, 0, 0, 1118, 3, 0}, {847, 4, 0, 0, 604, 3, 0}, {851, 10, 0, 0, 1121, 3, 0},
+						{861, 5, 0, 0, 1124, 3, 0}, {866, 3, 0, 0, 1127, 2, 0}, {45, 1, 0, 0, 1129, 1, 0}, {112, 2, 0, 0, 1130, 3, 0},
+						{869, 12, 0, 0, 1133, 3, 0}, {81, 2, 0, 0, 150, 3, 0}, {759, 4, 0, 0, 1136, 2, 0}, {881, 8, 0, 0, 44, 3, 0},
+						{826, 5, 0, 0, 1138, 3, 0}, {131, 3, 0, 0, 1141, 2, 1}, {50, 1, 0, 0, 1143, 2, 0}, {26, 1, 2, 1634, 0, 0, 0},
+						{889, 5, 0, 0, 1145, 3, 0}, {45, 1, 1, 1636, 1148, 3, 0}, {894, 7, 2, 1637, 0, 0, 0}, {610, 3, 0, 0, 1151, 2, 0},
+						{112, 2, 0, 0, 1153, 4, 0}, {171, 2, 0, 0, 1157, 2, 0}, {219, 3, 0, 0, 1159, 2, 0}, {107, 2, 0, 0, 1161, 2, 1},
+						{131, 3, 0, 0, 1163, 2, 0}, {50, 1, 0, 0, 1165, 2, 0}, {81, 2, 0, 0, 1167, 4, 0}, {901, 4, 0, 0, 1171, 2, 0},
+						{646, 4, 0, 0, 1173, 2, 0}, {50, 1, 0, 0, 1175, 2, 0}, {59, 4, 0, 0, 1177, 2, 0}, {905, 4, 0, 0, 1179, 2, 0},
+						{99, 2, 0, 0, 1181, 3, 0}, {909, 8, 0, 0, 1184, 3, 0}, {275, 2, 0, 0, 1187, 3, 0}, {642, 4, 0, 0, 1190, 2, 0},
+						{646, 4, 0, 0, 1192, 2, 0}, {50, 1, 0, 0, 1194, 2, 0}, {917, 2, 10, 1639, 0, 0, 0}, {140, 2, 6, 1649, 0, 0, 0},
+						{919, 8, 0, 0, 1196, 3, 0}, {99, 2, 4, 1655, 0, 0, 0}, {112, 2, 0, 0, 1199, 4, 0}, {927, 3, 2, 1659, 0, 0, 0},
+						{81, 2, 0, 0, 1184, 3, 0}, {33, 1, 0, 0, 1203, 3, 0}, {759, 4, 0, 0, 1206, 2, 0}, {930, 9, 0, 0, 1208, 3, 0},
+						{939, 7, 0, 0, 232, 3, 0}, {642, 4, 0, 0, 1211, 2, 0}, {646, 4, 0, 0, 1213, 2, 0}, {50, 1, 0, 0, 1215, 2, 0},
+						{946, 6, 3, 1661, 0, 0, 0}, {952, 4, 2, 1664, 0, 0, 0}, {956, 5, 0, 0, 1217, 1, 0}, {961, 5, 0, 0, 1218, 3, 0},
+						{966, 14, 0, 0, 1221, 2, 0}, {112, 2, 0, 0, 1223, 3, 0}, {45, 1, 12, 1666, 1226, 3, 0}, {131, 3, 0, 0, 1229, 2, 1},
+						{50, 1, 0, 0, 1231, 2, 0}, {80, 3, 0, 0, 1233, 2, 0}, {980, 3, 0, 0, 1235, 2, 0}, {983, 5, 0, 0, 1237, 2, 0},
+						{988, 11, 0, 0, 1239, 3, 0}, {994, 5, 0, 0, 1242, 3, 0}, {81, 2, 0, 0, 1245, 4, 0}, {620, 4, 0, 0, 1249, 2, 1},
+						{103, 3, 0, 0, 1251, 2, 1}, {669, 3, 0, 0, 1253, 3, 0}, {1, 1, 2, 1678, 0, 0, 0}, {999, 11, 0, 0, 1256, 3, 0},
+						{1010, 11, 0, 0, 147, 3, 0}, {112, 2, 0, 0, 1259, 3, 0}, {1021, 6, 3, 1680, 766, 3, 0}, {394, 3, 0, 0, 1262, 3, 0},
+						{40, 1, 2, 1683, 0, 0, 0}, {81, 2, 0, 0, 1265, 4, 0}, {34, 1, 0, 0, 1269, 2, 0}, {59, 4, 0, 0, 1271, 2, 0},
+						{99, 2, 0, 0, 1273, 3, 0}, {275, 2, 1, 1685, 1276, 3, 0}, {642, 4, 0, 0, 1279, 2, 0}, {646, 4, 0, 0, 1281, 2, 0},
+						{50, 1, 0, 0, 1283, 2, 0}, {1027, 5, 2, 1686, 0, 0, 0}, {0, 1, 2, 1688, 0, 0, 0}, {1032, 7, 0, 0, 1285, 3, 0},
+						{341, 2, 2, 1690, 0, 0, 0}, {1039, 5, 0, 0, 1288, 3, 0}, {19, 1, 2, 1692, 0, 0, 0}, {1044, 2, 3, 1694, 0, 0, 0},
+						{1046, 6, 1, 1697, 1291, 3, 0}, {290, 5, 0, 0, 1145, 3, 0}, {112, 2, 0, 0, 1294, 3, 0}, {1052, 10, 0, 0, 1297, 3, 0},
+						{81, 2, 0, 0, 1300, 3, 0}, {33, 1, 0, 0, 1303, 3, 0}, {1062, 4, 0, 0, 1306, 2, 0}, {109, 2, 0, 0, 1308, 2, 0},
+						{642, 4, 0, 0, 1310, 2, 0}, {646, 4, 0, 0, 1312, 2, 0}, {131, 3, 0, 0, 1314, 2, 0}, {50, 1, 0, 0, 1316, 2, 0},
+						{1066, 9, 0, 0, 1318, 3, 0}, {1075, 9, 0, 0, 826, 3, 0}, {1084, 10, 0, 0, 829, 3, 0}, {1094, 7, 0, 0, 1321, 3, 0},
+						{201, 2, 0, 0, 1324, 3, 0}, {795, 4, 3, 1698, 1327, 3, 0}, {27, 1, 1, 1701, 1330, 3, 0}, {28, 1, 2, 1702, 0, 0, 0},
+						{38, 1, 0, 0, 1333, 3, 0}, {41, 1, 2, 1704, 1336, 3, 0}, {122, 3, 0, 0, 1339, 2, 0}, {109, 2, 0, 0, 1341, 2, 0},
+						{27, 1, 0, 0, 1343, 1, 0}, {46, 1, 0, 0, 1344, 2, 0}, {642, 4, 0, 0, 1346, 2, 0}, {646, 4, 0, 0, 1348, 2, 0},
+						{50, 1, 0, 0, 1350, 2, 0}, {30, 1, 2, 1706, 0, 0, 0}, {34, 1, 2, 1708, 0, 0, 0}, {826, 5, 0, 0, 1352, 3, 0},
+						{831, 9, 0, 0, 1355, 3, 0}, {861, 5, 0, 0, 492, 3, 0}, {81, 2, 0, 0, 1358, 4, 0}, {759, 4, 0, 0, 1362, 2, 0},
+						{59, 4, 0, 0, 1364, 2, 1}, {275, 2, 1, 1710, 1366, 3, 0}, {109, 2, 0, 0, 1369, 2, 0}, {65, 3, 0, 0, 1371, 2, 0},
+						{131, 3, 0, 0, 1373, 2, 1}, {50, 1, 0, 0, 1375, 2, 0}, {1101, 3, 2, 1711, 0, 0, 0}, {94, 3, 1, 1713, 1377, 3, 0},
+						{610, 3, 0, 0, 1380, 2, 0}, {112, 2, 0, 0, 1382, 4, 0}, {1070, 5, 2, 1714, 1321, 3, 0}, {1066, 9, 0, 0, 1386, 3, 0},
+						{1104, 11, 0, 0, 1389, 3, 0}, {1115, 3, 1, 1716, 1392, 3, 0}, {290, 5, 0, 0, 847, 3, 0}, {1118, 9, 0, 0, 862, 3, 0},
+						{1127, 3, 2, 1717, 0, 0, 0}, {164, 2, 1, 1719, 1395, 2, 0}, {37, 1, 0, 0, 1397, 3, 0}, {30, 1, 0, 0, 931, 3, 0},
+						{43, 1, 3, 1720, 0, 0, 0}, {131, 3, 0, 0, 1400, 2, 0}, {50, 1, 0, 0, 1402, 2, 0}, {642, 4, 0, 0, 1404, 2, 0},
+						{50, 1, 0, 0, 1406, 2, 0}, {1130, 12, 0, 0, 1408, 3, 0}, {171, 2, 0, 0, 1411, 2, 0}, {4, 1, 0, 0, 1413, 5, 0},
+						{29, 1, 0, 0, 1418, 3, 0}, {131, 3, 0, 0, 1421, 2, 1}, {60, 3, 0, 0, 1423, 2, 1}, {50, 1, 0, 0, 1425, 2, 0},
+						{43, 1, 0, 0, 1427, 4, 0}, {30, 1, 2, 1723, 0, 0, 0}, {76, 3, 0, 0, 1431, 2, 0}, {26, 1, 2, 1725, 0, 0, 0},
+						{41, 1, 0, 0, 2, 1, 1}, {29, 1, 4, 1727, 1433, 3, 0}, {32, 1, 6, 1731, 1436, 3, 0}, {610, 3, 0, 0, 1439, 2, 0},
+						{112, 2, 0, 0, 1441, 4, 0}, {4, 1, 0, 0, 1445, 3, 0}, {1142, 4, 0, 0, 1448, 3, 0}, {30, 1, 0, 0, 1451, 3, 0},
+						{227, 2, 0, 0, 1454, 3, 0}, {139, 2, 0, 0, 1457, 1, 0}, {1146, 4, 1, 1737, 492, 3, 0}, {81, 2, 0, 0, 1458, 4, 0},
+						{45, 1, 0, 0, 1462, 1, 0}, {1150, 3, 1, 1738, 492, 3, 0}, {1153, 6, 0, 0, 1032, 3, 0}, {460, 3, 0, 0, 1463, 3, 0},
+						{617, 2, 4, 1739, 0, 0, 0}, {43, 1, 2, 1743, 0, 0, 0}, {379, 4, 0, 0, 1466, 3, 0}, {1159, 3, 0, 0, 1469, 3, 0},
+						{50, 1, 0, 0, 1472, 2, 0}, {624, 4, 1, 1745, 991, 3, 0}, {1162, 5, 0, 0, 1474, 3, 0}, {163, 3, 0, 0, 1477, 2, 0},
+						{629, 4, 0, 0, 41, 3, 0}, {45, 1, 3, 1746, 0, 0, 0}, {28, 1, 3, 1749, 0, 0, 0}, {40, 1, 3, 1752, 0, 0, 0},
+						{44, 1, 2, 1755, 0, 0, 0}, {1167, 8, 2, 1757, 0, 0, 0}, {1175, 5, 0, 0, 1479, 3, 0}, {593, 3, 0, 0, 931, 3, 0},
+						{596, 5, 0, 0, 414, 3, 0}, {26, 1, 2, 1759, 0, 0, 0}, {36, 1, 2, 1761, 0, 0, 0}, {707, 3, 0, 0, 1482, 3, 0},
+						{30, 1, 1, 1763, 1485, 4, 0}, {129, 2, 0, 0, 1489, 3, 0}, {112, 2, 0, 0, 1492, 4, 0}, {45, 1, 1, 1764, 1392, 3, 0},
+						{1180, 4, 0, 0, 1496, 3, 0}, {49, 1, 12, 1765, 0, 0, 0}, {65, 3, 0, 0, 39, 2, 0}, {517, 4, 0, 0, 1499, 2, 1},
+						{81, 2, 0, 0, 1501, 4, 0}, {1184, 3, 0, 0, 1505, 3, 0}, {394, 2, 1, 1777, 1508, 3, 0}, {548, 2, 2, 1778, 1511, 1, 0},
+						{174, 2, 1, 1780, 1512, 3, 0}, {118, 2, 2, 1781, 44, 3, 0}, {59, 4, 0, 0, 1515, 2, 0}, {41, 1, 5, 1783, 1517, 3, 0},
+						{43, 1, 2, 1788, 0, 0, 0}, {26, 1, 2, 1790, 0, 0, 0}, {646, 4, 0, 0, 1520, 2, 1}, {131, 3, 0, 0, 1522, 2, 0},
+						{1187, 3, 1, 1792, 1524, 3, 0}, {647, 3, 0, 0, 1010, 2, 1}, {1162, 5, 0, 0, 1527, 3, 0}, {161, 2, 1, 1793, 1530, 2, 1},
+						{109, 2, 0, 0, 1532, 2, 0}, {1190, 3, 1, 1794, 1534, 3, 0}, {34, 1, 0, 0, 1537, 2, 0}, {4, 1, 0, 0, 1539, 3, 0},
+						{28, 1, 2, 1795, 1542, 2, 0}, {30, 1, 0, 0, 1544, 3, 0}, {1193, 5, 0, 0, 1547, 3, 0}, {226, 3, 0, 0, 1550, 3, 0},
+						{1198, 4, 0, 0, 1553, 3, 0}, {1202, 3, 0, 0, 529, 3, 0}, {166, 3, 1, 1797, 1556, 1, 0}, {38, 1, 2, 1798, 0, 0, 0},
+						{39, 1, 2, 1800, 0, 0, 0}, {41, 1, 3, 1802, 0, 0, 0}, {274, 3, 0, 0, 1557, 3, 0}, {139, 3, 0, 0, 1560, 3, 0},
+						{81, 2, 0, 0, 1563, 4, 0}, {46, 1, 2, 1805, 0, 0, 0}, {1205, 4, 2, 1807, 0, 0, 0}, {30, 1, 2, 1809, 0, 0, 0},
+						{549, 4, 1, 1811, 1567, 3, 0}, {41, 1, 5, 1812, 1570, 3, 0}, {43, 1, 4, 1817, 0, 0, 0}, {593, 3, 0, 0, 1573, 3, 0},
+						{596, 3, 0, 0, 1576, 3, 0}, {1153, 6, 0, 0, 1026, 3, 0}, {460, 3, 0, 0, 1579, 3, 0}, {738, 4, 0, 0, 1582, 3, 0},
+						{1209, 4, 0, 0, 1585, 3, 0}, {275, 2, 0, 0, 1318, 3, 0}, {346, 2, 1, 1821, 1588, 3, 0}, {387, 5, 0, 0, 790, 3, 0},
+						{241, 3, 0, 0, 1591, 2, 0}, {642, 4, 0, 0, 1593, 2, 0}, {50, 1, 0, 0, 1595, 2, 0}, {26, 1, 2, 1822, 0, 0, 0},
+						{435, 5, 0, 0, 1597, 3, 0}, {32, 1, 0, 0, 1600, 2, 1}, {1213, 3, 0, 0, 1602, 2, 0}, {1162, 5, 0, 0, 1604, 3, 0},
+						{1216, 4, 0, 0, 1607, 3, 0}, {43, 1, 0, 0, 1610, 4, 0}, {37, 1, 0, 0, 1614, 3, 0}, {43, 1, 0, 0, 1617, 3, 0},
+						{78, 2, 2, 1824, 1620, 3, 0}, {30, 1, 0, 0, 1060, 2, 0}, {1220, 5, 0, 0, 1623, 2, 0}, {1009, 3, 0, 0, 1625, 3, 0},
+						{47, 1, 2, 1826, 1628, 2, 0}, {1225, 3, 0, 0, 1630, 3, 0}, {570, 3, 0, 0, 1633, 3, 0}, {1228, 4, 0, 0, 1636, 1, 0},
+						{112, 2, 0, 0, 1637, 4, 0}, {45, 1, 4, 1828, 1641, 2, 0}, {1232, 12, 0, 0, 1643, 3, 0}, {757, 2, 3, 1832, 0, 0, 0},
+						{1244, 6, 0, 0, 304, 3, 0}, {28, 1, 2, 1835, 0, 0, 0}, {28, 1, 2, 1837, 0, 0, 0}, {548, 2, 0, 0, 1646, 3, 0},
+						{759, 4, 0, 0, 1649, 2, 0}, {128, 3, 0, 0, 1651, 3, 0}, {97, 2, 1, 1839, 1654, 3, 0}, {274, 3, 0, 0, 1657, 3, 0},
+						{416, 3, 0, 0, 1660, 3, 0}, {109, 2, 0, 0, 1663, 2, 0}, {604, 6, 0, 0, 1665, 3, 0}, {341, 3, 0, 0, 1597, 3, 0},
+						{129, 2, 0, 0, 1668, 3, 0}, {59, 4, 0, 0, 1671, 2, 1}, {1250, 4, 0, 0, 1673, 3, 0}, {642, 4, 0, 0, 1676, 2, 0},
+						{131, 2, 1, 1840, 1678, 3, 0}, {1254, 4, 0, 0, 1681, 3, 0}, {50, 1, 0, 0, 1684, 2, 0}, {341, 3, 0, 0, 563, 3, 0},
+						{43, 1, 0, 0, 1686, 4, 0}, {71, 4, 0, 0, 1690, 2, 1}, {44, 1, 1, 1841, 1692, 3, 0}, {1258, 6, 0, 0, 1695, 3, 0},
+						{37, 1, 0, 0, 1698, 3, 0}, {44, 1, 1, 1842, 1701, 3, 0}, {80, 3, 0, 0, 1704, 2, 0}, {763, 3, 2, 1843, 1706, 3, 0},
+						{464, 2, 1, 1845, 1709, 3, 0}, {32, 1, 0, 0, 1712, 2, 0}, {464, 2, 0, 0, 1714, 3, 0}, {610, 3, 0, 0, 1717, 2, 0},
+						{112, 2, 0, 0, 1719, 4, 0}, {181, 2, 1, 1846, 1723, 3, 0}, {236, 3, 0, 0, 1726, 3, 0}, {164, 2, 2, 1847, 1729, 2, 0},
+						{28, 1, 2, 1849, 0, 0, 0}, {44, 1, 2, 1851, 0, 0, 0}, {46, 1, 3, 1853, 0, 0, 0}, {1264, 6, 0, 0, 1731, 3, 0},
+						{341, 3, 0, 0, 1734, 3, 0}, {274, 3, 0, 0, 1737, 3, 0}, {81, 2, 0, 0, 1740, 3, 0}, {128, 3, 0, 0, 1743, 3, 0},
+						{394, 2, 0, 0, 1746, 3, 0}, {26, 1, 0, 0, 1749, 2, 0}, {33, 1, 0, 0, 1751, 2, 1}, {107, 2, 0, 0, 1753, 2, 1},
+						{138, 2, 0, 0, 1755, 3, 0}, {133, 2, 0, 0, 1758, 1, 0}, {774, 3, 0, 0, 1094, 3, 0}, {41, 1, 2, 1856, 0, 0, 0},
+						{445, 4, 0, 0, 1759, 3, 0}, {37, 1, 2, 1858, 0, 0, 0}, {43, 1, 0, 0, 1762, 4, 0}, {184, 2, 0, 0, 1766, 3, 0},
+						{53, 3, 0, 0, 1769, 3, 0}, {1270, 3, 0, 0, 1772, 3, 0}, {112, 2, 0, 0, 1775, 4, 0}, {43, 1, 2, 1860, 0, 0, 0},
+						{26, 1, 2, 1862, 0, 0, 0}, {882, 3, 0, 0, 1779, 3, 0}, {37, 1, 0, 0, 1782, 3, 0}, {59, 4, 0, 0, 1785, 2, 0},
+						{179, 3, 1, 1864, 1787, 2, 0}, {41, 1, 0, 0, 1789, 3, 0}, {131, 3, 0, 0, 1792, 2, 0}, {50, 1, 0, 0, 1794, 2, 0},
+						{37, 1, 0, 0, 1796, 3, 0}, {42, 1, 2, 1865, 592, 3, 0}, {44, 1, 3, 1867, 1121, 3, 0}, {32, 1, 0, 0, 129, 3, 0},
+						{4, 1, 0, 0, 1799, 3, 0}, {26, 1, 0, 0, 1802, 3, 0}, {35, 1, 0, 0, 1805, 3, 0}, {4, 1, 0, 0, 1808, 3, 0},
+						{222, 2, 1, 1870, 1811, 3, 0}, {30, 1, 1, 1871, 1814, 3, 0}, {1273, 3, 0, 0, 1817, 3, 0}, {81, 2, 0, 0, 1820, 3, 0},
+						{394, 2, 2, 1872, 1124, 3, 0}, {28, 1, 2, 1874, 0, 0, 0}, {128, 3, 0, 0, 1823, 3, 0}, {1276, 4, 0, 0, 1826, 3, 0},
+						{469, 5, 0, 0, 1829, 3, 0}, {43, 1, 5, 1876, 0, 0, 0}, {1280, 7, 0, 0, 1832, 6, 0}, {1287, 2, 0, 0, 1832, 6, 0},
+						{1289, 4, 0, 0, 1838, 3, 0}, {1293, 2, 0, 0, 1841, 2, 0}, {1295, 4, 0, 0, 150, 3, 0}, {43, 1, 2, 1881, 0, 0, 0},
+						{1299, 4, 1, 1883, 1843, 3, 0}, {1303, 4, 0, 0, 1846, 3, 0}, {1307, 4, 0, 0, 1849, 3, 0}, {1311, 5, 0, 0, 1852, 3, 0},
+						{1316, 5, 0, 0, 1855, 3, 0}, {274, 3, 0, 0, 1858, 3, 0}, {1321, 4, 0, 0, 1861, 3, 0}, {386, 2, 2, 1884, 0, 0, 0},
+						{112, 2, 0, 0, 1864, 4, 0}, {1325, 4, 0, 0, 1868, 3, 0}, {81, 2, 0, 0, 1871, 4, 0}, {620, 4, 0, 0, 615, 3, 0},
+						{759, 4, 0, 0, 1875, 2, 0}, {1329, 4, 0, 0, 1877, 3, 0}, {1333, 4, 0, 0, 1588, 3, 0}, {131, 3, 0, 0, 1880, 2, 1},
+						{50, 1, 0, 0, 1882, 2, 0}, {109, 2, 0, 0, 1884, 2, 0}, {1337, 3, 0, 0, 1886, 2, 1}, {31, 1, 0, 0, 612, 3, 0},
+						{43, 1, 0, 0, 1888, 4, 0}, {34, 1, 2, 1886, 0, 0, 0}, {1340, 4, 0, 0, 1892, 3, 0}, {1344, 3, 0, 0, 1895, 3, 0},
+						{26, 1, 3, 1888, 0, 0, 0}, {454, 2, 0, 0, 1898, 3, 0}, {1347, 3, 0, 0, 1901, 2, 0}, {1012, 4, 0, 0, 1903, 3, 0},
+						{1341, 3, 1, 1891, 1906, 3, 0}, {1350, 4, 0, 0, 1909, 2, 0}, {45, 1, 4, 1892, 1911, 3, 0}, {109, 2, 0, 0, 1914, 2, 0},
+						{610, 3, 0, 0, 1916, 2, 0}, {112, 2, 0, 0, 1918, 4, 0}, {171, 2, 0, 0, 1922, 2, 0}, {81, 2, 0, 0, 1924, 4, 0},
+						{98, 2, 4, 1896, 98, 3, 0}, {102, 4, 0, 0, 1928, 2, 0}, {219, 3, 0, 0, 1930, 2, 0}, {107, 2, 0, 0, 1932, 2, 1},
+						{131, 3, 0, 0, 1934, 2, 0}, {50, 1, 0, 0, 1936, 2, 0}, {81, 2, 0, 0, 1938, 4, 0}, {901, 4, 0, 0, 1942, 2, 0},
+						{47, 1, 0, 0, 1944, 2, 0}, {646, 4, 0, 0, 1946, 2, 0}, {50, 1, 0, 0, 1948, 2, 0}, {274, 3, 0, 0, 1196, 3, 0},
+						{275, 2, 0, 0, 1950, 3, 0}, {171, 4, 0, 0, 1953, 3, 0}, {32, 1, 0, 0, 1956, 3, 0}, {59, 4, 0, 0, 1959, 2, 0},
+						{1354, 6, 0, 0, 1961, 3, 0}, {1360, 4, 0, 0, 1184, 3, 0}, {905, 4, 0, 0, 1964, 2, 0}, {99, 2, 2, 1900, 1966, 3, 0},
+						{41, 1, 0, 0, 1969, 3, 0}, {384, 3, 0, 0, 1972, 2, 1}, {275, 2, 7, 1902, 826, 3, 0}, {45, 1, 2, 1909, 1974, 3, 0},
+						{274, 3, 0, 0, 1977, 3, 0}, {380, 3, 0, 0, 1980, 3, 0}, {43, 1, 2, 1911, 0, 0, 0}, {642, 4, 0, 0, 1983, 2, 0},
+						{30, 1, 2, 1913, 0, 0, 0}, {398, 2, 0, 0, 1985, 1, 0}, {50, 1, 0, 0, 1986, 2, 0}, {624, 2, 0, 0, 1988, 3, 0},
+						{384, 3, 1, 1915, 1239, 3, 0}, {43, 1, 2, 1916, 0, 0, 0}, {346, 2, 0, 0, 1991, 3, 0}, {917, 2, 5, 1918, 0, 0, 0},
+						{32, 1, 0, 0, 1994, 3, 0}, {42, 1, 2, 1923, 685, 3, 0}, {44, 1, 4, 1925, 1997, 3, 0}, {1216, 4, 0, 0, 2000, 3, 0},
+						{1040, 4, 0, 0, 2003, 3, 0}, {43, 1, 0, 0, 2006, 4, 0}, {4, 1, 0, 0, 2010, 3, 0}, {181, 2, 2, 1929, 0, 0, 0},
+						{1364, 3, 0, 0, 2013, 3, 0}, {274, 3, 0, 0, 2016, 3, 0}, {1367, 6, 0, 0, 1630, 3, 0}, {1373, 4, 0, 0, 2019, 3, 0},
+						{284, 3, 0, 0, 2022, 3, 0}, {227, 4, 0, 0, 2025, 2, 0}, {527, 4, 1, 1931, 2027, 3, 0}, {4, 1, 0, 0, 2030, 3, 0},
+						{222, 2, 1, 1932, 2033, 3, 0}, {30, 1, 1, 1933, 2036, 3, 0}, {1273, 3, 0, 0, 2039, 3, 0}, {26, 1, 2, 1934, 0, 0, 0},
+						{380, 3, 0, 0, 2042, 3, 0}, {99, 2, 3, 1936, 0, 0, 0}, {1377, 7, 2, 1939, 0, 0, 0}, {41, 1, 3, 1941, 0, 0, 0},
+						{1384, 5, 0, 0, 2045, 3, 0}, {48, 1, 2, 1944, 0, 0, 0}, {51, 1, 2, 1946, 2048, 3, 0}, {562, 2, 0, 0, 2051, 3, 0},
+						{274, 3, 0, 0, 2054, 3, 0}, {1367, 6, 0, 0, 2057, 3, 0}, {416, 3, 1, 1948, 2060, 3, 0}, {38, 1, 0, 0, 2063, 3, 0},
+						{284, 3, 0, 0, 2066, 3, 0}, {1389, 4, 0, 0, 2069, 3, 0}, {81, 2, 0, 0, 2072, 4, 0}, {33, 1, 0, 0, 1203, 3, 0},
+						{394, 2, 2, 1949, 2076, 3, 0}, {42, 1, 2, 1951, 0, 0, 0}, {759, 4, 0, 0, 2079, 2, 0}, {28, 1, 2, 1953, 0, 0, 0},
+						{128, 3, 0, 0, 2081, 3, 0}, {1393, 4, 0, 0, 2084, 3, 0}, {668, 4, 0, 0, 2087, 3, 0}, {549, 4, 0, 0, 2090, 3, 0},
+						{469, 5, 0, 0, 2093, 3, 0}, {43, 1, 2, 1955, 0, 0, 0}, {1397, 5, 0, 0, 2096, 3, 0}, {541, 4, 0, 0, 2099, 3, 0},
+						{1280, 7, 0, 0, 2102, 6, 0}, {1287, 2, 0, 0, 2102, 6, 0}, {81, 2, 0, 0, 2108, 2, 1}, {37, 1, 2, 1957, 0, 0, 0},
+						{41, 1, 1, 1959, 2110, 3, 0}, {1402, 4, 0, 0, 2113, 3, 0}, {1406, 4, 0, 0, 2116, 3, 0}, {50, 1, 0, 0, 2119, 2, 0},
+						{984, 3, 0, 0, 2121, 2, 1}, {29, 1, 3, 1960, 2123, 3, 0}, {232, 3, 2, 1963, 2126, 3, 0}, {243, 2, 0, 0, 2129, 3, 0},
+						{534, 2, 0, 0, 1846, 3, 0}, {1410, 4, 0, 0, 2132, 3, 0}, {112, 2, 0, 0, 2135, 4, 0}, {81, 2, 0, 0, 2139, 4, 0},
+						{1414, 4, 0, 0, 485, 3, 0}, {1418, 6, 0, 0, 2143, 3, 0}, {587, 3, 0, 0, 2143, 3, 0}, {32, 1, 0, 0, 2146, 5, 0},
+						{45, 1, 1, 1965, 2151, 6, 0}, {919, 3, 2, 1966, 0, 0, 0}, {37, 1, 0, 0, 2157, 5, 0}, {45, 1, 1, 1968, 2162, 6, 0},
+						{344, 4, 0, 0, 2168, 3, 0}, {351, 4, 0, 0, 2171, 3, 0}, {240, 3, 0, 0, 77, 3, 0}, {59, 4, 0, 0, 2174, 2, 0},
+						{99, 2, 0, 0, 2176, 6, 0}, {41, 1, 4, 1969, 2182, 3, 0}, {1424, 3, 1, 1973, 2185, 3, 0}, {464, 2, 0, 0, 1221, 2, 1},
+						{117, 3, 1, 1974, 2188, 5, 0}, {26, 1, 2, 1975, 0, 0, 0}, {646, 4, 0, 0, 2193, 2, 0}, {1159, 3, 1, 1977, 2195, 3, 0},
+						{142, 2, 0, 0, 2198, 3, 0}, {50, 1, 0, 0, 2201, 2, 0}, {410, 3, 0, 0, 2203, 3, 0}, {181, 2, 2, 1978, 0, 0, 0},
+						{128, 3, 0, 0, 2206, 5, 0}, {1427, 4, 0, 0, 2211, 3, 0}, {44, 1, 2, 1980, 0, 0, 0}, {1431, 4, 1, 1982, 2214, 3, 0},
+						{4, 1, 0, 0, 2217, 5, 0}, {30, 1, 2, 1983, 2222, 3, 0}, {1273, 3, 0, 0, 2225, 3, 0}, {45, 1, 1, 1985, 2228, 3, 0},
+						{410, 3, 0, 0, 2231, 3, 0}, {274, 3, 0, 0, 2234, 3, 0}, {456, 3, 0, 0, 2237, 3, 0}, {44, 1, 1, 1986, 2240, 3, 0},
+						{47, 1, 0, 0, 725, 3, 0}, {410, 3, 0, 0, 2243, 3, 0}, {4, 1, 0, 0, 2246, 5, 0}, {274, 3, 0, 0, 2251, 3, 0},
+						{534, 2, 0, 0, 2254, 3, 0}, {30, 1, 3, 1987, 2257, 3, 0}, {1273, 3, 0, 0, 2260, 3, 0}, {45, 1, 1, 1990, 2263, 3, 0},
+						{112, 2, 0, 0, 2266, 4, 0}, {45, 1, 2, 1991, 2270, 2, 1}, {181, 2, 3, 1993, 2272, 3, 0}, {1435, 5, 0, 0, 2275, 3, 0},
+						{43, 1, 2, 1996, 2278, 3, 0}, {410, 3, 0, 0, 712, 3, 0}, {274, 3, 2, 1998, 2281, 3, 0}, {286, 9, 0, 0, 2281, 3, 0},
+						{284, 3, 1, 2000, 2284, 3, 0}, {28, 1, 3, 2001, 2287, 3, 0}, {310, 4, 2, 2004, 0, 0, 0}, {394, 2, 1, 2006, 2290, 3, 0},
+						{226, 3, 0, 0, 730, 3, 0}, {456, 3, 0, 0, 2272, 3, 0}, {1440, 3, 2, 2007, 0, 0, 0}, {46, 1, 3, 2009, 0, 0, 0},
+						{425, 2, 0, 0, 2293, 3, 0}, {102, 4, 0, 0, 2296, 2, 1}, {1443, 2, 0, 0, 2298, 3, 0}, {1168, 7, 2, 2012, 0, 0, 0},
+						{38, 1, 2, 2014, 2301, 1, 0}, {344, 4, 0, 0, 2302, 3, 0}, {1445, 4, 0, 0, 2305, 3, 0}, {222, 2, 0, 0, 2308, 6, 0},
+						{351, 4, 0, 0, 2314, 3, 0}, {32, 1, 2, 2016, 0, 0, 0}, {1449, 5, 0, 0, 2317, 3, 0}, {37, 1, 3, 2018, 0, 0, 0},
+						{43, 1, 2, 2021, 0, 0, 0}, {1273, 3, 0, 0, 2320, 6, 0}, {410, 3, 0, 0, 2326, 3, 0}, {181, 2, 2, 2023, 0, 0, 0},
+						{1310, 4, 0, 0, 2329, 3, 0}, {59, 4, 0, 0, 2332, 2, 1}, {44, 2, 0, 0, 2334, 3, 0}, {131, 2, 1, 2025, 2337, 3, 0},
+						{50, 1, 0, 0, 2340, 2, 0}, {345, 3, 0, 0, 2342, 3, 0}, {240, 4, 0, 0, 2345, 2, 0}, {949, 2, 0, 0, 2347, 3, 0},
+						{129, 2, 0, 0, 1014, 3, 0}, {1454, 4, 0, 0, 2350, 3, 0}, {193, 3, 0, 0, 2353, 3, 0}, {43, 1, 0, 0, 2356, 4, 0},
+						{95, 2, 0, 0, 2360, 2, 0}, {71, 4, 0, 0, 2362, 2, 1}, {45, 1, 0, 0, 2364, 3, 0}, {348, 3, 0, 0, 2367, 3, 0},
+						{38, 1, 0, 0, 1235, 2, 0}, {274, 3, 0, 0, 2370, 3, 0}, {28, 1, 2, 2026, 0, 0, 0}, {878, 3, 0, 0, 2373, 3, 0},
+						{45, 1, 0, 0, 2376, 3, 0}, {80, 3, 0, 0, 2379, 2, 0}, {980, 3, 0, 0, 2381, 2, 0}, {34, 1, 3, 2028, 0, 0, 0},
+						{181, 2, 0, 0, 2383, 3, 0}, {1458, 3, 0, 0, 2386, 3, 0}, {236, 3, 0, 0, 1020, 3, 0}, {274, 3, 0, 0, 2389, 3, 0},
+						{29, 1, 3, 2031, 2392, 3, 0}, {1461, 4, 0, 0, 2395, 3, 0}, {137, 2, 0, 0, 2398, 3, 0}, {1465, 5, 0, 0, 2401, 3, 0},
+						{47, 1, 0, 0, 2404, 3, 0}, {81, 2, 0, 0, 2407, 3, 0}, {620, 4, 0, 0, 2410, 2, 1}, {548, 2, 0, 0, 2412, 3, 0},
+						{103, 3, 0, 0, 2415, 2, 1}, {669, 3, 1, 2034, 1023, 3, 0}, {26, 1, 1, 2035, 2417, 2, 1}, {44, 1, 2, 2036, 0, 0, 0},
+						{45, 1, 0, 0, 274, 3, 0}, {1470, 3, 0, 0, 2419, 1, 0}, {1473, 3, 0, 0, 2420, 1, 0}, {1295, 3, 0, 0, 2421, 3, 0},
+						{41, 1, 0, 0, 1392, 3, 0}, {1476, 4, 0, 0, 2424, 3, 0}, {34, 1, 1, 2038, 2427, 2, 0}, {1480, 4, 0, 0, 232, 3, 0},
+						{644, 3, 0, 0, 2429, 3, 0}, {1484, 7, 0, 0, 2432, 3, 0}, {47, 1, 0, 0, 2435, 2, 0}, {423, 2, 2, 2039, 0, 0, 0},
+						{233, 2, 8, 2041, 2437, 1, 0}, {1491, 6, 0, 0, 2438, 3, 0}, {112, 2, 0, 0, 2441, 4, 0}, {1052, 3, 0, 0, 2445, 2, 1},
+						{4, 1, 0, 0, 2447, 3, 0}, {222, 2, 0, 0, 2450, 3, 0}, {1497, 3, 0, 0, 2453, 3, 0}, {30, 1, 1, 2049, 2456, 3, 0},
+						{394, 3, 1, 2050, 2459, 3, 0}, {39, 1, 3, 2051, 0, 0, 0}, {40, 1, 3, 2054, 0, 0, 0}, {1273, 3, 0, 0, 2462, 3, 0},
+						{1500, 4, 0, 0, 2465, 3, 0}, {81, 2, 0, 0, 2468, 4, 0}, {34, 1, 0, 0, 2472, 2, 0}, {184, 2, 2, 2057, 0, 0, 0},
+						{471, 3, 1, 2059, 2474, 1, 0}, {129, 2, 0, 0, 292, 1, 1}, {274, 3, 0, 0, 314, 3, 0}, {275, 2, 0, 0, 1145, 3, 0},
+						{171, 4, 0, 0, 2475, 3, 0}, {28, 1, 2, 2060, 0, 0, 0}, {1504, 3, 0, 0, 1324, 3, 0}, {1354, 6, 0, 0, 2478, 3, 0},
+						{99, 2, 3, 2062, 2481, 3, 0}, {384, 3, 0, 0, 2484, 2, 1}, {275, 2, 10, 2065, 829, 3, 0}, {45, 1, 2, 2075, 0, 0, 0},
+						{274, 3, 0, 0, 514, 3, 0}, {380, 3, 0, 0, 2486, 3, 0}, {43, 1, 2, 2077, 0, 0, 0}, {642, 4, 0, 0, 2489, 2, 0},
+						{30, 1, 2, 2079, 0, 0, 0}, {398, 2, 0, 0, 2491, 1, 0}, {50, 1, 0, 0, 2492, 2, 0}, {624, 2, 0, 0, 2494, 3, 0},
+						{1507, 5, 0, 0, 2497, 3, 0}, {384, 3, 1, 2081, 2500, 3, 0}, {346, 2, 0, 0, 2503, 3, 0}, {259, 2, 3, 2082, 309, 3, 0},
+						{92, 2, 0, 0, 2506, 3, 0}, {32, 1, 0, 0, 307, 2, 1}, {1216, 4, 0, 0, 2509, 3, 0}, {1040, 4, 0, 0, 1288, 3, 0},
+						{43, 1, 0, 0, 2512, 4, 0}, {181, 2, 2, 2085, 0, 0, 0}, {40, 1, 1, 2087, 2516, 2, 0}, {282, 3, 6, 2088, 0, 0, 0},
+						{99, 2, 0, 0, 2518, 2, 0}, {1512, 10, 0, 0, 1734, 3, 0}, {274, 3, 0, 0, 2520, 3, 0}, {416, 3, 0, 0, 1085, 3, 0},
+						{38, 1, 0, 0, 2523, 3, 0}, {1522, 4, 0, 0, 796, 3, 0}, {26, 1, 2, 2094, 0, 0, 0}, {380, 3, 0, 0, 2526, 3, 0},
+						{41, 1, 3, 2096, 0, 0, 0}, {1384, 5, 0, 0, 2529, 3, 0}, {181, 2, 1, 2099, 2532, 1, 0}, {1526, 6, 0, 0, 2533, 3, 0},
+						{1389, 4, 0, 0, 2536, 3, 0}, {81, 2, 0, 0, 2539, 4, 0}, {33, 1, 0, 0, 1303, 3, 0}, {42, 1, 2, 2100, 0, 0, 0},
+						{1393, 4, 0, 0, 2543, 3, 0}, {668, 4, 0, 0, 2546, 3, 0}, {97, 2, 3, 2102, 2549, 3, 0}, {4, 1, 0, 0, 2552, 3, 0},
+						{26, 1, 2, 2105, 0, 0, 0}, {1497, 3, 0, 0, 2555, 3, 0}, {30, 1, 1, 2107, 2558, 3, 0}, {131, 3, 0, 0, 2561, 2, 0},
+						{39, 1, 3, 2108, 0, 0, 0}, {1526, 6, 0, 0, 2563, 3, 0}, {1273, 3, 0, 0, 2566, 3, 0}, {50, 1, 0, 0, 2569, 2, 0},
+						{27, 1, 0, 0, 2571, 3, 0}, {30, 1, 0, 0, 2574, 3, 0}, {410, 3, 0, 0, 2577, 3, 0}, {181, 2, 2, 2111, 0, 0, 0},
+						{92, 2, 0, 0, 2580, 2, 1}, {226, 2, 0, 0, 2582, 1, 0}, {1532, 4, 0, 0, 2583, 3, 0}, {473, 2, 2, 2113, 0, 0, 0},
+						{1536, 2, 0, 0, 2586, 3, 0}, {882, 3, 0, 0, 1779, 3, 0}, {1538, 3, 0, 0, 2589, 3, 0}, {28, 1, 2, 2115, 0, 0, 0},
+						{311, 3, 2, 2117, 0, 0, 0}, {50, 1, 0, 0, 2592, 2, 1}, {315, 3, 2, 2119, 2594, 2, 0}, {38, 1, 7, 2121, 356, 3, 0},
+						{26, 1, 2, 2128, 0, 0, 0}, {1541, 6, 0, 0, 2596, 3, 0}, {34, 1, 2, 2130, 0, 0, 0}, {45, 1, 1, 2132, 2599, 3, 0},
+						{1547, 4, 0, 0, 2602, 2, 0}, {37, 1, 1, 2133, 2604, 1, 0}, {112, 2, 0, 0, 2605, 4, 0}, {1024, 3, 1, 2134, 2609, 3, 0},
+						{43, 1, 0, 0, 755, 3, 0}, {28, 1, 2, 2135, 0, 0, 0}, {141, 2, 2, 2137, 0, 0, 0}, {46, 1, 2, 2139, 1327, 3, 0},
+						{81, 2, 0, 0, 2612, 4, 0}, {1551, 4, 0, 0, 988, 3, 0}, {1555, 4, 0, 0, 2616, 3, 0}, {1559, 4, 0, 0, 344, 3, 0},
+						{181, 2, 1, 2141, 2619, 3, 0}, {43, 1, 2, 2142, 0, 0, 0}, {27, 1, 8, 2144, 2622, 3, 0}, {1563, 2, 5, 2152, 816, 3, 0},
+						{38, 1, 0, 0, 1333, 3, 0}, {99, 2, 0, 0, 2625, 3, 0}, {41, 1, 12, 2157, 2628, 3, 0}, {410, 3, 0, 0, 2631, 3, 0},
+						{181, 2, 2, 2169, 0, 0, 0}, {1565, 4, 0, 0, 2634, 3, 0}, {1569, 4, 0, 0, 2637, 3, 0}, {46, 1, 0, 0, 2640, 2, 0},
+						{642, 4, 0, 0, 2642, 2, 0}, {646, 4, 0, 0, 2644, 2, 0}, {50, 1, 0, 0, 2646, 2, 0}, {30, 1, 2, 2171, 0, 0, 0},
+						{34, 1, 2, 2173, 0, 0, 0}, {36, 1, 2, 2175, 0, 0, 0}, {1225, 3, 0, 0, 2648, 2, 1}, {103, 3, 0, 0, 2650, 2, 0},
+						{669, 3, 2, 2177, 2652, 2, 1}, {161, 2, 0, 0, 2654, 3, 0}, {183, 2, 0, 0, 2657, 3, 0}, {41, 1, 3, 2179, 2660, 3, 0},
+						{641, 2, 0, 0, 2583, 3, 0}, {1409, 3, 0, 0, 349, 3, 0}, {34, 1, 7, 2182, 0, 0, 0}, {1573, 6, 0, 0, 2663, 3, 0},
+						{28, 1, 2, 2189, 0, 0, 0}, {483, 3, 0, 0, 2666, 2, 0}, {759, 4, 0, 0, 2668, 2, 0}, {1579, 3, 0, 0, 2670, 3, 0},
+						{1582, 5, 2, 2191, 0, 0, 0}, {59, 4, 0, 0, 2673, 2, 1}, {275, 2, 0, 0, 1321, 3, 0}, {109, 2, 0, 0, 2675, 2, 0},
+						{65, 3, 0, 0, 2677, 2, 0}, {131, 3, 0, 0, 2679, 2, 1}, {50, 1, 0, 0, 2681, 2, 0}, {274, 3, 0, 0, 2683, 3, 0},
+						{240, 4, 0, 0, 2686, 2, 0}, {416, 3, 0, 0, 1389, 3, 0}, {1216, 4, 0, 0, 2688, 3, 0}, {43, 1, 0, 0, 2691, 4, 0},
+						{181, 2, 2, 2193, 0, 0, 0}, {1364, 3, 0, 0, 2695, 3, 0}, {28, 1, 2, 2195, 0, 0, 0}, {284, 3, 0, 0, 2698, 3, 0},
+						{80, 3, 0, 0, 2701, 2, 0}, {37, 1, 0, 0, 1060, 2, 1}, {610, 3, 0, 0, 2703, 2, 0}, {112, 2, 0, 0, 2705, 4, 0},
+						{290, 5, 0, 0, 1321, 3, 0}, {1118, 9, 0, 0, 1386, 3, 0}, {1587, 7, 2, 2197, 0, 0, 0}, {236, 3, 0, 0, 2709, 3, 0},
+						{164, 2, 2, 2199, 2712, 2, 0}, {1594, 8, 0, 0, 2714, 3, 0}, {28, 1, 2, 2201, 0, 0, 0}, {98, 3, 0, 0, 2717, 2, 0},
+						{284, 3, 0, 0, 2719, 3, 0}, {128, 3, 0, 0, 2722, 3, 0}, {102, 4, 0, 0, 2725, 2, 0}, {97, 2, 1, 2203, 2727, 3, 0},
+						{274, 3, 0, 0, 2714, 3, 0}, {107, 2, 0, 0, 2730, 2, 1}, {47, 1, 0, 0, 2732, 3, 0}, {1602, 4, 0, 0, 2735, 3, 0},
+						{43, 1, 7, 2204, 0, 0, 0}, {30, 1, 2, 2211, 747, 3, 0}, {1303, 4, 0, 0, 2738, 3, 0}, {43, 1, 2, 2213, 0, 0, 0},
+						{27, 1, 0, 0, 2741, 6, 0}, {41, 1, 0, 0, 2747, 6, 0}, {81, 2, 0, 0, 2753, 4, 0}, {46, 1, 2, 2215, 0, 0, 0},
+						{29, 1, 2, 2217, 0, 0, 0}, {1606, 4, 0, 0, 906, 3, 0}, {1610, 4, 0, 0, 909, 3, 0}, {222, 2, 0, 0, 2757, 3, 0},
+						{131, 3, 0, 0, 2760, 3, 0}, {142, 2, 0, 0, 1377, 3, 0}, {410, 3, 0, 0, 2763, 3, 0}, {274, 3, 0, 0, 2766, 3, 0},
+						{410, 3, 0, 0, 2769, 3, 0}, {274, 3, 0, 0, 2772, 3, 0}, {128, 3, 0, 0, 2775, 3, 0}, {41, 1, 2, 2219, 0, 0, 0},
+						{1384, 4, 0, 0, 2778, 3, 0}, {410, 3, 0, 0, 2781, 3, 0}, {274, 3, 0, 0, 2784, 3, 0}, {81, 2, 0, 0, 2787, 4, 0},
+						{1614, 4, 0, 0, 2791, 3, 0}, {503, 4, 0, 0, 1479, 3, 0}, {284, 3, 0, 0, 2794, 3, 0}, {60, 3, 0, 0, 2797, 2, 1},
+						{50, 1, 0, 0, 2799, 2, 0}, {131, 3, 0, 0, 2801, 2, 0}, {50, 1, 0, 0, 2803, 2, 0}, {109, 2, 0, 0, 2805, 2, 0},
+						{107, 2, 0, 0, 2807, 2, 1}, {642, 4, 0, 0, 2809, 2, 0}, {50, 1, 0, 0, 2811, 2, 0}, {913, 4, 0, 0, 471, 3, 0},
+						{171, 2, 0, 0, 2813, 2, 0}, {35, 1, 0, 0, 2815, 3, 0}, {1618, 2, 0, 0, 2818, 3, 0}, {47, 1, 0, 0, 2821, 3, 0},
+						{596, 3, 0, 0, 1643, 3, 0}, {1620, 17, 0, 0, 68, 3, 0}, {988, 11, 0, 0, 2500, 3, 0}, {994, 5, 0, 0, 2824, 3, 0},
+						{30, 1, 0, 0, 2827, 3, 0}, {1637, 6, 0, 0, 2830, 3, 0}, {460, 3, 0, 0, 2833, 3, 0}, {681, 12, 0, 0, 740, 3, 0},
+						{31, 1, 0, 0, 2836, 3, 0}, {1643, 6, 0, 0, 2839, 3, 0}, {1649, 8, 4, 2221, 0, 0, 0}, {1657, 4, 0, 0, 1620, 3, 0},
+						{341, 3, 0, 0, 2842, 3, 0}, {826, 5, 0, 0, 1743, 3, 0}, {678, 15, 0, 0, 2833, 3, 0}, {341, 2, 2, 2225, 0, 0, 0},
+						{11, 1, 2, 2227, 0, 0, 0}, {507, 5, 2, 2229, 0, 0, 0}, {1044, 2, 2, 2231, 0, 0, 0}, {1661, 11, 0, 0, 755, 3, 0},
+						{1070, 5, 2, 2233, 1318, 3, 0}, {1672, 5, 0, 0, 2845, 2, 0}, {1075, 4, 3, 2235, 0, 0, 0}, {507, 5, 2, 2238, 0, 0, 0},
+						{1115, 3, 1, 2240, 2660, 3, 0}, {290, 5, 0, 0, 538, 3, 0}, {788, 11, 0, 0, 2847, 3, 0}, {799, 15, 0, 0, 2850, 3, 0},
+						{861, 5, 0, 0, 1746, 3, 0}, {847, 4, 0, 0, 1796, 3, 0}, {81, 2, 0, 0, 2853, 2, 0}, {1677, 7, 0, 0, 631, 3, 0},
+						{30, 1, 2, 2241, 0, 0, 0}, {1684, 5, 0, 0, 626, 3, 0}, {667, 5, 0, 0, 641, 3, 0}, {0, 1, 2, 2243, 0, 0, 0},
+						{1032, 7, 0, 0, 2855, 3, 0}, {341, 2, 2, 2245, 0, 0, 0}, {1039, 5, 0, 0, 2003, 3, 0}, {507, 5, 2, 2247, 0, 0, 0},
+						{19, 1, 2, 2249, 0, 0, 0}, {1044, 2, 3, 2251, 0, 0, 0}, {1046, 6, 1, 2254, 2858, 3, 0}, {290, 5, 0, 0, 1950, 3, 0},
+						{285, 10, 0, 0, 612, 3, 0}, {835, 12, 0, 0, 1994, 3, 0}, {831, 9, 0, 0, 679, 3, 0}, {840, 7, 0, 0, 688, 3, 0},
+						{847, 4, 0, 0, 2861, 3, 0}, {851, 10, 0, 0, 1997, 3, 0}, {861, 5, 0, 0, 2076, 3, 0}, {1075, 4, 2, 2255, 0, 0, 0},
+						{1084, 10, 0, 0, 2784, 3, 0}, {1689, 4, 2, 2257, 0, 0, 0}, {285, 10, 0, 0, 2781, 3, 0}, {1075, 9, 0, 0, 2864, 3, 0},
+						{1084, 10, 0, 0, 2867, 3, 0}, {1693, 11, 0, 0, 1408, 3, 0}, {1704, 3, 2, 2259, 0, 0, 0}, {1707, 13, 0, 0, 1408, 3, 0},
+						{1720, 14, 0, 0, 140, 3, 0}, {1734, 8, 0, 0, 213, 3, 0}, {2, 1, 2, 2261, 0, 0, 0}, {1742, 17, 0, 0, 2272, 3, 0},
+						{4, 1, 3, 2263, 0, 0, 0}, {840, 7, 6, 2266, 2228, 3, 0}, {885, 4, 2, 2272, 0, 0, 0}, {847, 2, 2, 2274, 0, 0, 0},
+						{1759, 6, 2, 2276, 0, 0, 0}, {1765, 8, 2, 2278, 2278, 3, 0}, {17, 1, 2, 2280, 0, 0, 0}, {18, 1, 2, 2282, 0, 0, 0},
+						{861, 5, 3, 2284, 2290, 3, 0}, {1661, 11, 0, 0, 730, 3, 0}, {181, 2, 0, 0, 2373, 3, 0}, {1773, 3, 2, 2287, 0, 0, 0},
+						{826, 5, 0, 0, 2456, 3, 0}, {851, 10, 0, 0, 2453, 3, 0}, {861, 5, 0, 0, 2462, 3, 0}, {1645, 4, 0, 0, 2870, 3, 0},
+						{1776, 7, 1, 2289, 1029, 3, 0}, {1783, 2, 0, 0, 2873, 3, 0}, {4, 1, 2, 2290, 0, 0, 0}, {1785, 13, 0, 0, 1660, 3, 0},
+						{1798, 11, 0, 0, 2481, 3, 0}, {291, 4, 2, 2292, 829, 3, 0}, {1809, 11, 0, 0, 2526, 3, 0}, {757, 2, 2, 2294, 0, 0, 0},
+						{480, 2, 2, 2296, 873, 3, 0}, {1168, 7, 2, 2298, 890, 3, 0}, {1820, 10, 0, 0, 2876, 3, 0}, {1830, 9, 0, 0, 2879, 3, 0},
+						{1046, 6, 1, 2300, 2882, 3, 0}, {273, 3, 0, 0, 2885, 3, 0}, {1839, 12, 0, 0, 2888, 3, 0}, {1851, 2, 2, 2301, 0, 0, 0},
+						{1853, 5, 0, 0, 2891, 3, 0}, {1858, 3, 1, 2303, 1330, 3, 0}, {1861, 5, 3, 2304, 816, 3, 0}, {1866, 5, 0, 0, 725, 3, 0},
+						{1871, 5, 1, 2307, 2628, 3, 0}, {1858, 3, 0, 0, 1336, 3, 0}, {1876, 6, 0, 0, 2894, 3, 0}, {171, 2, 0, 0, 2897, 2, 0},
+						{1882, 7, 0, 0, 2899, 6, 0}, {1714, 6, 0, 0, 2905, 3, 0}, {1889, 4, 0, 0, 2908, 3, 0}, {1, 1, 2, 2308, 0, 0, 0},
+						{999, 11, 0, 0, 2911, 3, 0}, {235, 4, 0, 0, 2709, 3, 0}, {273, 3, 0, 0, 2914, 3, 0}, {1066, 9, 0, 0, 2683, 3, 0},
+						{1070, 5, 0, 0, 2917, 3, 0}, {1075, 9, 0, 0, 2920, 3, 0}, {1084, 10, 0, 0, 2923, 3, 0}, {166, 3, 0, 0, 2926, 2, 0},
+						{348, 3, 0, 0, 2928, 3, 0}, {45, 1, 1, 2310, 2928, 3, 0}, {1710, 10, 0, 0, 1838, 3, 0}, {1893, 4, 0, 0, 2931, 3, 0},
+						{76, 2, 0, 0, 2931, 3, 0}, {81, 2, 0, 0, 2934, 2, 0}, {1443, 2, 0, 0, 2936, 3, 0}, {1897, 3, 0, 0, 2939, 3, 0},
+						{29, 1, 0, 0, 2942, 3, 0}, {1465, 5, 0, 0, 2945, 3, 0}, {47, 1, 0, 0, 2948, 3, 0}, {30, 1, 0, 0, 2951, 3, 0},
+						{134, 2, 0, 0, 1436, 3, 0}, {1900, 3, 1, 2311, 700, 3, 0}, {201, 2, 1, 2312, 2954, 3, 0}, {44, 1, 2, 2313, 0, 0, 0},
+						{1903, 4, 0, 0, 2957, 3, 0}, {120, 2, 0, 0, 1451, 3, 0}, {120, 2, 0, 0, 1035, 3, 0}, {1907, 4, 0, 0, 1469, 3, 0},
+						{1911, 7, 0, 0, 1477, 2, 0}, {392, 5, 0, 0, 517, 3, 0}, {1273, 3, 1, 2315, 1508, 3, 0}, {593, 3, 0, 0, 2960, 3, 0},
+						{596, 3, 1, 2316, 2963, 3, 0}, {30, 1, 0, 0, 991, 3, 0}, {26, 1, 0, 0, 2966, 2, 0}, {33, 1, 0, 0, 2968, 3, 0},
+						{1918, 4, 0, 0, 2670, 3, 0}, {222, 2, 0, 0, 2757, 3, 0}, {131, 3, 0, 0, 2760, 3, 0}, {142, 2, 0, 0, 1377, 3, 0},
+						{128, 3, 0, 0, 2775, 3, 0}, {503, 4, 0, 0, 2971, 3, 0}, {1384, 5, 0, 0, 2778, 3, 0}, {1614, 4, 0, 0, 2791, 3, 0},
+						{289, 3, 0, 0, 2974, 3, 0}, {1118, 4, 0, 0, 916, 3, 0}, {142, 2, 0, 0, 2794, 3, 0}, {617, 2, 3, 2317, 0, 0, 0},
+						{1478, 2, 0, 0, 2977, 3, 0}, {1922, 1, 2, 2320, 0, 0, 0}, {1923, 2, 0, 0, 2980, 3, 0}, {1427, 4, 0, 0, 2983, 6, 0},
+						{1925, 3, 0, 0, 1392, 3, 0}, {3, 1, 4, 2322, 0, 0, 0}, {7, 1, 4, 2326, 2989, 3, 0}, {20, 1, 4, 2330, 0, 0, 0},
+						{21, 1, 6, 2334, 2992, 3, 0}, {1928, 3, 0, 0, 2995, 3, 0}, {29, 1, 4, 2340, 0, 0, 0}, {33, 1, 4, 2344, 1133, 3, 0},
+						{1931, 5, 0, 0, 2998, 3, 0}, {503, 4, 0, 0, 3001, 3, 0}, {1384, 5, 0, 0, 3004, 3, 0}, {46, 1, 4, 2348, 0, 0, 0},
+						{47, 1, 6, 2352, 3007, 3, 0}, {30, 1, 0, 0, 3010, 3, 0}, {27, 1, 0, 0, 3013, 3, 0}, {1936, 4, 0, 0, 3016, 3, 0},
+						{913, 2, 0, 0, 1512, 3, 0}, {4, 1, 0, 0, 3019, 3, 0}, {30, 1, 1, 2358, 1138, 3, 0}, {1897, 3, 0, 0, 3022, 3, 0},
+						{1940, 5, 0, 0, 3025, 3, 0}, {28, 1, 2, 2359, 0, 0, 0}, {128, 3, 0, 0, 3028, 3, 0}, {44, 1, 0, 0, 3031, 6, 0},
+						{913, 2, 0, 0, 3037, 3, 0}, {95, 2, 0, 0, 1127, 2, 0}, {163, 2, 0, 0, 3040, 3, 0}, {643, 3, 0, 0, 3043, 2, 0},
+						{1945, 2, 0, 0, 3045, 3, 0}, {1947, 5, 0, 0, 1012, 2, 0}, {1952, 4, 0, 0, 1534, 3, 0}, {120, 2, 0, 0, 1544, 3, 0},
+						{134, 2, 2, 2361, 0, 0, 0}, {30, 1, 1, 2363, 985, 3, 0}, {79, 2, 1, 2364, 3048, 1, 0}, {41, 1, 2, 2365, 3049, 3, 0},
+						{32, 1, 1, 2367, 1355, 3, 0}, {460, 3, 0, 0, 740, 3, 0}, {31, 1, 0, 0, 3052, 4, 0}, {466, 3, 0, 0, 2839, 3, 0},
+						{50, 1, 1, 2368, 49, 2, 1}, {27, 1, 1, 2369, 3056, 3, 0}, {41, 1, 1, 2370, 3059, 3, 0}, {37, 1, 0, 0, 3062, 3, 0},
+						{43, 1, 0, 0, 3065, 3, 0}, {392, 2, 0, 0, 3068, 3, 0}, {114, 2, 0, 0, 3071, 3, 0}, {41, 1, 0, 0, 3074, 3, 0},
+						{1956, 5, 0, 0, 3077, 3, 0}, {28, 1, 2, 2371, 0, 0, 0}, {128, 3, 0, 0, 3080, 3, 0}, {137, 2, 0, 0, 3083, 3, 0},
+						{44, 1, 0, 0, 3086, 6, 0}, {274, 3, 1, 2373, 3092, 3, 0}, {87, 2, 3, 2374, 0, 0, 0}, {745, 3, 0, 0, 3095, 2, 1},
+						{1961, 7, 2, 2377, 0, 0, 0}, {47, 1, 0, 0, 3097, 3, 0}, {738, 4, 0, 0, 1041, 3, 0}, {275, 2, 0, 0, 3100, 3, 0},
+						{1658, 3, 1, 2379, 1620, 3, 0}, {44, 1, 0, 0, 3103, 3, 0}, {1968, 3, 1, 2380, 1628, 2, 1}, {1971, 3, 0, 0, 3106, 3, 0},
+						{120, 2, 1, 2381, 1743, 3, 0}, {1931, 5, 0, 0, 3109, 3, 0}, {503, 4, 0, 0, 3112, 3, 0}, {1974, 6, 0, 0, 2571, 3, 0},
+						{290, 5, 0, 0, 1318, 3, 0}, {1980, 10, 0, 0, 3100, 3, 0}, {1587, 7, 2, 2382, 0, 0, 0}, {1225, 3, 0, 0, 2057, 3, 0},
+						{570, 3, 0, 0, 3115, 3, 0}, {43, 1, 0, 0, 3118, 4, 0}, {50, 1, 0, 0, 3122, 2, 0}, {31, 1, 0, 0, 3124, 3, 0},
+						{28, 1, 0, 0, 3127, 2, 1}, {128, 3, 0, 0, 3129, 3, 0}, {128, 3, 0, 0, 3132, 3, 0}, {1858, 3, 0, 0, 1706, 3, 0},
+						{47, 1, 0, 0, 1706, 3, 0}, {1922, 1, 2, 2384, 0, 0, 0}, {619, 2, 0, 0, 3135, 3, 0}, {166, 3, 0, 0, 1729, 2, 0},
+						{47, 1, 0, 0, 3138, 2, 0}, {131, 3, 0, 0, 1678, 3, 0}, {1254, 4, 0, 0, 1681, 3, 0}, {394, 2, 0, 0, 1746, 3, 0},
+						{658, 4, 2, 2386, 0, 0, 0}, {691, 3, 0, 0, 1485, 1, 0}, {471, 3, 0, 0, 3140, 3, 0}, {949, 2, 1, 2388, 2830, 3, 0},
+						{1990, 8, 0, 0, 1088, 3, 0}, {1998, 9, 0, 0, 554, 3, 0}, {54, 2, 0, 0, 3143, 3, 0}, {53, 3, 0, 0, 3146, 3, 0},
+						{319, 3, 0, 0, 1107, 3, 0}, {36, 1, 1, 2389, 2432, 3, 0}, {28, 1, 6, 2390, 0, 0, 0}, {619, 2, 0, 0, 3149, 3, 0},
+						{29, 1, 0, 0, 1623, 2, 0}, {42, 1, 0, 0, 585, 3, 0}, {2007, 5, 0, 0, 1121, 3, 0}, {1563, 2, 0, 0, 3152, 3, 0},
+						{128, 3, 1, 2396, 3155, 3, 0}, {37, 1, 1, 2397, 3158, 6, 0}, {1146, 4, 0, 0, 1811, 3, 0}, {42, 1, 1, 2398, 1814, 3, 0},
+						{30, 1, 0, 0, 3164, 3, 0}, {37, 1, 0, 0, 3167, 3, 0}, {28, 1, 0, 0, 3170, 3, 0}, {131, 2, 0, 0, 3173, 3, 0},
+						{26, 1, 2, 2399, 0, 0, 0}, {128, 3, 0, 0, 1823, 3, 0}, {120, 2, 2, 2401, 0, 0, 0}, {2012, 4, 0, 0, 604, 3, 0},
+						{1273, 3, 0, 0, 1124, 3, 0}, {2016, 3, 0, 0, 3176, 2, 0}, {43, 1, 2, 2403, 3178, 3, 0}, {1202, 3, 0, 0, 1843, 3, 0},
+						{2019, 9, 0, 0, 3181, 3, 0}, {285, 10, 0, 0, 3184, 3, 0}, {460, 3, 0, 0, 776, 3, 0}, {161, 2, 0, 0, 2654, 3, 0},
+						{81, 2, 0, 0, 3187, 2, 0}, {32, 1, 3, 2405, 0, 0, 0}, {476, 2, 0, 0, 1909, 2, 0}, {1181, 3, 0, 0, 3189, 3, 0},
+						{1654, 3, 0, 0, 3192, 3, 0}, {30, 1, 2, 2408, 0, 0, 0}, {2028, 5, 0, 0, 3195, 3, 0}, {465, 4, 0, 0, 636, 3, 0},
+						{4, 1, 0, 0, 3198, 3, 0}, {128, 3, 0, 0, 3201, 3, 0}, {44, 1, 1, 2410, 3204, 3, 0}, {47, 1, 0, 0, 98, 3, 0},
+						{29, 1, 0, 0, 3207, 3, 0}, {134, 2, 0, 0, 1966, 3, 0}, {27, 1, 1, 2411, 3210, 3, 0}, {113, 2, 0, 0, 3213, 3, 0},
+						{2031, 2, 0, 0, 3181, 3, 0}, {75, 2, 0, 0, 3216, 3, 0}, {86, 2, 0, 0, 3219, 3, 0}, {1273, 3, 0, 0, 3222, 3, 0},
+						{1783, 2, 0, 0, 3225, 3, 0}, {172, 3, 0, 0, 3228, 3, 0}, {30, 1, 1, 2412, 3231, 3, 0}, {58, 2, 2, 2413, 0, 0, 0},
+						{36, 1, 2, 2415, 0, 0, 0}, {647, 3, 0, 0, 3234, 2, 0}, {102, 2, 0, 0, 2855, 3, 0}, {43, 1, 0, 0, 507, 3, 0},
+						{1508, 4, 0, 0, 3236, 3, 0}, {2033, 5, 0, 0, 3239, 3, 0}, {290, 5, 1, 2417, 826, 3, 0}, {1587, 7, 2, 2418, 0, 0, 0},
+						{2038, 10, 0, 0, 2016, 3, 0}, {285, 5, 3, 2420, 0, 0, 0}, {2048, 10, 0, 0, 2084, 3, 0}, {42, 1, 0, 0, 679, 3, 0},
+						{2007, 5, 0, 0, 1997, 3, 0}, {1563, 2, 0, 0, 3242, 3, 0}, {128, 3, 1, 2423, 3245, 3, 0}, {32, 1, 1, 2424, 3248, 6, 0},
+						{44, 1, 5, 2425, 0, 0, 0}, {29, 1, 0, 0, 3254, 3, 0}, {46, 1, 1, 2430, 2858, 3, 0}, {1522, 4, 0, 0, 2027, 3, 0},
+						{1146, 4, 0, 0, 2033, 3, 0}, {42, 1, 1, 2431, 2036, 3, 0}, {99, 2, 0, 0, 3257, 3, 0}, {275, 2, 0, 0, 3260, 3, 0},
+						{1689, 4, 2, 2432, 0, 0, 0}, {2058, 6, 0, 0, 925, 3, 0}, {285, 10, 0, 0, 2784, 3, 0}, {1689, 4, 0, 0, 3216, 3, 0},
+						{285, 5, 0, 0, 3263, 3, 0}, {181, 2, 0, 0, 3266, 3, 0}, {31, 1, 0, 0, 3269, 4, 0}, {236, 3, 0, 0, 3273, 3, 0},
+						{2064, 3, 0, 0, 3276, 3, 0}, {348, 3, 0, 0, 3279, 1, 0}, {2067, 4, 0, 0, 2048, 3, 0}, {31, 1, 0, 0, 3280, 3, 0},
+						{29, 1, 0, 0, 3283, 3, 0}, {30, 1, 0, 0, 3286, 3, 0}, {32, 1, 0, 0, 3289, 3, 0}, {27, 1, 0, 0, 3292, 1, 0},
+						{385, 2, 1, 2434, 1242, 3, 0}, {28, 1, 0, 0, 3293, 3, 0}, {131, 2, 0, 0, 3296, 3, 0}, {999, 3, 0, 0, 3299, 3, 0},
+						{34, 1, 2, 2435, 3302, 3, 0}, {30, 1, 0, 0, 3305, 3, 0}, {45, 1, 1, 2437, 3308, 3, 0}, {1433, 3, 3, 2438, 2110, 3, 0},
+						{2064, 3, 0, 0, 1462, 1, 0}, {193, 3, 0, 0, 3311, 3, 0}, {128, 3, 0, 0, 1012, 2, 1}, {27, 1, 0, 0, 2998, 3, 0},
+						{29, 1, 1, 2441, 3109, 3, 0}, {47, 1, 0, 0, 3314, 5, 0}, {290, 5, 0, 0, 2243, 3, 0}, {285, 10, 0, 0, 2231, 3, 0},
+						{47, 1, 0, 0, 3319, 5, 0}, {4, 1, 0, 0, 3324, 5, 0}, {227, 2, 0, 0, 3329, 5, 0}, {139, 2, 0, 0, 3334, 2, 0},
+						{1146, 4, 0, 0, 2182, 3, 0}, {259, 2, 1, 2442, 2185, 3, 0}, {30, 1, 0, 0, 3336, 5, 0}, {41, 1, 0, 0, 3341, 3, 0},
+						{643, 3, 0, 0, 3344, 2, 0}, {128, 3, 0, 0, 3346, 5, 0}, {2031, 2, 0, 0, 3351, 3, 0}, {43, 1, 1, 2443, 2923, 3, 0},
+						{1311, 3, 0, 0, 2657, 3, 0}, {394, 2, 0, 0, 3354, 5, 0}, {44, 1, 0, 0, 2214, 3, 0}, {42, 1, 2, 2444, 2222, 3, 0},
+						{44, 1, 0, 0, 3359, 5, 0}, {43, 1, 0, 0, 2228, 3, 0}, {29, 1, 0, 0, 3364, 3, 0}, {917, 2, 2, 2446, 0, 0, 0},
+						{42, 1, 2, 2448, 2257, 3, 0}, {44, 1, 1, 2450, 3367, 5, 0}, {97, 2, 1, 2451, 3372, 3, 0}, {98, 2, 3, 2452, 3375, 3, 0},
+						{590, 2, 1, 2455, 3378, 3, 0}, {2071, 5, 0, 0, 2272, 3, 0}, {619, 2, 0, 0, 3381, 6, 0}, {45, 1, 0, 0, 3387, 5, 0},
+						{1497, 3, 0, 0, 3392, 3, 0}, {30, 1, 1, 2456, 3395, 5, 0}, {28, 1, 0, 0, 3400, 5, 0}, {48, 1, 0, 0, 3405, 5, 0},
+						{30, 1, 0, 0, 3410, 3, 0}, {1497, 3, 0, 0, 3413, 3, 0}, {30, 1, 0, 0, 3416, 5, 0}, {43, 1, 0, 0, 3421, 4, 0},
+						{226, 3, 0, 0, 730, 3, 0}, {2076, 8, 0, 0, 2272, 3, 0}, {30, 1, 1, 2457, 3425, 3, 0}, {199, 2, 0, 0, 3428, 3, 0},
+						{119, 2, 0, 0, 3431, 3, 0}, {27, 1, 3, 2458, 3434, 3, 0}, {1563, 2, 1, 2461, 2287, 3, 0}, {41, 1, 3, 2462, 3437, 3, 0},
+						{1689, 4, 1, 2465, 3372, 3, 0}, {285, 5, 1, 2466, 2284, 3, 0}, {1252, 3, 0, 0, 3440, 3, 0}, {464, 2, 0, 0, 3443, 3, 0},
+						{30, 1, 0, 0, 3446, 6, 0}, {45, 1, 0, 0, 3452, 4, 0}, {410, 3, 0, 0, 3456, 3, 0}, {30, 1, 0, 0, 3459, 6, 0},
+						{45, 1, 1, 2467, 3465, 4, 0}, {410, 3, 0, 0, 3469, 3, 0}, {2084, 4, 0, 0, 3472, 6, 0}, {2031, 2, 0, 0, 3478, 3, 0},
+						{43, 1, 1, 2468, 2920, 3, 0}, {28, 1, 0, 0, 3481, 2, 1}, {131, 2, 0, 0, 3483, 3, 0}, {138, 4, 0, 0, 3486, 3, 0},
+						{984, 4, 0, 0, 3489, 2, 0}, {29, 1, 0, 0, 3491, 3, 0}, {232, 3, 0, 0, 1017, 3, 0}, {186, 2, 1, 2469, 2407, 3, 0},
+						{31, 1, 0, 0, 3494, 2, 1}, {38, 1, 0, 0, 3496, 2, 1}, {345, 2, 0, 0, 3498, 3, 0}, {2072, 4, 0, 0, 755, 3, 0},
+						{394, 2, 0, 0, 3501, 3, 0}, {37, 1, 0, 0, 3381, 3, 0}, {47, 1, 0, 0, 3504, 2, 0}, {617, 2, 1, 2470, 615, 3, 0},
+						{2088, 2, 0, 0, 615, 3, 0}, {1142, 4, 0, 0, 3506, 3, 0}, {27, 1, 0, 0, 3001, 3, 0}, {193, 3, 0, 0, 3509, 3, 0},
+						{29, 1, 2, 2471, 0, 0, 0}, {30, 1, 0, 0, 3512, 3, 0}, {38, 2, 0, 0, 287, 2, 1}, {1273, 3, 0, 0, 3515, 3, 0},
+						{2090, 3, 0, 0, 3518, 3, 0}, {28, 1, 5, 2473, 766, 3, 0}, {44, 1, 0, 0, 1259, 3, 0}, {4, 1, 0, 0, 3521, 3, 0},
+						{222, 2, 0, 0, 3524, 3, 0}, {1273, 3, 0, 0, 3527, 3, 0}, {29, 1, 0, 0, 2870, 3, 0}, {31, 1, 3, 2478, 0, 0, 0},
+						{41, 1, 1, 2481, 887, 3, 0}, {2093, 7, 0, 0, 1130, 3, 0}, {460, 3, 0, 0, 3530, 3, 0}, {120, 2, 0, 0, 3140, 3, 0},
+						{30, 1, 0, 0, 3533, 5, 0}, {60, 3, 0, 0, 3538, 2, 0}, {29, 1, 0, 0, 3540, 3, 0}, {30, 1, 0, 0, 3543, 3, 0},
+						{134, 2, 0, 0, 2481, 3, 0}, {222, 2, 0, 0, 3546, 3, 0}, {27, 1, 1, 2482, 3549, 3, 0}, {28, 1, 0, 0, 3400, 3, 0},
+						{113, 2, 0, 0, 3552, 3, 0}, {2031, 2, 0, 0, 3184, 3, 0}, {75, 2, 0, 0, 3263, 3, 0}, {86, 2, 0, 0, 3555, 3, 0},
+						{1273, 3, 0, 0, 3558, 3, 0}, {1783, 2, 0, 0, 3561, 3, 0}, {48, 1, 0, 0, 3405, 3, 0}, {172, 3, 0, 0, 3564, 3, 0},
+						{94, 2, 1, 2483, 3567, 3, 0}, {58, 2, 2, 2484, 0, 0, 0}, {36, 1, 2, 2486, 0, 0, 0}, {647, 3, 0, 0, 3570, 2, 0},
+						{102, 2, 0, 0, 1285, 3, 0}, {43, 1, 0, 0, 2500, 3, 0}, {878, 3, 0, 0, 1300, 3, 0}, {456, 4, 0, 0, 309, 3, 0},
+						{44, 1, 0, 0, 1294, 3, 0}, {29, 1, 0, 0, 3572, 3, 0}, {46, 1, 1, 2488, 1291, 3, 0}, {47, 1, 0, 0, 3575, 2, 0},
+						{290, 5, 1, 2489, 829, 3, 0}, {1587, 7, 2, 2490, 0, 0, 0}, {1689, 4, 2, 2492, 0, 0, 0}, {2100, 11, 0, 0, 802, 3, 0},
+						{2111, 10, 0, 0, 3405, 3, 0}, {2048, 10, 0, 0, 2543, 3, 0}, {99, 2, 0, 0, 3577, 3, 0}, {275, 2, 0, 0, 3580, 3, 0},
+						{181, 2, 0, 0, 3583, 3, 0}, {31, 1, 0, 0, 3586, 4, 0}, {236, 3, 0, 0, 3590, 3, 0}, {100, 2, 0, 0, 3593, 3, 0},
+						{27, 1, 0, 0, 3596, 1, 0}, {385, 2, 1, 2494, 2824, 3, 0}, {30, 1, 0, 0, 3472, 3, 0}, {31, 1, 0, 0, 3597, 3, 0},
+						{562, 4, 0, 0, 3600, 3, 0}, {41, 1, 0, 0, 3603, 3, 0}, {643, 3, 0, 0, 3606, 2, 0}, {647, 3, 0, 0, 3608, 2, 0},
+						{4, 1, 0, 0, 3610, 3, 0}, {222, 2, 0, 0, 3613, 3, 0}, {1273, 3, 0, 0, 3616, 3, 0}, {2031, 2, 0, 0, 1852, 3, 0},
+						{43, 1, 1, 2495, 2867, 3, 0}, {231, 4, 0, 0, 988, 3, 0}, {39, 1, 0, 0, 988, 3, 0}, {483, 3, 0, 0, 3619, 2, 0},
+						{50, 1, 0, 0, 3621, 2, 0}, {226, 3, 0, 0, 2123, 3, 0}, {2076, 8, 0, 0, 755, 3, 0}, {31, 1, 0, 0, 3623, 2, 0},
+						{47, 1, 0, 0, 3623, 2, 0}, {128, 3, 0, 0, 3625, 3, 0}, {30, 1, 1, 2496, 1352, 3, 0}, {32, 1, 1, 2497, 3628, 3, 0},
+						{37, 1, 1, 2498, 3631, 3, 0}, {645, 2, 0, 0, 3634, 3, 0}, {503, 4, 0, 0, 3637, 3, 0}, {535, 4, 0, 0, 3640, 3, 0},
+						{2121, 10, 0, 0, 988, 3, 0}, {2131, 3, 0, 0, 3643, 3, 0}, {29, 1, 0, 0, 2123, 3, 0}, {134, 2, 0, 0, 2616, 3, 0},
+						{30, 1, 1, 2499, 3646, 3, 0}, {27, 1, 1, 2500, 3649, 3, 0}, {1202, 3, 0, 0, 2609, 3, 0}, {222, 2, 1, 2501, 2888, 3, 0},
+						{142, 2, 1, 2502, 2891, 3, 0}, {27, 1, 2, 2503, 3652, 3, 0}, {41, 1, 2, 2505, 3655, 3, 0}, {181, 2, 2, 2507, 0, 0, 0},
+						{31, 1, 0, 0, 1100, 3, 0}, {31, 1, 0, 0, 2974, 3, 0}, {2134, 5, 2, 2509, 0, 0, 0}, {566, 2, 0, 0, 2108, 2, 0},
+						{4, 1, 0, 0, 3658, 3, 0}, {128, 3, 0, 0, 3661, 3, 0}, {30, 1, 1, 2511, 3664, 3, 0}, {2139, 4, 0, 0, 3667, 3, 0},
+						{39, 1, 2, 2512, 0, 0, 0}, {503, 4, 0, 0, 3670, 3, 0}, {535, 4, 0, 0, 3673, 3, 0}, {44, 1, 3, 2514, 0, 0, 0},
+						{2143, 6, 0, 0, 3603, 3, 0}, {2149, 7, 0, 0, 2555, 3, 0}, {120, 2, 0, 0, 2558, 3, 0}, {39, 1, 3, 2517, 0, 0, 0},
+						{1273, 3, 0, 0, 2566, 3, 0}, {1922, 1, 0, 0, 3676, 2, 1}, {2156, 1, 0, 0, 3678, 2, 1}, {1923, 1, 0, 0, 3680, 2, 1},
+						{4, 1, 0, 0, 3682, 3, 0}, {29, 1, 2, 2520, 0, 0, 0}, {30, 1, 1, 2522, 3685, 3, 0}, {1936, 2, 2, 2523, 0, 0, 0},
+						{549, 4, 0, 0, 3688, 3, 0}, {2139, 4, 0, 0, 3691, 3, 0}, {39, 1, 2, 2525, 0, 0, 0}, {503, 4, 0, 0, 3694, 3, 0},
+						{44, 1, 3, 2527, 0, 0, 0}, {2031, 2, 0, 0, 1855, 3, 0}, {43, 1, 1, 2530, 2864, 3, 0}, {64, 2, 2, 2531, 0, 0, 0},
+						{171, 2, 2, 2533, 3697, 2, 0}, {617, 2, 2, 2535, 0, 0, 0}, {2157, 3, 0, 0, 2905, 3, 0}, {222, 2, 0, 0, 492, 3, 0},
+						{1273, 3, 0, 0, 356, 3, 0}, {27, 1, 1, 2537, 3004, 3, 0}, {29, 1, 0, 0, 3699, 3, 0}, {2160, 3, 0, 0, 3702, 3, 0},
+						{193, 3, 0, 0, 3705, 3, 0}, {31, 1, 1, 2538, 3708, 4, 0}, {423, 5, 4, 2539, 2727, 3, 0}, {128, 3, 0, 0, 3712, 3, 0},
+						{30, 1, 0, 0, 3715, 3, 0}, {1931, 5, 0, 0, 3718, 3, 0}, {503, 4, 0, 0, 3721, 3, 0}, {2163, 2, 0, 0, 3724, 3, 0},
+						{1384, 4, 0, 0, 3727, 3, 0}, {43, 1, 0, 0, 3730, 4, 0}, {50, 1, 0, 0, 3734, 2, 0}, {2019, 9, 0, 0, 1187, 3, 0},
+						{285, 10, 0, 0, 1276, 3, 0}, {37, 1, 0, 0, 3736, 3, 0}, {43, 1, 0, 0, 2882, 3, 0}, {1225, 3, 1, 2543, 3739, 3, 0},
+						{570, 3, 0, 0, 3742, 3, 0}, {1689, 4, 0, 0, 3736, 3, 0}, {285, 5, 0, 0, 2882, 3, 0}, {33, 1, 0, 0, 1395, 2, 0},
+						{166, 3, 0, 0, 2712, 2, 0}, {1225, 3, 1, 2544, 3745, 3, 0}, {570, 3, 0, 0, 3748, 3, 0}, {31, 1, 0, 0, 3751, 3, 0},
+						{1911, 7, 0, 0, 3138, 2, 0}, {2165, 5, 0, 0, 1944, 2, 0}, {2170, 7, 0, 0, 1706, 3, 0}, {41, 1, 3, 2545, 0, 0, 0},
+						{43, 1, 1, 2548, 1386, 3, 0}, {44, 1, 2, 2549, 0, 0, 0}, {45, 1, 2, 2551, 0, 0, 0}, {348, 3, 0, 0, 3754, 3, 0},
+						{120, 2, 0, 0, 3757, 3, 0}, {348, 3, 0, 0, 3760, 1, 0}, {45, 1, 0, 0, 3760, 1, 0}, {2177, 2, 2, 2553, 0, 0, 0},
+						{589, 2, 2, 2555, 0, 0, 0}, {348, 3, 0, 0, 3761, 3, 0}, {362, 2, 1, 2557, 1433, 3, 0}, {31, 1, 0, 0, 3764, 4, 0},
+						{236, 3, 0, 0, 2971, 3, 0}, {2179, 5, 0, 0, 1423, 2, 0}, {341, 2, 2, 2558, 0, 0, 0}, {2184, 5, 0, 0, 611, 1, 0},
+						{861, 5, 0, 0, 2650, 2, 0}, {45, 1, 0, 0, 1060, 2, 0}, {1068, 7, 0, 0, 538, 3, 0}, {919, 3, 3, 2560, 0, 0, 0},
+						{1159, 3, 2, 2563, 0, 0, 0}, {1070, 5, 0, 0, 1145, 3, 0}, {1115, 3, 0, 0, 868, 3, 0}, {1070, 5, 0, 0, 847, 3, 0},
+						{1066, 9, 0, 0, 862, 3, 0}, {273, 3, 0, 0, 3768, 3, 0}, {1094, 7, 0, 0, 1657, 3, 0}, {2189, 11, 0, 0, 3771, 3, 0},
+						{1830, 9, 0, 0, 3774, 3, 0}, {1046, 6, 1, 2565, 3254, 3, 0}, {1830, 9, 0, 0, 3777, 3, 0}, {1046, 6, 1, 2566, 3572, 3, 0},
+						{1070, 5, 0, 0, 3780, 3, 0}, {689, 4, 0, 0, 1911, 3, 0}, {1843, 8, 0, 0, 2757, 3, 0}, {1798, 11, 0, 0, 1966, 3, 0},
+						{291, 4, 2, 2567, 826, 3, 0}, {1809, 11, 0, 0, 2042, 3, 0}, {757, 2, 2, 2569, 0, 0, 0}, {1070, 5, 0, 0, 3178, 3, 0},
+						{1046, 6, 0, 0, 3783, 3, 0}, {480, 2, 2, 2571, 3097, 3, 0}, {1168, 7, 2, 2573, 880, 3, 0}, {1820, 10, 0, 0, 3786, 3, 0},
+						{1830, 9, 0, 0, 3789, 3, 0}, {1046, 6, 1, 2575, 3736, 3, 0}, {273, 3, 0, 0, 3792, 3, 0}, {1070, 5, 0, 0, 2772, 3, 0},
+						{1084, 10, 0, 0, 2766, 3, 0}, {290, 5, 0, 0, 2769, 3, 0}, {285, 10, 0, 0, 2763, 3, 0}, {1882, 7, 0, 0, 1408, 3, 0},
+						{1714, 6, 0, 0, 1408, 3, 0}, {2200, 8, 0, 0, 2211, 3, 0}, {2208, 5, 0, 0, 3795, 3, 0}, {157, 6, 0, 0, 3375, 3, 0},
+						{827, 4, 1, 2576, 718, 3, 0}, {2213, 5, 0, 0, 2214, 3, 0}, {826, 5, 0, 0, 2222, 3, 0}, {831, 9, 0, 0, 2217, 5, 0},
+						{840, 7, 0, 0, 3314, 5, 0}, {847, 4, 0, 0, 2293, 3, 0}, {851, 10, 0, 0, 3359, 5, 0}, {861, 5, 0, 0, 2225, 3, 0},
+						{881, 8, 0, 0, 2188, 5, 0}, {826, 5, 0, 0, 3336, 5, 0}, {2218, 10, 2, 2577, 3372, 3, 0}, {140, 2, 5, 2579, 2263, 3, 0},
+						{1720, 14, 0, 0, 3798, 5, 0}, {1734, 8, 0, 0, 3803, 5, 0}, {826, 5, 0, 0, 3395, 5, 0}, {851, 10, 0, 0, 3392, 3, 0},
+						{2228, 13, 0, 0, 3378, 3, 0}, {2241, 12, 2, 2584, 2284, 3, 0}, {2253, 7, 2, 2586, 0, 0, 0}, {46, 1, 3, 2588, 0, 0, 0},
+						{826, 5, 0, 0, 3425, 3, 0}, {831, 9, 0, 0, 2195, 3, 0}, {861, 5, 0, 0, 2182, 3, 0}, {30, 1, 0, 0, 3808, 3, 0},
+						{1806, 3, 0, 0, 834, 3, 0}, {259, 2, 0, 0, 887, 3, 0}, {157, 6, 0, 0, 725, 3, 0}, {1105, 10, 0, 0, 2060, 3, 0},
+						{273, 3, 0, 0, 3549, 3, 0}, {1075, 9, 0, 0, 2520, 3, 0}, {1830, 9, 0, 0, 3811, 3, 0}, {1046, 6, 1, 2591, 1617, 3, 0},
+						{1070, 5, 0, 0, 2110, 3, 0}, {1046, 6, 0, 0, 3814, 3, 0}, {273, 3, 0, 0, 3817, 3, 0}, {826, 5, 0, 0, 3472, 3, 0},
+						{273, 3, 0, 0, 3820, 3, 0}, {2260, 4, 1, 2592, 3652, 3, 0}, {2264, 6, 1, 2593, 3655, 3, 0}, {826, 5, 0, 0, 3664, 3, 0},
+						{826, 5, 0, 0, 2558, 3, 0}, {851, 10, 0, 0, 2555, 3, 0}, {861, 5, 0, 0, 2566, 3, 0}, {826, 5, 0, 0, 3685, 3, 0},
+						{181, 2, 0, 0, 3279, 1, 0}, {1773, 3, 2, 2594, 0, 0, 0}, {1653, 4, 4, 2596, 0, 0, 0}, {26, 1, 8, 2600, 0, 0, 0},
+						{517, 2, 1, 2608, 3823, 3, 0}, {76, 2, 0, 0, 3826, 3, 0}, {45, 1, 0, 0, 23, 2, 0}, {120, 2, 0, 0, 3010, 3, 0},
+						{362, 2, 0, 0, 2963, 3, 0}, {2270, 7, 0, 0, 3280, 3, 0}, {1974, 6, 0, 0, 1100, 3, 0}, {1167, 8, 3, 2609, 3751, 3, 0},
+						{2156, 1, 0, 0, 3829, 3, 0}, {1924, 1, 0, 0, 3832, 3, 0}, {11, 1, 0, 0, 3835, 3, 0}, {17, 1, 0, 0, 3838, 3, 0},
+						{37, 1, 0, 0, 3841, 3, 0}, {43, 1, 0, 0, 3844, 3, 0}, {3, 1, 0, 0, 3847, 3, 0}, {20, 1, 0, 0, 3850, 3, 0},
+						{29, 1, 0, 0, 3853, 3, 0}, {46, 1, 0, 0, 3856, 3, 0}, {11, 1, 0, 0, 3859, 3, 0}, {17, 1, 0, 0, 3862, 3, 0},
+						{37, 1, 0, 0, 3865, 3, 0}, {43, 1, 0, 0, 3868, 3, 0}, {7, 1, 0, 0, 3871, 3, 0}, {11, 1, 0, 0, 3874, 3, 0},
+						{17, 1, 0, 0, 3877, 3, 0}, {33, 1, 0, 0, 3880, 3, 0}, {37, 1, 0, 0, 3883, 3, 0}, {43, 1, 0, 0, 3886, 3, 0},
+						{11, 1, 0, 0, 3889, 3, 0}, {17, 1, 0, 0, 3892, 3, 0}, {37, 1, 0, 0, 3895, 3, 0}, {43, 1, 0, 0, 3898, 3, 0},
+						{3, 1, 0, 0, 3901, 3, 0}, {20, 1, 0, 0, 3904, 3, 0}, {29, 1, 0, 0, 3907, 3, 0}, {46, 1, 0, 0, 3910, 3, 0},
+						{11, 1, 0, 0, 3913, 3, 0}, {17, 1, 0, 0, 3916, 3, 0}, {37, 1, 0, 0, 3919, 3, 0}, {43, 1, 0, 0, 3922, 3, 0},
+						{7, 1, 0, 0, 3925, 3, 0}, {11, 1, 0, 0, 3928, 3, 0}, {17, 1, 0, 0, 3931, 3, 0}, {33, 1, 0, 0, 3934, 3, 0},
+						{37, 1, 0, 0, 3937, 3, 0}, {43, 1, 0, 0, 3940, 3, 0}, {42, 1, 0, 0, 1138, 3, 0}, {222, 2, 0, 0, 3943, 3, 0},
+						{142, 2, 0, 0, 3946, 3, 0}, {290, 5, 2, 2612, 0, 0, 0}, {29, 1, 5, 2614, 0, 0, 0}, {42, 1, 0, 0, 985, 3, 0},
+						{45, 1, 0, 0, 3949, 1, 0}, {1193, 2, 0, 0, 333, 3, 0}, {134, 2, 2, 2619, 0, 0, 0}, {128, 3, 0, 0, 3346, 3, 0},
+						{1772, 2, 0, 0, 3950, 3, 0}, {30, 1, 0, 0, 3953, 3, 0}, {30, 1, 0, 0, 3956, 3, 0}, {222, 2, 0, 0, 3959, 3, 0},
+						{142, 2, 0, 0, 3962, 3, 0}, {38, 1, 0, 0, 3965, 3, 0}, {120, 2, 2, 2621, 0, 0, 0}, {593, 3, 0, 0, 1573, 3, 0},
+						{596, 5, 0, 0, 1576, 3, 0}, {1689, 4, 0, 0, 1567, 3, 0}, {285, 5, 0, 0, 3092, 3, 0}, {2277, 4, 0, 0, 3103, 3, 0},
+						{2281, 7, 0, 0, 3106, 3, 0}, {128, 3, 0, 0, 1668, 3, 0}, {1689, 4, 0, 0, 1614, 3, 0}, {285, 5, 0, 0, 1617, 3, 0},
+						{1923, 1, 0, 0, 3968, 3, 0}, {1924, 1, 0, 0, 3971, 3, 0}, {2288, 3, 0, 0, 1692, 3, 0}, {2012, 4, 0, 0, 1701, 3, 0},
+						{486, 2, 0, 0, 3974, 3, 0}, {47, 1, 0, 0, 3977, 3, 0}, {1922, 1, 6, 2623, 0, 0, 0}, {2156, 1, 2, 2629, 0, 0, 0},
+						{1923, 1, 3, 2631, 0, 0, 0}, {2291, 2, 0, 0, 3980, 3, 0}, {2292, 1, 2, 2634, 0, 0, 0}, {2293, 2, 0, 0, 3983, 3, 0},
+						{40, 1, 1, 2636, 3986, 3, 0}, {471, 2, 0, 0, 3989, 3, 0}, {42, 1, 0, 0, 1808, 3, 0}, {2144, 5, 0, 0, 1789, 3, 0},
+						{275, 2, 0, 0, 3992, 3, 0}, {2012, 4, 0, 0, 1796, 3, 0}, {2295, 5, 0, 0, 1782, 3, 0}, {193, 3, 0, 0, 3995, 3, 0},
+						{48, 1, 0, 0, 3998, 3, 0}, {30, 1, 0, 0, 163, 3, 0}, {2300, 4, 0, 0, 168, 3, 0}, {456, 4, 0, 0, 163, 3, 0},
+						{2304, 4, 0, 0, 474, 3, 0}, {2308, 4, 0, 0, 3192, 3, 0}, {47, 1, 0, 0, 4001, 3, 0}, {113, 2, 0, 0, 4004, 3, 0},
+						{44, 1, 0, 0, 4007, 6, 0}, {30, 1, 0, 0, 1985, 1, 0}, {36, 1, 0, 0, 3292, 1, 0}, {30, 1, 0, 0, 4013, 3, 0},
+						{619, 2, 2, 2637, 0, 0, 0}, {171, 4, 0, 0, 3225, 3, 0}, {1118, 4, 0, 0, 3254, 3, 0}, {142, 2, 0, 0, 2858, 3, 0},
+						{290, 5, 1, 2639, 3178, 3, 0}, {2312, 8, 0, 0, 2060, 3, 0}, {2111, 10, 0, 0, 3998, 3, 0}, {40, 1, 1, 2640, 4016, 3, 0},
+						{471, 2, 0, 0, 4019, 3, 0}, {2143, 6, 0, 0, 1969, 3, 0}, {128, 3, 0, 0, 2081, 3, 0}, {120, 2, 2, 2641, 0, 0, 0},
+						{2288, 3, 0, 0, 688, 3, 0}, {1273, 3, 0, 0, 2076, 3, 0}, {37, 1, 0, 0, 4022, 3, 0}, {42, 1, 0, 0, 2030, 3, 0},
+						{290, 5, 0, 0, 2772, 3, 0}, {285, 10, 0, 0, 2766, 3, 0}, {43, 1, 0, 0, 813, 3, 0}, {30, 1, 0, 0, 4025, 3, 0},
+						{31, 1, 0, 0, 4028, 3, 0}, {2320, 3, 0, 0, 3308, 3, 0}, {1118, 4, 0, 0, 3780, 3, 0}, {1689, 4, 0, 0, 4031, 3, 0},
+						{142, 2, 0, 0, 2917, 3, 0}, {46, 1, 0, 0, 4034, 3, 0}, {44, 1, 0, 0, 1223, 3, 0}, {293, 2, 0, 0, 2923, 3, 0},
+						{42, 1, 0, 0, 2217, 5, 0}, {2007, 5, 0, 0, 3359, 5, 0}, {290, 5, 0, 0, 2251, 3, 0}, {285, 10, 0, 0, 2234, 3, 0},
+						{42, 1, 0, 0, 2246, 5, 0}, {2007, 5, 0, 0, 3367, 5, 0}, {44, 1, 0, 0, 2263, 3, 0}, {30, 1, 0, 0, 4037, 3, 0},
+						{4, 1, 0, 0, 4040, 5, 0}, {128, 3, 0, 0, 4045, 5, 0}, {47, 1, 3, 2643, 0, 0, 0}, {47, 1, 3, 2646, 0, 0, 0},
+						{28, 1, 1, 2649, 2278, 3, 0}, {42, 1, 0, 0, 3425, 3, 0}, {4, 1, 0, 0, 4050, 5, 0}, {30, 1, 0, 0, 4055, 3, 0},
+						{1858, 3, 1, 2650, 2741, 6, 0}, {120, 2, 0, 0, 3416, 5, 0}, {4, 1, 0, 0, 4058, 5, 0}, {30, 1, 0, 0, 4063, 3, 0},
+						{1858, 3, 1, 2651, 2747, 6, 0}, {120, 2, 0, 0, 4037, 3, 0}, {120, 2, 0, 0, 3410, 3, 0}, {819, 3, 0, 0, 4066, 6, 0},
+						{293, 2, 0, 0, 2920, 3, 0}, {454, 2, 0, 0, 2407, 3, 0}, {33, 1, 0, 0, 4072, 3, 0}, {40, 1, 0, 0, 3112, 3, 0},
+						{46, 1, 0, 0, 4075, 3, 0}, {2143, 6, 0, 0, 2450, 3, 0}, {2149, 7, 0, 0, 2453, 3, 0}, {120, 2, 0, 0, 2456, 3, 0},
+						{39, 1, 3, 2652, 0, 0, 0}, {1273, 3, 0, 0, 2462, 3, 0}, {2323, 4, 0, 0, 4078, 3, 0}, {2300, 4, 0, 0, 4081, 3, 0},
+						{2327, 4, 0, 0, 4084, 3, 0}, {681, 2, 0, 0, 887, 3, 0}, {113, 2, 0, 0, 4087, 3, 0}, {2331, 4, 0, 0, 297, 3, 0},
+						{30, 1, 0, 0, 2491, 1, 0}, {36, 1, 0, 0, 3596, 1, 0}, {30, 1, 0, 0, 4090, 3, 0}, {619, 2, 2, 2655, 0, 0, 0},
+						{37, 1, 0, 0, 4093, 3, 0}, {171, 4, 0, 0, 3561, 3, 0}, {1118, 4, 0, 0, 3572, 3, 0}, {142, 2, 0, 0, 1291, 3, 0},
+						{1596, 6, 0, 0, 2520, 3, 0}, {2312, 8, 0, 0, 1085, 3, 0}, {43, 1, 0, 0, 2824, 3, 0}, {293, 2, 0, 0, 2867, 3, 0},
+						{42, 1, 0, 0, 1352, 3, 0}, {4, 1, 0, 0, 4096, 3, 0}, {4, 1, 0, 0, 4099, 3, 0}, {44, 1, 0, 0, 4102, 6, 0},
+						{181, 2, 0, 0, 4108, 3, 0}, {44, 1, 0, 0, 4111, 6, 0}, {44, 1, 0, 0, 4117, 6, 0}, {30, 1, 0, 0, 4123, 3, 0},
+						{1858, 3, 1, 2657, 3652, 3, 0}, {30, 1, 0, 0, 4126, 3, 0}, {1858, 3, 1, 2658, 3655, 3, 0}, {30, 1, 0, 0, 1327, 3, 0},
+						{31, 1, 0, 0, 1100, 3, 0}, {1911, 7, 0, 0, 3138, 2, 0}, {2335, 3, 0, 0, 3504, 2, 0}, {128, 3, 0, 0, 4129, 3, 0},
+						{4, 1, 0, 0, 4132, 3, 0}, {30, 1, 0, 0, 4135, 3, 0}, {913, 2, 2, 2659, 2622, 3, 0}, {394, 2, 0, 0, 4138, 3, 0},
+						{46, 1, 2, 2661, 0, 0, 0}, {2143, 6, 0, 0, 3613, 3, 0}, {1284, 3, 0, 0, 3610, 3, 0}, {1273, 3, 0, 0, 3616, 3, 0},
+						{129, 2, 0, 0, 4141, 3, 0}, {1937, 3, 0, 0, 4144, 3, 0}, {128, 3, 0, 0, 4147, 3, 0}, {548, 2, 0, 0, 4150, 3, 0},
+						{398, 2, 0, 0, 4153, 3, 0}, {4, 1, 0, 0, 4156, 3, 0}, {30, 1, 0, 0, 4159, 3, 0}, {913, 2, 2, 2663, 2628, 3, 0},
+						{394, 2, 0, 0, 4162, 3, 0}, {46, 1, 2, 2665, 0, 0, 0}, {293, 2, 0, 0, 2864, 3, 0}, {1924, 1, 0, 0, 2894, 3, 0},
+						{1878, 4, 0, 0, 2894, 3, 0}, {1894, 3, 0, 0, 4165, 2, 0}, {47, 1, 0, 0, 4165, 2, 0}, {2143, 6, 0, 0, 492, 3, 0},
+						{1273, 3, 0, 0, 356, 3, 0}, {181, 2, 0, 0, 4167, 3, 0}, {1488, 3, 0, 0, 4170, 3, 0}, {1118, 4, 0, 0, 1654, 3, 0},
+						{1689, 4, 1, 2667, 3302, 3, 0}, {42, 1, 0, 0, 3715, 3, 0}, {285, 5, 1, 2668, 2549, 3, 0}, {186, 2, 0, 0, 3739, 3, 0},
+						{186, 2, 0, 0, 3745, 3, 0}, {33, 2, 0, 0, 3504, 2, 0}, {34, 1, 0, 0, 2435, 2, 0}, {2338, 5, 0, 0, 887, 3, 0},
+						{279, 2, 0, 0, 3575, 2, 0}, {314, 4, 0, 0, 3623, 2, 0}, {46, 1, 2, 2669, 0, 0, 0}, {2343, 4, 0, 0, 4165, 2, 0},
+						{1168, 7, 2, 2671, 0, 0, 0}, {4, 1, 0, 0, 4173, 6, 0}, {30, 1, 0, 0, 4179, 6, 0}, {4, 1, 0, 0, 4185, 6, 0},
+						{30, 1, 0, 0, 4191, 6, 0}, {42, 1, 0, 0, 4197, 3, 0}, {45, 1, 0, 0, 1641, 2, 0}, {2347, 9, 0, 0, 1591, 2, 0},
+						{1070, 5, 0, 0, 1950, 3, 0}, {1084, 10, 0, 0, 612, 3, 0}, {1115, 3, 0, 0, 1047, 3, 0}, {1075, 4, 2, 2673, 0, 0, 0},
+						{1084, 10, 0, 0, 2781, 3, 0}, {273, 3, 0, 0, 4200, 3, 0}, {273, 3, 0, 0, 4203, 3, 0}, {273, 3, 0, 0, 3210, 3, 0},
+						{1084, 10, 0, 0, 2054, 3, 0}, {1830, 9, 0, 0, 4206, 3, 0}, {1046, 6, 1, 2675, 1614, 3, 0}, {1070, 5, 0, 0, 4031, 3, 0},
+						{1046, 6, 0, 0, 4209, 3, 0}, {273, 3, 0, 0, 4212, 3, 0}, {826, 5, 0, 0, 4025, 3, 0}, {273, 3, 0, 0, 4215, 3, 0},
+						{861, 5, 0, 0, 3354, 5, 0}, {273, 3, 0, 0, 4218, 5, 0}, {826, 5, 0, 0, 4037, 3, 0}, {826, 5, 0, 0, 2257, 3, 0},
+						{840, 7, 0, 0, 2298, 3, 0}, {847, 4, 0, 0, 3319, 5, 0}, {851, 10, 0, 0, 3367, 5, 0}, {861, 5, 0, 0, 2260, 3, 0},
+						{273, 3, 0, 0, 4223, 5, 0}, {826, 5, 0, 0, 3410, 3, 0}, {2260, 4, 1, 2676, 4228, 5, 0}, {2264, 6, 1, 2677, 4233, 5, 0},
+						{2260, 4, 1, 2678, 2741, 6, 0}, {2356, 6, 3, 2679, 2287, 3, 0}, {2264, 6, 1, 2682, 2747, 6, 0}, {273, 3, 0, 0, 4238, 3, 0},
+						{826, 5, 0, 0, 4123, 3, 0}, {826, 5, 0, 0, 4126, 3, 0}, {30, 1, 0, 0, 4241, 3, 0}, {1806, 3, 0, 0, 504, 3, 0},
+						{273, 3, 0, 0, 2123, 3, 0}, {877, 4, 0, 0, 3760, 1, 0}, {2362, 9, 0, 0, 4244, 3, 0}, {861, 5, 0, 0, 909, 3, 0},
+						{26, 1, 0, 0, 4247, 3, 0}, {27, 1, 0, 0, 4250, 3, 0}, {28, 1, 0, 0, 4253, 3, 0}, {29, 1, 0, 0, 4256, 3, 0},
+						{30, 1, 0, 0, 4259, 3, 0}, {31, 1, 0, 0, 4262, 3, 0}, {32, 1, 0, 0, 4265, 3, 0}, {33, 1, 0, 0, 4268, 3, 0},
+						{29, 1, 0, 0, 4271, 3, 0}, {1118, 4, 0, 0, 3124, 3, 0}, {1689, 4, 0, 0, 4028, 3, 0}, {285, 5, 0, 0, 3597, 3, 0},
+						{1689, 4, 0, 0, 2370, 3, 0}, {285, 5, 0, 0, 2389, 3, 0}, {17, 1, 0, 0, 307, 2, 0}, {18, 1, 0, 0, 735, 3, 0},
+						{2064, 3, 0, 0, 2334, 3, 0}, {193, 4, 0, 0, 2337, 3, 0}, {351, 4, 0, 0, 2342, 3, 0}, {159, 4, 0, 0, 3049, 3, 0},
+						{2371, 3, 0, 0, 2836, 3, 0}, {2374, 4, 0, 0, 3068, 3, 0}, {2378, 4, 0, 0, 3071, 3, 0}, {2156, 1, 0, 0, 1841, 2, 1},
+						{1923, 1, 0, 0, 4274, 3, 0}, {1924, 1, 0, 0, 4277, 2, 1}, {2292, 1, 0, 0, 4279, 3, 0}, {2382, 1, 0, 0, 4282, 3, 0},
+						{2294, 1, 0, 0, 4285, 3, 0}, {1923, 1, 0, 0, 4288, 3, 0}, {2292, 1, 0, 0, 4291, 3, 0}, {1924, 1, 0, 0, 4294, 2, 1},
+						{2292, 1, 0, 0, 4296, 3, 0}, {2294, 1, 0, 0, 4299, 3, 0}, {2382, 1, 0, 0, 4302, 3, 0}, {2294, 1, 0, 0, 4305, 3, 0},
+						{37, 1, 0, 0, 4308, 3, 0}, {29, 1, 0, 0, 4311, 3, 0}, {46, 1, 0, 0, 4314, 3, 0}, {44, 1, 0, 0, 2054, 3, 0},
+						{43, 1, 0, 0, 4317, 3, 0}, {2288, 3, 0, 0, 1994, 3, 0}, {2383, 4, 0, 0, 1956, 3, 0}, {26, 1, 0, 0, 3375, 3, 0},
+						{27, 1, 0, 0, 4320, 3, 0}, {28, 1, 0, 0, 4323, 3, 0}, {26, 1, 0, 0, 3378, 3, 0}, {27, 1, 0, 0, 4326, 3, 0},
+						{28, 1, 0, 0, 4329, 3, 0}, {120, 2, 0, 0, 3395, 5, 0}, {120, 2, 1, 2683, 4055, 3, 0}, {120, 2, 1, 2684, 4063, 3, 0},
+						{2143, 6, 0, 0, 3524, 3, 0}, {1284, 3, 0, 0, 3521, 3, 0}, {1273, 3, 0, 0, 3527, 3, 0}, {29, 1, 0, 0, 4332, 3, 0},
+						{46, 1, 0, 0, 4335, 3, 0}, {120, 2, 0, 0, 4123, 3, 0}, {120, 2, 0, 0, 4126, 3, 0}, {120, 2, 1, 2685, 3664, 3, 0},
+						{1283, 3, 1, 2686, 4135, 3, 0}, {27, 1, 0, 0, 4338, 3, 0}, {41, 1, 0, 0, 4341, 3, 0}, {120, 2, 1, 2687, 3685, 3, 0},
+						{1283, 3, 1, 2688, 4159, 3, 0}, {27, 1, 0, 0, 4344, 3, 0}, {41, 1, 0, 0, 4347, 3, 0}, {120, 2, 0, 0, 4025, 3, 0},
+						{120, 2, 0, 0, 3472, 3, 0}, {2387, 7, 1, 2689, 4179, 6, 0}, {2394, 7, 1, 2690, 4191, 6, 0}, {1689, 4, 0, 0, 880, 3, 0},
+						{285, 5, 0, 0, 890, 3, 0}, {1070, 5, 0, 0, 2769, 3, 0}, {1084, 10, 0, 0, 2763, 3, 0}, {273, 3, 0, 0, 4350, 3, 0},
+						{826, 5, 0, 0, 3428, 3, 0}, {826, 5, 0, 0, 3431, 3, 0}, {826, 5, 0, 0, 4055, 3, 0}, {826, 5, 0, 0, 3416, 5, 0},
+						{851, 10, 0, 0, 3413, 3, 0}, {861, 5, 0, 0, 4353, 5, 0}, {826, 5, 0, 0, 4063, 3, 0}, {42, 1, 0, 0, 4050, 5, 0},
+						{42, 1, 0, 0, 4058, 5, 0}, {42, 1, 0, 0, 3658, 3, 0}, {42, 1, 0, 0, 4132, 3, 0}, {42, 1, 0, 0, 3682, 3, 0},
+						{42, 1, 0, 0, 4156, 3, 0}, {42, 1, 0, 0, 4173, 6, 0}, {42, 1, 0, 0, 4185, 6, 0}
+					};
+					return table;
+				}
+
+				static const char* labels() {
+					return
+						"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyzEligMPacutebrevefrgr"
+						"avelphamacrndpplyFunctionringtildeumlcyopfscrumpeqHcyOPYdotirclelorossup"
+						"JcyScyZcyNGTHlementpsilonqutailledammareaterARDcycircilbertSpaceEcyJligO"
+						"cyukcyappamidotinusPlusdblacpenCurlyverartialDlusMinusUOTBarrEGhoightrig"
+						"htarrowuleDelayedOFTcyhortigmamallCircleHORNRADEripleDotDashbardashvdash"
+						"edgeAcyIcyUcyeligNotbrkdquokarowprimelubstdotylctyArrHarharjcywanglealli"
+						"ngdotseqemaleiligjlignofpartintksprodquestmathgreenhcyDDoteasuredanglenp"
+						"lusRightarrowvbaruncspmoustnmidrarruluharbquolarrzligelrecltrinsuproprtr"
+						"izigzagdtrimapnisveewedgeicyigrarrgonsignckslashcausernoullisyleysaroned"
+						"ilonintdillanterDotTimesckwiseContourIntegralseCurlyunterClockwiseContou"
+						"rIntegralCapotrahdggerfferentialDublewntrokptyilibriumistsponentialESmal"
+						"lSquareVerySmallSquarerAlluriertrfEqualFullEqualGreaterLessSlantEqualTil"
+						"decekrizontalLineDownHumppliesvisibleercymbdaplacetrffteftarrowwerdiumSp"
+						"acellintrfgativestedwLineBreaknBreakingSpaceegaicronDoubleQuoteParenthes"
+						"isincareplaneecedesverseCeilingFloorUpVectorundImpliesCHcyDownArrowLeftA"
+						"rrowRightArrowUpArrowderEquilibriumTeedownarrowperroWidthSpaceacirproxym"
+						"pconintongmptyvtriangleupluswtieemiupseckfnintsciruitdarrlethltaishtgamm"
+						"aornllarublebarwedgebkarowsterolonintersvparsltnssimlParertneqqnEirsplfm"
+						"iltartslliprconearowwarowmthtrbarbullphenxclnfinotapedodotemptyvgranblkc"
+						"ornerhardoparrowtimesaquohreedsharrkerommadelstposltimapturquivxistolint"
+						"qsulgHarrinfinsolderpigofslopecntiodtenkmmattchforkintintcueureldicldhar"
+						"singdotseqachepolintswarxtarpeparslftcyetmnmiletarfccnwarrgetpeziumixtoh"
+						"eadharpoonuparrowsngrtierpeathqcupnjitalDifferentialDgruentroductcritica"
+						"lmondVerticalBarBreveginaryICommaleftMediumSpaceThiVeryThinSpaceGreaterG"
+						"reaterLessLessDoubleVerticalBarNestedPrecedesracportiontlUpEquilibriumng"
+						"leBracketubleBracketDownVectorTeeVectorIntersectionSuUnionsetceedshThate"
+						"rsetreforeckSpaceocirfsymandmsdzarrcongepsilonween134tomboxminushsubbrcu"
+						"psmerdotmarkbrcapvearrowideonxsquaredownarrowsectationonentialeslantless"
+						"dcyleftarrowlarhkusharleftarrowsthreetimesmapstoastengeallelparalleltrie"
+						"kvtwoernionsrightarrowssquigarrowllsetminusshpaightmultapproxcurlyeq2nsp"
+						"botsbkappanothingbnAcuteGraveRightVectorongruentupCapxistsftTriangleever"
+						"seElementightTrianglequareSubsetpersetlozengesuitontimesgtr4578qlessline"
+						"gersrcalharpoonsesealarsurfnalsphiroptohetaubleAcutecceedsSeparatorxespr"
+						"ecsucc6qgtrbsetneqpsetneq";
+				}
+
+				static const char* values() {
+					return
+						"\303\206&\303\201\304\202\360\235\224\204\303\200\316\221\304\200\342"
+						"\251\223\342\201\241\303\205\303\203\303\204\320\221\360\235\224\205\360"
+						"\235\224\271\313\230\342\204\254\342\211\216\320\247\302\251\304\212\342"
+						"\204\255\316\247\342\250\257\360\235\222\236\342\213\223\342\205\205\320"
+						"\202\320\205\320\217\342\210\207\360\235\224\207\305\212\303\220\303\211"
+						"\304\226\360\235\224\210\303\210\342\210\210\316\225\316\227\303\213\320"
+						"\244\360\235\224\211\342\204\261\320\203>\316\223\304\236\304\240\360"
+						"\235\224\212\342\213\231\360\235\224\276\360\235\222\242\342\211\253\320"
+						"\252\304\244\342\204\214\342\204\213\320\225\304\262\320\201\303\215\304"
+						"\260\342\204\221\303\214\342\204\220\304\250\360\235\224\215\360\235\225"
+						"\201\320\204\320\245\320\214\316\232\360\235\224\216\360\235\225\202\360"
+						"\235\222\246\320\211<\360\235\224\217\342\213\230\304\277\342\211\252"
+						"\342\244\205\320\234\360\235\224\220\342\210\223\360\235\225\204\342\204"
+						"\263\316\234\320\212\305\203\360\235\224\221\360\235\222\251\303\221\316"
+						"\235\305\222\303\223\305\220\360\235\224\222\303\222\360\235\225\206\342"
+						"\251\224\303\226\342\210\202\320\237\360\235\224\223\316\246\316\240\302"
+						"\261\342\252\273\042\360\235\224\224\342\204\232\360\235\222\254\342\244"
+						"\220\302\256\342\204\234\316\241\342\207\233\342\247\264\320\254\305\232"
+						"\342\252\274\360\235\224\226\316\243\342\210\230\360\235\225\212\360\235"
+						"\222\256\342\213\206\303\236\342\204\242\360\235\224\227\342\210\274\360"
+						"\235\225\213\342\203\233\305\260\360\235\224\230\303\231\305\252\305\256"
+						"\360\235\222\260\305\250\303\234\342\212\253\342\253\253\320\222\342\212"
+						"\251\360\235\224\231\360\235\225\215\360\235\222\261\342\212\252\305\264"
+						"\342\213\200\360\235\224\232\360\235\225\216\360\235\222\262\360\235\224"
+						"\233\316\236\360\235\225\217\360\235\222\263\320\257\320\207\320\256\303"
+						"\235\360\235\224\234\360\235\225\220\360\235\222\264\305\270\320\226\305"
+						"\271\305\273\342\204\250\342\204\244\360\235\222\265\303\241\304\203\342"
+						"\210\276\303\246\303\240\342\211\210\303\245\303\243\303\244\342\253\255"
+						"\342\216\265\342\200\236\360\235\224\237\342\244\215\342\200\265\304\213"
+						"\360\235\224\240\342\227\213\342\231\243\342\213\257\342\214\255\342\207"
+						"\223\342\245\245\342\205\206\321\222\342\246\246\304\227\342\205\207\342"
+						"\252\232\342\252\231\342\211\222\321\204\342\231\200\357\254\201fj\306"
+						"\222\342\250\215\360\235\222\273\342\211\247\304\237\304\241\342\211\245"
+						"\360\235\224\244\342\204\267\321\223\342\211\267\360\235\225\230`\342"
+						"\207\224\342\204\217\304\245\360\235\224\245\303\255\342\201\243\303\254"
+						"\342\205\210\304\263\342\250\274\302\277\342\201\242\360\235\224\247\310"
+						"\267\360\235\225\233\321\224\316\272\360\235\224\250\304\270\321\205\321"
+						"\234\360\235\225\234\360\235\223\200\342\244\216\342\211\246\342\245\242"
+						"\342\211\244\342\211\266\321\231(\342\210\272\342\200\224\342\210\241"
+						"\360\235\224\252\342\204\247\316\274\342\207\217\342\200\223\342\211\240"
+						"\360\235\224\253\342\210\213\321\232\342\210\244\316\275\342\223\210\305"
+						"\223\342\210\256\360\235\225\240\342\210\250\303\266\342\214\275\342\210"
+						"\245\320\277\360\235\224\255\317\200\342\211\272\342\200\210\360\235\224"
+						"\256\342\250\214\360\235\225\242\342\201\227\360\235\223\206\342\244\217"
+						"\342\245\244\342\216\261\342\253\256\342\207\211\342\245\250\342\204\236"
+						"\305\233\342\200\232\342\211\273\342\213\205\360\235\224\260\342\206\220"
+						"\342\206\222\303\237\342\216\264\342\214\225\360\235\224\261\342\200\264"
+						"\342\207\221\342\245\243\303\271\360\235\223\212\342\246\247\342\207\225"
+						"\342\253\250\342\212\250\320\262\342\212\242\360\235\224\263\342\212\262"
+						"\360\235\225\247\342\210\235\342\212\263\342\246\232\305\265\360\235\224"
+						"\264\360\235\225\250\342\204\230\342\211\200\360\235\223\214\342\226\275"
+						"\360\235\224\265\316\276\342\237\274\342\213\273\342\213\201\302\245\360"
+						"\235\224\266\321\227\360\235\225\252\360\235\223\216\305\272\305\274\360"
+						"\235\224\267\320\266\342\207\235\360\235\225\253\360\235\223\217\303\202"
+						"\320\220\304\204\360\235\224\270\360\235\222\234\342\211\224\342\210\226"
+						"\342\210\265\316\222\304\206\342\213\222\304\214\303\207\304\210\342\210"
+						"\260\302\270\302\267\342\212\231\342\212\226\342\212\225\342\212\227\342"
+						"\210\262\342\210\267\342\210\263\342\211\215\342\244\221\342\200\241\342"
+						"\206\241\342\253\244\304\216\320\224\316\224\360\235\224\273\302\250\360"
+						"\235\222\237\304\220\304\232\303\212\320\255\304\222\304\230\360\235\224"
+						"\274\342\251\265\342\207\214\342\204\260\342\251\263\342\210\203\342\227"
+						"\274\342\226\252\360\235\224\275\342\210\200\317\234\304\242\304\234\320"
+						"\223\342\252\242\342\251\276\342\211\263\313\207^\342\204\215\342\224"
+						"\200\304\246\342\211\217\303\216\320\230\342\207\222\342\210\254\304\256"
+						"\360\235\225\200\316\231\320\206\303\217\304\264\320\231\360\235\222\245"
+						"\320\210\304\266\320\232\304\271\316\233\342\237\252\342\204\222\342\206"
+						"\236\304\275\304\273\320\233\342\207\232\360\235\225\203\342\206\260\305"
+						"\201\342\201\237\305\207\305\205\320\235\012\342\201\240\302\240\342\204"
+						"\225\342\253\254\303\224\320\236\305\214\316\251\316\237\342\200\234\342"
+						"\200\230\360\235\222\252\303\230\303\225\342\250\267\342\217\234\342\204"
+						"\231\342\200\263\360\235\222\253\316\250\305\224\342\237\253\342\206\240"
+						"\305\230\305\226\320\240\342\214\211\342\214\213\342\207\200\342\204\235"
+						"\342\245\260\342\204\233\342\206\261\320\251\320\250\305\240\305\236\305"
+						"\234\320\241\342\206\223\342\206\221\342\210\232\342\226\241\342\213\220"
+						"\342\210\221\342\213\221\320\213\320\246\011\316\244\305\244\305\242\320"
+						"\242\342\211\203\342\211\205\360\235\222\257\305\246\303\232\342\206\237"
+						"\320\216\305\254\303\233\320\243\342\213\203\305\262\360\235\225\214\342"
+						"\206\225\342\245\256\342\212\245\317\222\342\253\246\305\266\320\253\305"
+						"\275\320\227\342\200\213\316\226\342\210\276\314\263\342\210\277\303\242"
+						"\302\264\320\260\360\235\224\236\316\261\342\210\247\342\210\240\304\205"
+						"\360\235\225\222\342\251\260\342\251\257\342\211\212\342\211\213'\360"
+						"\235\222\266*\342\250\221\342\216\266\342\211\214\320\261\342\246\260"
+						"\317\266\342\250\204\342\226\210=\342\203\245\342\214\220\360\235\225"
+						"\223\342\213\210\302\246\360\235\222\267\342\201\217\342\210\275\134\342"
+						"\200\242\304\207\342\210\251\303\247\304\211\342\251\214\342\246\262\302"
+						"\242\321\207\342\234\223\317\207\342\247\203\313\206\342\211\227\342\250"
+						"\220\342\253\257\342\247\202:\342\206\265\342\234\227\360\235\222\270"
+						"\342\206\266\342\210\252\342\213\216\342\213\217\342\210\261\342\200\240"
+						"\342\204\270\342\200\220\313\235\304\217\320\264\342\251\267\302\260\316"
+						"\264\342\246\261\342\245\277\360\235\224\241\342\207\203\342\207\202\342"
+						"\213\204\317\235\342\213\262\303\267\342\214\236\342\214\215$\360\235"
+						"\225\225\313\231\342\214\206\342\247\266\304\221\342\213\261\342\226\277"
+						"\342\207\265\342\245\257\321\237\342\237\277\342\211\221\303\251\342\251"
+						"\256\304\233\342\211\226\342\211\225\321\215\360\235\224\242\303\250\342"
+						"\252\226\342\217\247\342\204\223\342\252\225\304\223\342\210\205\342\200"
+						"\203\305\213\342\200\202\304\231\360\235\225\226\342\213\225\342\251\261"
+						"\316\265\342\247\245\342\211\223\342\245\261\342\204\257\342\211\220\342"
+						"\211\202\316\267\303\260\303\253\342\202\254!\357\254\203\360\235\224"
+						"\243\342\231\255\357\254\202\342\226\261\360\235\225\227\342\214\242\342"
+						"\252\214\307\265\316\263\342\252\206\304\235\320\263\342\213\233\342\252"
+						"\222\342\252\245\342\252\244\342\211\251\342\252\212\342\252\210\342\213"
+						"\247\342\204\212\342\213\227\342\246\225\342\251\274\342\211\251\357\270"
+						"\200\342\200\212\302\275\342\231\245\342\200\246\342\212\271\342\244\245"
+						"\342\244\246\342\207\277\342\210\273\360\235\225\231\342\200\225\360\235"
+						"\222\275\304\247\342\201\203\303\256\320\270\320\265\302\241\360\235\224"
+						"\246\342\247\234\342\204\251\342\212\267\306\265\342\204\205\342\210\236"
+						"\304\261\342\210\253\321\221\304\257\360\235\225\232\316\271\360\235\222"
+						"\276\304\251\321\226\303\257\304\265\320\271\360\235\222\277\321\230\317"
+						"\260\304\267\320\272\342\207\220\342\244\233\342\252\213\304\272\342\246"
+						"\264\316\273\342\237\250\342\252\205\302\253\342\252\253\342\244\214\342"
+						"\235\262\304\276{\320\273\342\244\266\342\206\262\342\213\232\342\251"
+						"\275\342\245\274\342\214\212\360\235\224\251\342\252\221\342\226\204\342"
+						"\207\207\342\245\253\342\227\272\305\200\342\216\260\342\211\250\342\252"
+						"\211\342\252\207\342\213\246\342\237\246\342\250\264\342\227\212\342\246"
+						"\223\342\207\206\342\214\237\342\207\213\342\200\216\342\212\277\342\200"
+						"\271\360\235\223\201\342\211\262\305\202\342\213\226\342\213\213\342\213"
+						"\211\342\245\266\342\251\273\342\245\212\342\245\246\342\211\250\357\270"
+						"\200\302\257\342\206\246\342\226\256\342\250\251\320\274\302\265\342\210"
+						"\243\342\210\222\342\253\233\342\212\247\360\235\225\236\360\235\223\202"
+						"\342\212\270\342\213\231\314\270\342\211\253\342\203\222\342\213\230\314"
+						"\270\342\211\252\342\203\222\342\212\257\342\212\256\305\204\342\210\240"
+						"\342\203\222\342\211\211\342\231\256\342\211\216\314\270\305\206\342\211"
+						"\207\342\251\202\320\275\342\207\227\342\211\220\314\270\342\211\242\342"
+						"\210\204\342\211\247\314\270\342\211\261\342\211\265\342\211\257\342\207"
+						"\216\342\206\256\342\253\262\342\213\274\342\207\215\342\211\246\314\270"
+						"\342\206\232\342\200\245\342\211\260\342\211\264\342\211\256\360\235\225"
+						"\237\302\254\342\210\246\342\250\224\342\212\200\342\206\233\342\213\253"
+						"\342\212\201\342\211\201\342\211\271\303\261\342\211\270#\342\212\255"
+						"\342\244\204\342\211\215\342\203\222\342\212\254\342\247\236\342\210\274"
+						"\342\203\222\342\207\226\342\244\247\303\263\342\212\233\342\212\232\320"
+						"\276\342\212\235\305\221\342\250\270\342\246\274\342\246\277\360\235\224"
+						"\254\313\233\303\262\342\247\201\342\246\265\342\206\272\342\200\276\342"
+						"\247\200\305\215\317\211\342\246\267\342\246\271\342\206\273\342\251\235"
+						"\342\212\266\342\251\226\342\251\227\342\251\233\342\204\264\303\270\342"
+						"\212\230\303\265\302\266%.\342\200\260\342\200\261\317\206\342\230\216"
+						"\342\213\224\317\226+\342\250\225\360\235\225\241\302\243\342\252\263"
+						"\342\252\267\342\211\274\342\252\257\342\200\262\342\211\276\342\212\260"
+						"\360\235\223\205\317\210\077\342\244\234\342\246\263\342\237\251\302\273"
+						"\342\235\263\305\231}\321\200\342\244\267\342\245\251\342\200\235\342"
+						"\206\263\342\226\255\342\245\275\360\235\224\257\317\201\313\232\342\207"
+						"\204\342\200\217\342\237\247\342\250\265)\342\250\222\342\200\272\360"
+						"\235\223\207\342\213\214\342\213\212\342\226\271\342\252\264\342\211\275"
+						"\342\252\260\305\235\342\250\223\342\211\277\321\201\342\212\241\342\251"
+						"\246\342\207\230\302\247;\342\244\251\342\234\266\342\231\257\302\255"
+						"\317\203\342\247\244\342\252\252\321\214/\360\235\225\244\342\231\240"
+						"\360\235\223\210\342\214\243\342\230\206\342\212\202\342\231\252\342\212"
+						"\203\342\207\231\342\244\252\342\214\226\317\204\305\245\305\243\321\202"
+						"\303\276\313\234\303\227\342\210\255\342\244\250\342\212\244\342\217\242"
+						"\321\233\305\247\342\211\254\303\272\321\236\305\255\303\273\321\203\342"
+						"\207\205\305\261\342\245\276\360\235\224\262\342\226\200\342\227\270\305"
+						"\253\305\263\360\235\225\246\342\212\216\317\205\342\207\210\305\257\342"
+						"\227\271\342\213\260\305\251\342\226\265\303\274\342\253\251\342\246\234"
+						"\342\213\256\342\212\202\342\203\222\342\212\203\342\203\222\360\235\223"
+						"\213\342\213\202\342\227\257\342\237\272\342\237\267\342\237\270\342\237"
+						"\265\342\250\200\342\250\202\342\237\271\342\237\266\360\235\223\215\342"
+						"\250\206\342\226\263\303\275\321\217\305\267\321\213\321\216\303\277\305"
+						"\276\320\267\316\266\342\200\215\342\200\214\342\253\247\342\200\231\342"
+						"\251\264\342\211\241\342\210\257\342\204\202\342\210\220\342\203\234\314"
+						"\221\342\227\273\342\226\253\304\252\342\214\210\342\206\274\342\252\241"
+						"\342\206\231\342\206\230\342\210\217\342\244\226\342\245\217\342\245\234"
+						"\342\206\276\342\245\223\342\212\223\342\212\224\342\210\264\316\230\342"
+						"\201\237\342\200\212\342\200\211\342\245\211\342\217\235\342\244\222\342"
+						"\206\245\342\206\226\342\206\227\316\245\342\200\226\342\204\265\304\201"
+						"\342\250\277\342\251\225\342\251\234\342\251\230\342\251\232\342\246\244"
+						"\342\210\237\342\215\274\342\212\275\342\214\205\316\262\342\204\266\342"
+						"\250\201\342\230\205\342\220\243\342\226\223\342\211\241\342\203\245\342"
+						"\225\220\342\225\221\342\247\211\342\212\237\342\212\236\342\212\240\342"
+						"\224\202\342\213\215\342\247\205\342\237\210\342\252\256\342\251\204\342"
+						"\251\211\342\251\200\342\210\251\357\270\200\342\201\201\342\251\215\304"
+						"\215\342\251\220,\342\210\201\360\235\225\224\342\253\217\342\253\220"
+						"\342\244\270\342\244\265\342\213\236\342\213\237\342\244\275\342\251\210"
+						"\342\212\215\342\251\205\342\210\252\357\270\200\342\206\267\302\244\342"
+						"\212\243\342\207\212\342\231\246\342\213\207\342\210\270\342\210\224\342"
+						"\214\214\360\235\222\271\321\225\342\226\276\303\252\342\252\230\342\252"
+						"\227\342\247\243\317\265\342\211\237\357\254\200\357\254\204\342\201\204"
+						"\342\252\251\342\252\200\342\213\233\357\270\200\342\252\216\342\252\220"
+						"\342\252\247\342\251\272\321\212\342\206\224\342\206\251\342\206\252\304"
+						"\253\342\247\235\342\212\272\342\250\227\342\213\271\342\213\265\342\213"
+						"\264\342\246\221\342\207\244\342\244\235\342\206\253\342\244\271\342\245"
+						"\263\342\206\242\342\244\231\342\252\255\304\274\342\245\247\342\245\213"
+						"\342\252\250\342\251\277\342\213\232\357\270\200\342\206\275\342\237\254"
+						"\342\207\275\342\206\254\342\246\205\360\235\225\235\342\250\255\342\210"
+						"\227_\342\247\253\342\245\255\342\252\215\342\252\217[\342\252\246\342"
+						"\251\271\342\246\226\342\227\203\342\231\202\342\234\240\342\253\260\342"
+						"\211\253\314\270\342\211\252\314\270\342\251\260\314\270\342\211\213\314"
+						"\270\305\211\342\211\217\314\270\342\251\203\305\210\342\251\255\314\270"
+						"\342\244\244\342\211\202\314\270\342\251\276\314\270\342\213\272\342\251"
+						"\275\314\270\342\213\252\342\210\211\342\210\214\342\253\275\342\203\245"
+						"\342\210\202\314\270\342\213\240\342\252\257\314\270\342\244\263\314\270"
+						"\342\206\235\314\270\342\213\255\342\213\241\342\252\260\314\270\360\235"
+						"\223\203\342\211\204\342\213\242\342\213\243\342\212\204\342\212\205\342"
+						"\204\226\342\200\207\342\211\245\342\203\222>\342\203\222\342\244\202"
+						"\342\211\244\342\203\222<\342\203\222\342\244\203\342\212\265\342\203"
+						"\222\342\244\243\303\264\342\246\276\342\246\273\316\277\342\246\266\302"
+						"\252\302\272\342\250\266\342\253\263\317\225\342\250\243\342\250\242\342"
+						"\251\262\342\250\246\342\250\247\342\252\265\342\252\271\342\213\250\342"
+						"\250\226\342\210\275\314\261\305\225\342\246\222\342\246\245\342\245\265"
+						"\342\207\245\342\244\236\342\245\205\342\245\264\342\206\243\342\244\232"
+						"\342\210\266\305\227\342\207\201\317\261\342\237\255\342\207\276\342\246"
+						"\206\360\235\225\243\342\250\256\342\246\224]\342\226\270\342\247\216"
+						"\342\252\270\305\241\305\237\342\252\266\342\252\272\342\213\251\321\211"
+						"\321\210\317\202\342\251\252\342\252\236\342\252\235\342\211\206\342\250"
+						"\244\342\245\262\342\250\263\342\252\254\342\247\204\342\212\217\342\212"
+						"\220\342\253\205\342\252\275\342\212\206\342\253\201\342\252\277\342\245"
+						"\271\302\271\302\262\302\263\342\253\206\342\212\207\342\245\273\342\253"
+						"\202\342\253\200\316\270\342\250\260\342\214\266\342\253\261\360\235\225"
+						"\245\342\227\254\342\211\234\342\250\272\342\250\271\342\247\215\342\250"
+						"\273\360\235\223\211\321\206\342\206\277\342\214\234\342\214\217\342\214"
+						"\235\342\214\216\342\226\264\342\212\273\342\211\232|\342\251\237\360"
+						"\235\225\251\342\244\223\342\245\220\342\245\236\342\245\237\342\206\247"
+						"\342\245\216\342\245\221\342\245\240\342\245\222\342\211\255\342\252\242"
+						"\314\270\342\252\241\314\270\342\217\236\342\245\235\342\245\233\342\247"
+						"\220\342\245\224\342\212\276\342\210\242\342\226\222\342\226\221\342\225"
+						"\227\342\225\224\342\225\226\342\225\223\342\225\246\342\225\251\342\225"
+						"\244\342\225\247\342\225\235\342\225\232\342\225\234\342\225\231\342\225"
+						"\254\342\225\243\342\225\240\342\225\253\342\225\242\342\225\237\342\225"
+						"\225\342\225\222\342\224\220\342\224\214\342\225\245\342\225\250\342\224"
+						"\254\342\224\264\342\225\233\342\225\230\342\224\230\342\224\224\342\225"
+						"\252\342\225\241\342\225\236\342\224\274\342\224\244\342\224\234\342\251"
+						"\213\342\251\207@\342\204\227\342\253\221\342\253\222\342\251\206\342"
+						"\251\212\342\244\274\342\200\204\342\200\205\342\251\270\342\253\231\342"
+						"\205\230\342\205\236\342\252\202\342\252\224\342\245\270\342\245\210\342"
+						"\206\255\342\213\263\342\244\237\342\252\255\357\270\200\342\246\213\342"
+						"\252\201\342\252\223\342\245\252\342\212\264\342\227\202\342\206\244\342"
+						"\250\252\342\213\254\342\213\271\314\270\342\213\265\314\270\342\253\205"
+						"\314\270\342\212\210\342\253\206\314\270\342\212\211\342\212\264\342\203"
+						"\222\342\204\216\342\250\245\342\214\256\342\214\222\342\214\223\342\244"
+						"\240\342\246\214\342\245\254\342\252\240\342\252\237\342\252\254\357\270"
+						"\200\342\214\277\342\212\223\357\270\200\342\212\224\357\270\200\342\212"
+						"\221\342\212\222\342\253\203\342\253\213\342\212\212\342\253\207\342\252"
+						"\276\342\253\230\342\253\204\342\237\211\342\253\227\342\253\214\342\212"
+						"\213\342\253\210\317\221\342\250\261\342\253\232\342\253\213\357\270\200"
+						"\342\212\212\357\270\200\342\253\214\357\270\200\342\212\213\357\270\200"
+						"\342\211\231\342\245\226\342\245\227\342\245\241\342\245\232\342\247\217"
+						"\342\245\230\342\247\217\314\270\342\247\220\314\270\342\212\217\314\270"
+						"\342\212\220\314\270\342\245\225\342\217\237\342\235\230\342\246\250\342"
+						"\246\251\342\246\252\342\246\253\342\246\254\342\246\255\342\246\256\342"
+						"\246\257\342\246\235\342\205\223\302\274\342\205\225\342\205\231\342\205"
+						"\233\342\205\224\342\205\226\302\276\342\205\227\342\205\234\342\205\232"
+						"\342\205\235\342\252\204\342\246\217\342\246\215\342\252\203\342\213\267"
+						"\342\213\266\342\213\276\342\213\275\342\246\216\342\246\220\342\253\225"
+						"\342\253\223\342\253\224\342\253\226\342\245\231\342\211\277\314\270";
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_CHARREF_H_ */
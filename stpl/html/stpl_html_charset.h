@@ -0,0 +1,341 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_CHARSET_H_
+#define STPL_HTML_CHARSET_H_
+
+#include <string>
+
+#include "stpl_html_lexer.h"
+#include "../../utils/charset_converter.h"
+
+/**
+ * Finding the character encoding of an HTML page and turning the page into
+ * UTF-8 for the parsers
+ *
+ * The encoding comes from, in this order, a byte order mark, an external hint
+ * (the charset of the HTTP Content-Type), and a <meta charset> or
+ * <meta http-equiv="Content-Type"> in the first 1024 bytes. Labels are mapped
+ * to the iconv names of the encodings browsers actually use for them
+ * (ISO-8859-1 is windows-1252, GB2312 is GBK, Shift_JIS is CP932, ...).
+ */
+namespace stpl {
+	namespace HTML {
+
+		class CharsetSniffer {
+			public:
+				enum Source {
+					CHARSET_DEFAULT,
+					CHARSET_BOM,
+					CHARSET_HINT,
+					CHARSET_META
+				};
+
+				enum { PRESCAN_LENGTH = 1024 };
+
+			public:
+				/**
+				 * @brief the iconv name of the encoding of the page, with where it
+				 * comes from and the length of the byte order mark to skip
+				 *
+				 * without any information, UTF-8 is assumed if the page is valid
+				 * UTF-8 and windows-1252 otherwise
+				 */
+				static std::string sniff(const char* data, size_t len, const std::string& hint,
+						Source& source, size_t& bom_length) {
+					std::string charset = bom(data, len, bom_length);
+					if (!charset.empty()) {
+						source = CHARSET_BOM;
+						return charset;
+					}
+
+					if (!hint.empty()) {
+						charset = normalize(hint.data(), hint.length());
+						if (!charset.empty()) {
+							source = CHARSET_HINT;
+							return charset;
+						}
+					}
+
+					charset = prescan(data, std::min(len, (size_t) PRESCAN_LENGTH));
+					if (!charset.empty()) {
+						source = CHARSET_META;
+						return charset;
+					}
+
+					source = CHARSET_DEFAULT;
+					return is_valid_utf8(data, len) ? "UTF-8" : "WINDOWS-1252";
+				}
+
+				static std::string sniff(const char* data, size_t len, const std::string& hint = "") {
+					Source source;
+					size_t bom_length;
+					return sniff(data, len, hint, source, bom_length);
+				}
+
+				static std::string bom(const char* data, size_t len, size_t& bom_length) {
+					const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+					bom_length = 0;
+					if (len >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) {
+						bom_length = 3;
+						return "UTF-8";
+					}
+					if (len >= 2 && p[0] == 0xFE && p[1] == 0xFF) {
+						bom_length = 2;
+						return "UTF-16BE";
+					}
+					if (len >= 2 && p[0] == 0xFF && p[1] == 0xFE) {
+						bom_length = 2;
+						return "UTF-16LE";
+					}
+					return "";
+				}
+
+				/**
+				 * @brief the encoding declared by a meta element in [data, data + len)
+				 */
+				static std::string prescan(const char* data, size_t len) {
+					const char* p = data;
+					const char* end = data + len;
+					while (p < end) {
+						const char* lt = utils::find_char(p, end, '<');
+						if (lt == end)
+							break;
+
+						LexedTag tag;
+						if (HtmlLexer::markup(lt, end, tag, p) != HtmlLexer::MARKUP_TAG
+								|| tag.end_tag || tag.info->id != TAG_META)
+							continue;
+
+						std::string charset = meta_charset(tag);
+						if (!charset.empty()) {
+							// a page that says it is UTF-16 in ASCII can't be UTF-16
+							if (charset.compare(0, 6, "UTF-16") == 0)
+								return "UTF-8";
+							return charset;
+						}
+					}
+					return "";
+				}
+
+				/**
+				 * @brief the charset parameter of a Content-Type value,
+				 * "text/html; charset=gb2312" for example
+				 */
+				static std::string content_type_charset(const char* p, const char* end) {
+					while (end - p >= 7) {
+						if (!utils::ascii_iequals(p, "charset", 7)) {
+							++p;
+							continue;
+						}
+						p += 7;
+						while (p < end && HtmlLexer::is_space(*p))
+							++p;
+						if (p >= end || *p != '=')
+							continue;
+						++p;
+						while (p < end && HtmlLexer::is_space(*p))
+							++p;
+
+						const char* value;
+						const char* value_end;
+						if (p < end && (*p == '"' || *p == '\'')) {
+							value = p + 1;
+							value_end = utils::find_char(value, end, *p);
+						}
+						else {
+							value = p;
+							value_end = p;
+							while (value_end < end && *value_end != ';' && !HtmlLexer::is_space(*value_end))
+								++value_end;
+						}
+						return normalize(value, value_end - value);
+					}
+					return "";
+				}
+
+				static std::string content_type_charset(const std::string& content_type) {
+					return content_type_charset(content_type.data(), content_type.data() + content_type.length());
+				}
+
+				/**
+				 * @brief the iconv name of an encoding label, empty if the label is
+				 * not known
+				 */
+				static std::string normalize(const char* label, size_t len) {
+					static const char* labels[][2] = {
+						{"utf-8", "UTF-8"}, {"utf8", "UTF-8"}, {"unicode-1-1-utf-8", "UTF-8"},
+						{"us-ascii", "WINDOWS-1252"}, {"ascii", "WINDOWS-1252"}, {"iso-8859-1", "WINDOWS-1252"},
+						{"iso8859-1", "WINDOWS-1252"}, {"iso_8859-1", "WINDOWS-1252"}, {"latin1", "WINDOWS-1252"},
+						{"l1", "WINDOWS-1252"}, {"windows-1252", "WINDOWS-1252"}, {"cp1252", "WINDOWS-1252"},
+						{"x-cp1252", "WINDOWS-1252"}, {"ansi_x3.4-1968", "WINDOWS-1252"},
+						{"windows-1250", "WINDOWS-1250"}, {"cp1250", "WINDOWS-1250"},
+						{"windows-1251", "WINDOWS-1251"}, {"cp1251", "WINDOWS-1251"},
+						{"windows-1253", "WINDOWS-1253"}, {"cp1253", "WINDOWS-1253"},
+						{"windows-1254", "WINDOWS-1254"}, {"cp1254", "WINDOWS-1254"}, {"iso-8859-9", "WINDOWS-1254"},
+						{"windows-1255", "WINDOWS-1255"}, {"cp1255", "WINDOWS-1255"},
+						{"windows-1256", "WINDOWS-1256"}, {"cp1256", "WINDOWS-1256"},
+						{"windows-1257", "WINDOWS-1257"}, {"cp1257", "WINDOWS-1257"},
+						{"windows-1258", "WINDOWS-1258"}, {"cp1258", "WINDOWS-1258"},
+						{"windows-874", "CP874"}, {"tis-620", "CP874"}, {"iso-8859-11", "CP874"},
+						{"iso-8859-2", "ISO-8859-2"}, {"iso-8859-3", "ISO-8859-3"}, {"iso-8859-4", "ISO-8859-4"},
+						{"iso-8859-5", "ISO-8859-5"}, {"iso-8859-6", "ISO-8859-6"}, {"iso-8859-7", "ISO-8859-7"},
+						{"iso-8859-8", "ISO-8859-8"}, {"iso-8859-10", "ISO-8859-10"}, {"iso-8859-13", "ISO-8859-13"},
+						{"iso-8859-14", "ISO-8859-14"}, {"iso-8859-15", "ISO-8859-15"}, {"iso-8859-16", "ISO-8859-16"},
+						{"koi8-r", "KOI8-R"}, {"koi8", "KOI8-R"}, {"koi8-u", "KOI8-U"},
+						{"macintosh", "MACINTOSH"}, {"mac", "MACINTOSH"},
+						{"gbk", "GBK"}, {"gb2312", "GBK"}, {"gb_2312", "GBK"}, {"gb_2312-80", "GBK"},
+						{"csgb2312", "GBK"}, {"chinese", "GBK"}, {"x-gbk", "GBK"}, {"cp936", "GBK"},
+						{"gb18030", "GB18030"},
+						{"big5", "BIG5-HKSCS"}, {"big5-hkscs", "BIG5-HKSCS"}, {"cn-big5", "BIG5-HKSCS"},
+						{"csbig5", "BIG5-HKSCS"}, {"x-x-big5", "BIG5-HKSCS"},
+						{"shift_jis", "CP932"}, {"shift-jis", "CP932"}, {"sjis", "CP932"}, {"x-sjis", "CP932"},
+						{"ms_kanji", "CP932"}, {"csshiftjis", "CP932"}, {"windows-31j", "CP932"}, {"cp932", "CP932"},
+						{"euc-jp", "EUC-JP"}, {"x-euc-jp", "EUC-JP"}, {"iso-2022-jp", "ISO-2022-JP"},
+						{"euc-kr", "CP949"}, {"ks_c_5601-1987", "CP949"}, {"korean", "CP949"},
+						{"windows-949", "CP949"}, {"cp949", "CP949"},
+						{"utf-16", "UTF-16LE"}, {"utf-16le", "UTF-16LE"}, {"utf-16be", "UTF-16BE"}
+					};
+
+					while (len > 0 && HtmlLexer::is_space(*label)) {
+						++label;
+						--len;
+					}
+					while (len > 0 && HtmlLexer::is_space(label[len - 1]))
+						--len;
+
+					for (size_t i = 0; i < sizeof(labels) / sizeof(labels[0]); ++i)
+						if (strlen(labels[i][0]) == len && utils::ascii_iequals(label, labels[i][0], len))
+							return labels[i][1];
+					return "";
+				}
+
+			private:
+				static std::string meta_charset(const LexedTag& tag) {
+					TagAttribute attr;
+					std::string charset, content_charset;
+					bool pragma = false;
+					const char* p = tag.attributes;
+					while (HtmlLexer::next_attribute(p, tag.end, attr)) {
+						if (attr.is("charset", 7))
+							charset = normalize(attr.value, attr.value_length);
+						else if (attr.is("http-equiv", 10))
+							pragma = attr.value_length == 12 && utils::ascii_iequals(attr.value, "content-type", 12);
+						else if (attr.is("content", 7))
+							content_charset = content_type_charset(attr.value, attr.value + attr.value_length);
+					}
+					if (!charset.empty())
+						return charset;
+					return pragma ? content_charset : std::string();
+				}
+		};
+
+		/**
+		 * @brief the UTF-8 form of a page for the parsers
+		 *
+		 * A page that is already UTF-8 (or plain ASCII in an ASCII compatible
+		 * encoding) is used in place, anything else is transcoded in chunks into a
+		 * buffer that is kept for the next page.
+		 */
+		class Utf8Decoder {
+			public:
+				enum { CHUNK_SIZE = 64 * 1024 };
+
+			private:
+				Transcoder					transcoder_;
+				std::string					buffer_;
+				std::string					charset_;
+				CharsetSniffer::Source		source_;
+				char*						begin_;
+				char*						end_;
+				bool						converted_;
+
+			public:
+				Utf8Decoder() : begin_(NULL), end_(NULL), converted_(false) {}
+				~Utf8Decoder() {}
+
+				/**
+				 * @brief decode a page, hint is an encoding label from outside the
+				 * page, e.g. the charset of the Content-Type header
+				 *
+				 * @return false if the encoding is not supported, the page is then
+				 * used as it is
+				 */
+				bool decode(const char* data, size_t len, const std::string& hint = "") {
+					size_t bom_length;
+					charset_ = CharsetSniffer::sniff(data, len, hint, source_, bom_length);
+					data += bom_length;
+					len -= bom_length;
+
+					converted_ = false;
+					begin_ = const_cast<char*>(data);
+					end_ = begin_ + len;
+
+					if (charset_ == "UTF-8") {
+						if (is_valid_utf8(data, len))
+							return true;
+					}
+					else if (ascii_compatible(charset_) && is_ascii(data, len))
+						return true;
+
+					if (transcoder_.open(charset_) != GOOD)
+						return false;
+
+					buffer_.clear();
+					buffer_.reserve(len + len / 2);
+					for (size_t pos = 0; pos < len; pos += CHUNK_SIZE) {
+						size_t chunk = std::min((size_t) CHUNK_SIZE, len - pos);
+						transcoder_.convert(data + pos, chunk, buffer_, pos + chunk == len);
+					}
+
+					converted_ = true;
+					begin_ = buffer_.empty() ? NULL : &buffer_[0];
+					end_ = begin_ + buffer_.size();
+					return true;
+				}
+
+				bool decode(const std::string& page, const std::string& hint = "") {
+					return decode(page.data(), page.length(), hint);
+				}
+
+				char* begin() { return begin_; }
+				char* end() { return end_; }
+				size_t length() const { return end_ - begin_; }
+
+				/**
+				 * @brief the iconv name of the encoding of the page
+				 */
+				const std::string& charset() const { return charset_; }
+				CharsetSniffer::Source source() const { return source_; }
+
+				/**
+				 * @brief whether the page was transcoded, rather than used in place
+				 */
+				bool converted() const { return converted_; }
+
+			private:
+				static bool ascii_compatible(const std::string& charset) {
+					return charset.compare(0, 6, "UTF-16") != 0 && charset.compare(0, 8, "ISO-2022") != 0;
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_CHARSET_H_ */
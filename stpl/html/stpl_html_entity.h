@@ -21,7 +21,10 @@
 #define STPL_HTML_ENTITY_H_
 
 #include "../xml/stpl_xml_entity.h"
-#include "../utils/icstring.h"
+#include "../../utils/icstring.h"
+#include "../../utils/simd.h"
+#include "stpl_html_tags.h"
+#include "stpl_html_charref.h"
 
 /**
  * this file is implemented based on HTML specification 4.01,
@@ -42,30 +45,113 @@ namespace stpl {
 				typedef	StringT	string_type;
 				typedef IteratorT	iterator;			
 				
+			private:
+				/**
+				 * the content of these elements is raw text up to their end tag,
+				 * '<' doesn't start a tag in there
+				 */
+				const char*		raw_text_tag_;
+				size_t			raw_text_tag_len_;
+				bool			raw_text_checked_;
+
+				/**
+				 * the text with its character references decoded, only
+				 * filled in when the text has any
+				 */
+				std::string		decoded_;
+				int				decode_state_;
+
+				void init() {
+					raw_text_tag_ = NULL;
+					raw_text_tag_len_ = 0;
+					raw_text_checked_ = false;
+					decode_state_ = NOT_DECODED;
+				}
+
+				enum DecodeState { NOT_DECODED, NO_REFS, DECODED };
+
 			public:
-				Text() : XML::Text<StringT, IteratorT>::Text() {}
+				Text() : XML::Text<StringT, IteratorT>::Text() { init(); }
 				Text(IteratorT it)
-					 : XML::Text<StringT, IteratorT>::Text(it) {}
+					 : XML::Text<StringT, IteratorT>::Text(it) { init(); }
 				Text(IteratorT begin, IteratorT end)
-					 : XML::Text<StringT, IteratorT>::Text(begin, end) {}
+					 : XML::Text<StringT, IteratorT>::Text(begin, end) { init(); }
 				Text(StringT content) {
 					XML::Text<StringT, IteratorT>::Text(content);
+					init();
 				}				
 				virtual ~Text() {}
 				
-			protected:						
-				virtual bool text_stop(IteratorT it) {
-					if (XML::Text<StringT, IteratorT>::text_stop(it)) {
-						IteratorT next = ++it;
-						this->skip_whitespace(next);
+				bool is_raw_text() {
+					if (!raw_text_checked_) {
+						raw_text_checked_ = true;
 						if (this->parent() && this->parent()->type() == XML::TAG) {
 							XML::Element<StringT, IteratorT>* parent = reinterpret_cast<XML::Element<StringT, IteratorT>* >(this->parent());
-							if ( parent->name() == StringT("SCRIPT") && *next != '/')								//&& !(dynamic_cast<XML::Element<StringT, IteratorT>* >(this->parent())->name() == StringT("SCRIPT")))
-								return false;
+							StringT name = parent->name();
+							raw_text_tag_ = raw_text_tag(name.length() > 0 ? &*name.begin() : "", name.length());
+							raw_text_tag_len_ = raw_text_tag_ ? name.length() : 0;
+						}
+					}
+					return raw_text_tag_ != NULL;
+				}
+
+				/**
+				 * @brief the text with the character references decoded, which is
+				 * done on the first call; a text without any '&' is returned as it is
+				 *
+				 * the content of script, style and the like is raw text and never
+				 * decoded, textarea and title are
+				 */
+				StringT decoded() {
+					if (decode_state_ == NOT_DECODED) {
+						decode_state_ = NO_REFS;
+						if (this->begin() != this->end() && !is_raw_text_only()) {
+							const char* begin = &*this->begin();
+							const char* end = begin + (this->end() - this->begin());
+							if (CharRef::has_refs(begin, end)) {
+								decoded_.clear();
+								decoded_.reserve(end - begin);
+								CharRef::decode(begin, end, decoded_);
+								decode_state_ = DECODED;
+							}
+						}
+					}
+					if (decode_state_ == DECODED)
+						return StringT(decoded_.begin(), decoded_.end());
+					return this->to_string();
+				}
+
+				/**
+				 * @brief the lower case name if the element holds raw text, NULL otherwise
+				 */
+				static const char* raw_text_tag(const char* name, size_t len) {
+					const TagInfo& tag = HtmlTags::lookup(name, len);
+					return (tag.properties & TAG_RAW_TEXT) ? tag.name : NULL;
+				}
+
+			private:
+				bool is_raw_text_only() {
+					if (!is_raw_text())
+						return false;
+					HtmlTagId id = HtmlTags::lookup_id(raw_text_tag_, raw_text_tag_len_);
+					return id != TAG_TEXTAREA && id != TAG_TITLE;
+				}
+
+			protected:						
+				/**
+				 * in a raw text element the text runs straight to the end tag of
+				 * the element, which is searched for in one go
+				 */
+				virtual bool is_end(IteratorT& it) {
+					if (is_raw_text()) {
+						if (!this->eow(it)) {
+							const char* begin = &*it;
+							const char* end = begin + (this->end() - it);
+							it += utils::find_end_tag(begin, end, raw_text_tag_, raw_text_tag_len_) - begin;
 						}
 						return true;
 					}
-					return false;
+					return XML::Text<StringT, IteratorT>::is_end(it);
 				}
 		};
 					
@@ -112,9 +198,39 @@ namespace stpl {
 				Attribute(IteratorT begin, IteratorT end) : 
 					XML::XmlAttribute<StringT, IteratorT>::XmlAttribute(begin, end) { init(); }
 				virtual ~Attribute() {}		
+
+				/**
+				 * @brief the value with the character references decoded on the
+				 * first call, a value without any '&' is returned as it is
+				 */
+				StringT decoded_value() {
+					if (!decoded_checked_) {
+						decoded_checked_ = true;
+						const typename XML::XmlAttribute<StringT, IteratorT>::StringB& value = this->get_value();
+						if (value.begin() != value.end()) {
+							const char* begin = &*value.begin();
+							const char* end = begin + (value.end() - value.begin());
+							if ((has_refs_ = CharRef::has_refs(begin, end))) {
+								decoded_.clear();
+								CharRef::decode(begin, end, decoded_, true);
+							}
+						}
+					}
+					if (has_refs_)
+						return StringT(decoded_.begin(), decoded_.end());
+					return StringT(this->get_value().begin(), this->get_value().end());
+				}
 				
 			private:
-				void init() { this->force_end_quote_ = false; }
+				std::string		decoded_;
+				bool			decoded_checked_;
+				bool			has_refs_;
+
+				void init() {
+					this->force_end_quote_ = false;
+					decoded_checked_ = false;
+					has_refs_ = false;
+				}
 											
 		};
 				
@@ -123,18 +239,57 @@ namespace stpl {
 			 typename AttributeT = Attribute<StringT, IteratorT> >
 		class ElemTag: public XML::ElemTag<StringT, IteratorT, AttributeT > 
 		{
+			private:
+				/**
+				 * the table entry of the tag name, looked up once the name is known
+				 */
+				const TagInfo*	tag_info_;
+
+				void init() { tag_info_ = NULL; }
+
 			public:
 				ElemTag() : 
-					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag() {}
+					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag() { init(); }
 				ElemTag(IteratorT it) : 
-					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag(it) {
-				}
+					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag(it) { init(); }
 				ElemTag(IteratorT begin, IteratorT end) : 
-					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag(begin, end){}
+					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag(begin, end) { init(); }
 				ElemTag(StringT content) {
 					XML::ElemTag<StringT, IteratorT, AttributeT >::ElemTag(content);
+					init();
 				}				
 				virtual ~ElemTag() { };
+
+				const TagInfo& tag_info() {
+					if (!tag_info_) {
+						size_t len = this->name().length();
+						if (len == 0)
+							return HtmlTags::info(TAG_UNKNOWN);
+						tag_info_ = &HtmlTags::lookup(&*this->name().begin(), len);
+					}
+					return *tag_info_;
+				}
+
+				HtmlTagId tag_id() {
+					return tag_info().id;
+				}
+
+				/**
+				 * @brief the id of the tag in the parse context, a known tag is
+				 * keyed by its table id and only the other names are interned
+				 */
+				template <typename ContextT>
+				int id(ContextT& context) {
+					HtmlTagId known = tag_id();
+					if (known != TAG_UNKNOWN)
+						return known;
+					context.reserve(TAG_COUNT);
+					return XML::ElemTag<StringT, IteratorT, AttributeT >::id(context);
+				}
+
+				bool has_property(unsigned int property) {
+					return (tag_info().properties & property) != 0;
+				}
 				
 				virtual bool required_end_tag() {
 					if (forbidden_end_tag())
@@ -146,141 +301,62 @@ namespace stpl {
 				}
 				
 				virtual bool forbidden_end_tag() {
-					StringT name(this->name().begin(), this->name().end());
-					if ( 
-						name == StringT("INPUT")
-						|| name == StringT("COL")
-						|| name == StringT("LINK")
-						|| name == StringT("BASE")
-						|| name == StringT("IMG")
-						|| name == StringT("PARAM")
-						|| name == StringT("AREA")		
-						|| name == StringT("HR")
-						|| name == StringT("BR")
-						|| name == StringT("BASEFONT")
-						|| name == StringT("FRAME")
-						|| name == StringT("ISINDEX")
-						|| name == StringT("META")	
-						)					
-						return true;
-					return false;
+					return has_property(TAG_VOID);
 				}
 				
 				virtual bool make_following_element_as_child(ElemTag* next_tag_ptr) {
-					StringT name(this->name().begin(), this->name().end());
-					if ( name == StringT("HTML")
-							|| name== StringT("BODY")
-							|| name== StringT("HEAD")
-							|| name== StringT("P")							
-							)
+					if (has_property(TAG_KEEP_CHILDREN))
 						return true;
-						
-					//StringT next_tag_name(next_tag_ptr->begin(), next_tag_ptr->end());						
-					//if ( (name == StringT("COLGROUP") && next_tag_name == StringT("COL"))
-					//		|| (name== StringT("TBODY") && next_tag_name == StringT("TR"))
-					//		|| (name== StringT("THEAD") && next_tag_name == StringT("TR"))
-					//		|| (name== StringT("TFOOT") && next_tag_name == StringT("TR"))	
-							//|| (name== StringT("SELECT") && next_tag_name == StringT("OPTION"))
-							//|| (name== StringT("OPTGROUP") && next_tag_name == StringT("OPTION"))
-							//|| (name== StringT("UL") && next_tag_name == StringT("LI"))
-							//|| (name== StringT("OL") && next_tag_name == StringT("LI"))							
-					//		)
-					//	return true;
-						
-					// if both tags are from the same group, that means 
-					if ( !(
-							(is_optional_dl_group(this) && is_optional_dl_group(next_tag_ptr))
-						|| (is_optional_table_group(this) && is_optional_table_group(next_tag_ptr))
-						|| (is_optional_others_group(this) && is_optional_others_group(next_tag_ptr))
-						)
-							)
-						return true;						
-						
-					// TODO may append other judgements here
-					// like LI tag only end when meeting another LI or UL tag
-					return false;
+
+					// an element with an optional end tag is closed by the next
+					// element of its own group
+					return !closed_by(next_tag_ptr);
 				}
 				
 				virtual bool force_close(ElemTag* next_tag_ptr) {
-					StringT name(this->name().begin(), this->name().end());
-					StringT last_tag_name(next_tag_ptr->name().begin(), next_tag_ptr->name().end());
-					if ( (name == StringT("HEAD") && last_tag_name == StringT("BODY"))
-							|| (name== StringT("BODY") && last_tag_name == StringT("HEAD"))
-							)
-						return true;
-					return false;					
+					HtmlTagId id = tag_id();
+					HtmlTagId next_id = next_tag_ptr->tag_id();
+					return (id == TAG_HEAD && next_id == TAG_BODY)
+							|| (id == TAG_BODY && next_id == TAG_HEAD);
 				}
 				
 				static bool is_optional_tag(ElemTag* tag_ptr) {
-					if (is_optional_dl_group(tag_ptr))
-						return true;
-					else if (is_optional_table_group(tag_ptr))
-						return true;
-					else if (is_optional_others_group(tag_ptr))
-						return true;
-					/*
-					StringT name(tag_ptr->begin(), tag_ptr->end());
-					if ( name == StringT("LI") 
-						|| name == StringT("DT")
-						|| name == StringT("DD")
-						|| name == StringT("THEAD")
-						|| name == StringT("TFOOT")
-						|| name == StringT("TBODY")
-						|| name == StringT("COLGROUP")
-						|| name == StringT("TR")
-						|| name == StringT("TH")
-						|| name == StringT("TD")
-						|| name == StringT("OPTION")
-						//|| name == StringT("HTML")
-						//|| name == StringT("HEAD")
-						//|| name == StringT("BODY")
-						|| name == StringT("P")
-						//|| name == StringT("")
-						//|| name == StringT("")						
-						)
-						return true;
-						*/
-					return false;					
+					return tag_ptr->has_property(TAG_OPTIONAL_END);
 				}
 				
 			private:
-				static bool is_optional_dl_group(ElemTag* tag_ptr) {
-					StringT name(tag_ptr->begin(), tag_ptr->end());
-					if ( name == StringT("DT")
-						|| name == StringT("DD")
-						//|| name == StringT("HTML")
-						//|| name == StringT("HEAD")
-						//|| name == StringT("BODY")
-						//|| name == StringT("")
-						//|| name == StringT("")						
-						)
-						return true;
-					return false;					
+				/**
+				 * @brief whether the next tag implicitly ends this one, which only
+				 * happens to the elements of the same optional group
+				 */
+				bool closed_by(ElemTag* next_tag_ptr) {
+					if (has_property(TAG_DL_GROUP))
+						return next_tag_ptr->has_property(TAG_DL_GROUP);
+
+					if (has_property(TAG_LIST_GROUP))
+						return next_tag_ptr->tag_id() == tag_id();
+
+					if (has_property(TAG_TABLE_GROUP) && next_tag_ptr->has_property(TAG_TABLE_GROUP))
+						return table_level(next_tag_ptr->tag_id()) <= table_level(tag_id());
+
+					return false;
 				}
 
-				static bool is_optional_table_group(ElemTag* tag_ptr) {
-					StringT name(tag_ptr->begin(), tag_ptr->end());
-					if ( name == StringT("THEAD")
-						|| name == StringT("TFOOT")
-						|| name == StringT("TBODY")
-						|| name == StringT("TR")
-						|| name == StringT("TH")
-						|| name == StringT("TD")	
-						|| name == StringT("COLGROUP")
-						)
-						return true;
-					return false;					
+				/**
+				 * @brief the nesting level of a table part, a row section holds
+				 * rows and a row holds cells
+				 */
+				static int table_level(HtmlTagId id) {
+					switch (id) {
+						case TAG_TR:
+							return 2;
+						case TAG_TD:
+						case TAG_TH:
+							return 3;
+						default:
+							return 1;
+					}
 				}
-				
-				static bool is_optional_others_group(ElemTag* tag_ptr) {
-					StringT name(tag_ptr->begin(), tag_ptr->end());
-					if ( name == StringT("LI") 
-						|| name == StringT("OPTION")
-						//|| name == StringT("P")					
-						)
-						return true;
-					return false;					
-				}				
 		};		
 		
 		template <typename StringT = icstring
@@ -385,26 +461,29 @@ namespace stpl {
 						if (!this->last_tag_ptr_ || this->last_tag_ptr_->length() <= 0 )
 							return false;
 					
-						StringT last_tag_name(this->last_tag_ptr_->name().begin(), this->last_tag_ptr_->name().end());
-						StringT html_tag_name(HTML_START_LABEL.begin() + 1, HTML_START_LABEL.end() - 1);
-						if (last_tag_name != html_tag_name) {
+						if (this->last_tag_ptr_->tag_id() != TAG_HTML) {
 							//int count = 0;
 							do {
 								temp_begin = temp_end;
 								temp_end = doc_end;
 								XmlElement* child_ptr = new XmlElement(temp_begin, temp_end);								
 								child_ptr->set_parent(reinterpret_cast<basic_entity*>(this));
+								child_ptr->set_context(this->context());
 								if (this->last_tag_ptr_) {
 									child_ptr->set_start_keyword(this->last_tag_ptr_);
 									this->last_tag_ptr_ = NULL;
 								}
-								if (!((child_ptr->match(temp_begin, temp_end)) 
-										&& child_ptr->length() > 0)) {
+								bool matched = child_ptr->match(temp_begin, temp_end);
+								child_ptr->pop_open();
+								if (!(matched && child_ptr->length() > 0)) {
 									delete child_ptr;
 									break;
 								}
 								temp_end = child_ptr->end();
 								this->add(reinterpret_cast<basic_entity*>(child_ptr));
+								// a parse limit tripped, the rest of the input is left out
+								if (this->context()->stopped())
+									break;
 								this->match_text(temp_end);
 								this->skip_invalid_chars(temp_end);
 								end = temp_end;
@@ -0,0 +1,208 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_LEXER_H_
+#define STPL_HTML_LEXER_H_
+
+#include <cctype>
+
+#include "stpl_html_tags.h"
+#include "../../utils/simd.h"
+
+/**
+ * The tag level scanning shared by the streaming HTML extractors, which go
+ * through a page without building elements: each call steps over one piece of
+ * markup and returns the position right after it
+ */
+namespace stpl {
+	namespace HTML {
+
+		struct TagAttribute {
+			const char*		name;
+			size_t			name_length;
+			const char*		value;
+			size_t			value_length;
+
+			bool is(const char* what, size_t length) const {
+				return name_length == length && utils::ascii_iequals(name, what, length);
+			}
+		};
+
+		/**
+		 * @brief a tag as seen by the lexer, attributes is where the attributes
+		 * start and end is the position after the closing '>'
+		 */
+		struct LexedTag {
+			const TagInfo*	info;
+			bool			end_tag;
+			const char*		attributes;
+			const char*		end;
+		};
+
+		class HtmlLexer {
+			public:
+				enum Markup {
+					MARKUP_TEXT,		/// a '<' that starts nothing, it is text
+					MARKUP_COMMENT,		/// a comment, a doctype or a processing instruction
+					MARKUP_TAG
+				};
+
+			public:
+				static bool is_space(char c) {
+					return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+				}
+
+				static bool is_name_char(char c) {
+					return !is_space(c) && c != '/' && c != '>' && c != '\0';
+				}
+
+				/**
+				 * @brief read the markup starting with the '<' at p
+				 *
+				 * for a tag, the tag is filled in, for the rest next is the
+				 * position after it
+				 */
+				static Markup markup(const char* p, const char* end, LexedTag& tag, const char*& next) {
+					const char* q = p + 1;
+					if (q >= end) {
+						next = end;
+						return MARKUP_TEXT;
+					}
+
+					if (*q == '!') {
+						if (end - q >= 3 && q[1] == '-' && q[2] == '-')
+							next = skip_comment(q + 3, end);
+						else
+							next = skip_to_close(q, end);
+						return MARKUP_COMMENT;
+					}
+					if (*q == '?') {
+						next = skip_to_close(q, end);
+						return MARKUP_COMMENT;
+					}
+
+					tag.end_tag = (*q == '/');
+					if (tag.end_tag)
+						++q;
+					if (q >= end || !isalpha((unsigned char) *q)) {
+						next = p + 1;
+						return MARKUP_TEXT;
+					}
+
+					const char* name = q;
+					while (q < end && is_name_char(*q))
+						++q;
+					tag.info = &HtmlTags::lookup(name, q - name);
+					tag.attributes = q;
+					tag.end = skip_attributes(q, end);
+					next = tag.end;
+					return MARKUP_TAG;
+				}
+
+				/**
+				 * @brief the next attribute of a tag, p moves past it
+				 *
+				 * @return false at the end of the tag
+				 */
+				static bool next_attribute(const char*& p, const char* end, TagAttribute& attr) {
+					while (p < end && (is_space(*p) || *p == '/'))
+						++p;
+					if (p >= end || *p == '>')
+						return false;
+
+					attr.name = p;
+					while (p < end && !is_space(*p) && *p != '=' && *p != '>' && !(*p == '/' && p > attr.name))
+						++p;
+					attr.name_length = p - attr.name;
+					attr.value = p;
+					attr.value_length = 0;
+
+					const char* q = p;
+					while (q < end && is_space(*q))
+						++q;
+					if (q < end && *q == '=') {
+						++q;
+						while (q < end && is_space(*q))
+							++q;
+						if (q < end && (*q == '"' || *q == '\'')) {
+							const char* close = utils::find_char(q + 1, end, *q);
+							attr.value = q + 1;
+							attr.value_length = close - attr.value;
+							p = close < end ? close + 1 : end;
+						}
+						else {
+							attr.value = q;
+							while (q < end && !is_space(*q) && *q != '>')
+								++q;
+							attr.value_length = q - attr.value;
+							p = q;
+						}
+					}
+					return true;
+				}
+
+				static const char* skip_comment(const char* p, const char* end) {
+					for (; p + 2 < end; ++p) {
+						p = utils::find_char(p, end - 2, '-');
+						if (p + 2 < end && p[1] == '-' && p[2] == '>')
+							return p + 3;
+					}
+					return end;
+				}
+
+				static const char* skip_to_close(const char* p, const char* end) {
+					const char* gt = utils::find_char(p, end, '>');
+					return gt < end ? gt + 1 : end;
+				}
+
+				/**
+				 * @brief the position after the '>' of a tag, quoted attribute
+				 * values may have a '>' in them; a quote only opens a value right
+				 * after the '=', so the one in alt=Don't is taken as it is
+				 */
+				static const char* skip_attributes(const char* p, const char* end) {
+					while (p < end) {
+						char c = *p++;
+						if (c == '>')
+							return p;
+						if (c != '=')
+							continue;
+						while (p < end && is_space(*p))
+							++p;
+						if (p < end && (*p == '"' || *p == '\'')) {
+							const char* quote = utils::find_char(p + 1, end, *p);
+							p = quote < end ? quote + 1 : end;
+						}
+					}
+					return end;
+				}
+
+				/**
+				 * @brief the position of the end tag of a raw text element whose
+				 * content starts at p, end if it is not closed
+				 */
+				static const char* skip_raw_text(const TagInfo& tag, const char* p, const char* end) {
+					return utils::find_end_tag(p, end, tag.name, tag.length);
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_LEXER_H_ */
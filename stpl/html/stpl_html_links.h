@@ -0,0 +1,231 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_LINKS_H_
+#define STPL_HTML_LINKS_H_
+
+#include <string>
+
+#include "stpl_html_lexer.h"
+#include "stpl_html_charref.h"
+#include "../../utils/url.h"
+
+/**
+ * A fast path for collecting the outlinks of a page for a link graph
+ *
+ * Only <a href>, <area href>, <link href>, <img src>, <frame src>, <iframe src>,
+ * <base href> and <meta http-equiv="refresh" content="..; url=.."> are looked
+ * at, the rest of the page is stepped over by the tag lexer without being
+ * parsed. The URLs are decoded, resolved against the page URL (or its <base>)
+ * and passed to a handler:
+ *
+ * 		void operator() (const HTML::Link& link);
+ */
+namespace stpl {
+	namespace HTML {
+
+		struct Link {
+			HtmlTagId		tag;		/// the tag the link comes from
+			std::string		url;		/// the resolved URL
+			std::string		raw;		/// the attribute value as it is in the page
+		};
+
+		template <typename HandlerT>
+		class LinkExtractor {
+			private:
+				HandlerT&		handler_;
+				utils::Url		base_;
+				bool			base_seen_;
+				bool			with_fragment_;
+				size_t			links_;
+
+				Link			link_;
+
+			public:
+				LinkExtractor(HandlerT& handler) : handler_(handler), with_fragment_(false) { init(""); }
+				~LinkExtractor() {}
+
+				/**
+				 * @brief keep the #fragment of the URLs, they are dropped by default
+				 */
+				void with_fragment(bool with) { with_fragment_ = with; }
+
+				/**
+				 * @brief extract the links of the page in [begin, end) whose URL is url
+				 *
+				 * @return the number of links passed to the handler
+				 */
+				size_t extract(const char* begin, const char* end, const std::string& url) {
+					init(url);
+					const char* p = begin;
+					while (p < end) {
+						const char* lt = utils::find_char(p, end, '<');
+						if (lt == end)
+							break;
+
+						LexedTag tag;
+						if (HtmlLexer::markup(lt, end, tag, p) == HtmlLexer::MARKUP_TAG && !tag.end_tag)
+							p = open_tag(tag, end);
+					}
+					return links_;
+				}
+
+				size_t extract(const std::string& page, const std::string& url) {
+					return extract(page.data(), page.data() + page.length(), url);
+				}
+
+				const utils::Url& base() const { return base_; }
+
+			private:
+				void init(const std::string& url) {
+					base_.parse(url);
+					base_seen_ = false;
+					links_ = 0;
+				}
+
+				const char* open_tag(const LexedTag& tag, const char* end) {
+					const TagInfo& info = *tag.info;
+					switch (info.id) {
+						case TAG_A:
+						case TAG_AREA:
+						case TAG_LINK:
+							emit_attribute(tag, info.id, "href", 4);
+							break;
+						case TAG_IMG:
+						case TAG_FRAME:
+							emit_attribute(tag, info.id, "src", 3);
+							break;
+						case TAG_IFRAME:
+							// the content of an iframe is raw text like a script's
+							emit_attribute(tag, info.id, "src", 3);
+							return HtmlLexer::skip_raw_text(info, tag.end, end);
+						case TAG_BASE:
+							set_base(tag);
+							break;
+						case TAG_META:
+							meta_refresh(tag);
+							break;
+						default:
+							// a '<a' in a script is not a link
+							if (info.properties & TAG_RAW_TEXT)
+								return HtmlLexer::skip_raw_text(info, tag.end, end);
+							break;
+					}
+					return tag.end;
+				}
+
+				bool find_attribute(const LexedTag& tag, const char* name, size_t length, TagAttribute& attr) {
+					const char* p = tag.attributes;
+					while (HtmlLexer::next_attribute(p, tag.end, attr))
+						if (attr.is(name, length))
+							return true;
+					return false;
+				}
+
+				void emit_attribute(const LexedTag& tag, HtmlTagId id, const char* name, size_t length) {
+					TagAttribute attr;
+					if (find_attribute(tag, name, length, attr))
+						emit(id, attr.value, attr.value + attr.value_length);
+				}
+
+				void emit(HtmlTagId id, const char* begin, const char* end) {
+					// leading and trailing whitespace is not part of a URL
+					while (begin < end && HtmlLexer::is_space(*begin))
+						++begin;
+					while (end > begin && HtmlLexer::is_space(end[-1]))
+						--end;
+					if (begin == end)
+						return;
+
+					link_.tag = id;
+					link_.raw.assign(begin, end);
+					if (CharRef::has_refs(begin, end)) {
+						std::string decoded;
+						CharRef::decode(begin, end, decoded, true);
+						link_.url = base_.resolve(decoded, with_fragment_);
+					}
+					else
+						link_.url = base_.resolve(link_.raw, with_fragment_);
+					++links_;
+					handler_(link_);
+				}
+
+				/**
+				 * only the first <base href> counts, the links before it (in
+				 * the head) have already been resolved against the page URL
+				 */
+				void set_base(const LexedTag& tag) {
+					TagAttribute attr;
+					if (base_seen_ || !find_attribute(tag, "href", 4, attr))
+						return;
+					base_seen_ = true;
+
+					std::string href(attr.value, attr.value_length);
+					if (CharRef::has_refs(href.data(), href.data() + href.length()))
+						href = CharRef::decode(href, true);
+					base_ = base_.resolve(utils::Url(href));
+				}
+
+				/**
+				 * <meta http-equiv="refresh" content="5; url=http://...">
+				 */
+				void meta_refresh(const LexedTag& tag) {
+					TagAttribute attr, content = TagAttribute();
+					bool refresh = false;
+					const char* p = tag.attributes;
+					while (HtmlLexer::next_attribute(p, tag.end, attr)) {
+						if (attr.is("http-equiv", 10))
+							refresh = attr.value_length == 7 && utils::ascii_iequals(attr.value, "refresh", 7);
+						else if (attr.is("content", 7))
+							content = attr;
+					}
+					if (!refresh || !content.value)
+						return;
+
+					const char* q = content.value;
+					const char* end = content.value + content.value_length;
+					while (q < end && (isdigit((unsigned char) *q) || *q == '.' || HtmlLexer::is_space(*q)))
+						++q;
+					if (q < end && (*q == ';' || *q == ','))
+						++q;
+					while (q < end && HtmlLexer::is_space(*q))
+						++q;
+					if (end - q >= 3 && utils::ascii_iequals(q, "url", 3)) {
+						const char* r = q + 3;
+						while (r < end && HtmlLexer::is_space(*r))
+							++r;
+						if (r < end && *r == '=') {
+							q = r + 1;
+							while (q < end && HtmlLexer::is_space(*q))
+								++q;
+						}
+					}
+					if (q < end && (*q == '\'' || *q == '"')) {
+						const char* close = utils::find_char(q + 1, end, *q);
+						emit(TAG_META, q + 1, close);
+					}
+					else
+						emit(TAG_META, q, end);
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_LINKS_H_ */
@@ -0,0 +1,438 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_TAGS_H_
+#define STPL_HTML_TAGS_H_
+
+#include <cstddef>
+
+/**
+ * A static table of the known HTML tags, a tag name is turned into a tag id and
+ * a set of properties with one perfect hash lookup instead of a chain of string
+ * comparisons
+ *
+ * The tables below are generated, a tag name is hashed with FNV-1a over its lower
+ * case characters; the low bits pick a displacement, and the displaced hash picks
+ * the slot, no two known tags share a slot. Adding a tag means regenerating
+ * the displacement and slot tables.
+ */
+namespace stpl {
+	namespace HTML {
+
+		enum HtmlTagId {
+			TAG_UNKNOWN = 0,
+			TAG_A,
+			TAG_ABBR,
+			TAG_ACRONYM,
+			TAG_ADDRESS,
+			TAG_APPLET,
+			TAG_AREA,
+			TAG_ARTICLE,
+			TAG_ASIDE,
+			TAG_AUDIO,
+			TAG_B,
+			TAG_BASE,
+			TAG_BASEFONT,
+			TAG_BDI,
+			TAG_BDO,
+			TAG_BGSOUND,
+			TAG_BIG,
+			TAG_BLINK,
+			TAG_BLOCKQUOTE,
+			TAG_BODY,
+			TAG_BR,
+			TAG_BUTTON,
+			TAG_CANVAS,
+			TAG_CAPTION,
+			TAG_CENTER,
+			TAG_CITE,
+			TAG_CODE,
+			TAG_COL,
+			TAG_COLGROUP,
+			TAG_DATA,
+			TAG_DATALIST,
+			TAG_DD,
+			TAG_DEL,
+			TAG_DETAILS,
+			TAG_DFN,
+			TAG_DIALOG,
+			TAG_DIR,
+			TAG_DIV,
+			TAG_DL,
+			TAG_DT,
+			TAG_EM,
+			TAG_EMBED,
+			TAG_FIELDSET,
+			TAG_FIGCAPTION,
+			TAG_FIGURE,
+			TAG_FONT,
+			TAG_FOOTER,
+			TAG_FORM,
+			TAG_FRAME,
+			TAG_FRAMESET,
+			TAG_H1,
+			TAG_H2,
+			TAG_H3,
+			TAG_H4,
+			TAG_H5,
+			TAG_H6,
+			TAG_HEAD,
+			TAG_HEADER,
+			TAG_HGROUP,
+			TAG_HR,
+			TAG_HTML,
+			TAG_I,
+			TAG_IFRAME,
+			TAG_IMG,
+			TAG_INPUT,
+			TAG_INS,
+			TAG_ISINDEX,
+			TAG_KBD,
+			TAG_KEYGEN,
+			TAG_LABEL,
+			TAG_LEGEND,
+			TAG_LI,
+			TAG_LINK,
+			TAG_LISTING,
+			TAG_MAIN,
+			TAG_MAP,
+			TAG_MARK,
+			TAG_MARQUEE,
+			TAG_MATH,
+			TAG_MENU,
+			TAG_MENUITEM,
+			TAG_META,
+			TAG_METER,
+			TAG_NAV,
+			TAG_NOBR,
+			TAG_NOEMBED,
+			TAG_NOFRAMES,
+			TAG_NOSCRIPT,
+			TAG_OBJECT,
+			TAG_OL,
+			TAG_OPTGROUP,
+			TAG_OPTION,
+			TAG_OUTPUT,
+			TAG_P,
+			TAG_PARAM,
+			TAG_PICTURE,
+			TAG_PLAINTEXT,
+			TAG_PRE,
+			TAG_PROGRESS,
+			TAG_Q,
+			TAG_RB,
+			TAG_RP,
+			TAG_RT,
+			TAG_RTC,
+			TAG_RUBY,
+			TAG_S,
+			TAG_SAMP,
+			TAG_SCRIPT,
+			TAG_SEARCH,
+			TAG_SECTION,
+			TAG_SELECT,
+			TAG_SLOT,
+			TAG_SMALL,
+			TAG_SOURCE,
+			TAG_SPAN,
+			TAG_STRIKE,
+			TAG_STRONG,
+			TAG_STYLE,
+			TAG_SUB,
+			TAG_SUMMARY,
+			TAG_SUP,
+			TAG_SVG,
+			TAG_TABLE,
+			TAG_TBODY,
+			TAG_TD,
+			TAG_TEMPLATE,
+			TAG_TEXTAREA,
+			TAG_TFOOT,
+			TAG_TH,
+			TAG_THEAD,
+			TAG_TIME,
+			TAG_TITLE,
+			TAG_TR,
+			TAG_TRACK,
+			TAG_TT,
+			TAG_U,
+			TAG_UL,
+			TAG_VAR,
+			TAG_VIDEO,
+			TAG_WBR,
+			TAG_XMP,
+			TAG_COUNT
+		};
+
+		enum HtmlTagProperty {
+			TAG_VOID           = 1 << 0,
+			TAG_OPTIONAL_END   = 1 << 1,
+			TAG_RAW_TEXT       = 1 << 2,
+			TAG_BLOCK          = 1 << 3,
+			TAG_TABLE_GROUP    = 1 << 4,
+			TAG_DL_GROUP       = 1 << 5,
+			TAG_LIST_GROUP     = 1 << 6,
+			TAG_KEEP_CHILDREN  = 1 << 7,
+			TAG_TABLE_SCOPE    = 1 << 8,
+			TAG_FORMATTING     = 1 << 9,
+			TAG_HEADING        = 1 << 10,
+			TAG_METADATA       = 1 << 11
+		};
+
+		struct TagInfo {
+			const char*		name;
+			size_t			length;
+			HtmlTagId		id;
+			unsigned int	properties;
+		};
+
+		class HtmlTags {
+			public:
+				enum {
+					DISPLACEMENT_SIZE	= 64,
+					SLOT_SIZE			= 256
+				};
+
+			public:
+				/**
+				 * @brief the tag info of the given id, TAG_UNKNOWN for an out of range id
+				 */
+				static const TagInfo& info(int id) {
+					static const TagInfo tags[TAG_COUNT] = {
+						{"", 0, TAG_UNKNOWN, 0},
+						{"a", 1, TAG_A, TAG_FORMATTING},
+						{"abbr", 4, TAG_ABBR, 0},
+						{"acronym", 7, TAG_ACRONYM, 0},
+						{"address", 7, TAG_ADDRESS, TAG_BLOCK},
+						{"applet", 6, TAG_APPLET, 0},
+						{"area", 4, TAG_AREA, TAG_VOID},
+						{"article", 7, TAG_ARTICLE, TAG_BLOCK},
+						{"aside", 5, TAG_ASIDE, TAG_BLOCK},
+						{"audio", 5, TAG_AUDIO, 0},
+						{"b", 1, TAG_B, TAG_FORMATTING},
+						{"base", 4, TAG_BASE, TAG_VOID | TAG_METADATA},
+						{"basefont", 8, TAG_BASEFONT, TAG_VOID | TAG_METADATA},
+						{"bdi", 3, TAG_BDI, 0},
+						{"bdo", 3, TAG_BDO, 0},
+						{"bgsound", 7, TAG_BGSOUND, TAG_VOID | TAG_METADATA},
+						{"big", 3, TAG_BIG, TAG_FORMATTING},
+						{"blink", 5, TAG_BLINK, 0},
+						{"blockquote", 10, TAG_BLOCKQUOTE, TAG_BLOCK},
+						{"body", 4, TAG_BODY, TAG_BLOCK | TAG_KEEP_CHILDREN},
+						{"br", 2, TAG_BR, TAG_VOID | TAG_BLOCK},
+						{"button", 6, TAG_BUTTON, 0},
+						{"canvas", 6, TAG_CANVAS, 0},
+						{"caption", 7, TAG_CAPTION, TAG_BLOCK | TAG_TABLE_SCOPE},
+						{"center", 6, TAG_CENTER, TAG_BLOCK},
+						{"cite", 4, TAG_CITE, 0},
+						{"code", 4, TAG_CODE, TAG_FORMATTING},
+						{"col", 3, TAG_COL, TAG_VOID | TAG_TABLE_SCOPE},
+						{"colgroup", 8, TAG_COLGROUP, TAG_OPTIONAL_END | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"data", 4, TAG_DATA, 0},
+						{"datalist", 8, TAG_DATALIST, 0},
+						{"dd", 2, TAG_DD, TAG_OPTIONAL_END | TAG_BLOCK | TAG_DL_GROUP},
+						{"del", 3, TAG_DEL, 0},
+						{"details", 7, TAG_DETAILS, TAG_BLOCK},
+						{"dfn", 3, TAG_DFN, 0},
+						{"dialog", 6, TAG_DIALOG, TAG_BLOCK},
+						{"dir", 3, TAG_DIR, TAG_BLOCK},
+						{"div", 3, TAG_DIV, TAG_BLOCK},
+						{"dl", 2, TAG_DL, TAG_BLOCK},
+						{"dt", 2, TAG_DT, TAG_OPTIONAL_END | TAG_BLOCK | TAG_DL_GROUP},
+						{"em", 2, TAG_EM, TAG_FORMATTING},
+						{"embed", 5, TAG_EMBED, TAG_VOID},
+						{"fieldset", 8, TAG_FIELDSET, TAG_BLOCK},
+						{"figcaption", 10, TAG_FIGCAPTION, TAG_BLOCK},
+						{"figure", 6, TAG_FIGURE, TAG_BLOCK},
+						{"font", 4, TAG_FONT, TAG_FORMATTING},
+						{"footer", 6, TAG_FOOTER, TAG_BLOCK},
+						{"form", 4, TAG_FORM, TAG_BLOCK},
+						{"frame", 5, TAG_FRAME, TAG_VOID},
+						{"frameset", 8, TAG_FRAMESET, TAG_BLOCK},
+						{"h1", 2, TAG_H1, TAG_BLOCK | TAG_HEADING},
+						{"h2", 2, TAG_H2, TAG_BLOCK | TAG_HEADING},
+						{"h3", 2, TAG_H3, TAG_BLOCK | TAG_HEADING},
+						{"h4", 2, TAG_H4, TAG_BLOCK | TAG_HEADING},
+						{"h5", 2, TAG_H5, TAG_BLOCK | TAG_HEADING},
+						{"h6", 2, TAG_H6, TAG_BLOCK | TAG_HEADING},
+						{"head", 4, TAG_HEAD, TAG_BLOCK | TAG_KEEP_CHILDREN | TAG_METADATA},
+						{"header", 6, TAG_HEADER, TAG_BLOCK},
+						{"hgroup", 6, TAG_HGROUP, TAG_BLOCK},
+						{"hr", 2, TAG_HR, TAG_VOID | TAG_BLOCK},
+						{"html", 4, TAG_HTML, TAG_BLOCK | TAG_KEEP_CHILDREN},
+						{"i", 1, TAG_I, TAG_FORMATTING},
+						{"iframe", 6, TAG_IFRAME, TAG_RAW_TEXT},
+						{"img", 3, TAG_IMG, TAG_VOID},
+						{"input", 5, TAG_INPUT, TAG_VOID},
+						{"ins", 3, TAG_INS, 0},
+						{"isindex", 7, TAG_ISINDEX, TAG_VOID},
+						{"kbd", 3, TAG_KBD, 0},
+						{"keygen", 6, TAG_KEYGEN, TAG_VOID},
+						{"label", 5, TAG_LABEL, 0},
+						{"legend", 6, TAG_LEGEND, TAG_BLOCK},
+						{"li", 2, TAG_LI, TAG_OPTIONAL_END | TAG_BLOCK | TAG_LIST_GROUP},
+						{"link", 4, TAG_LINK, TAG_VOID | TAG_METADATA},
+						{"listing", 7, TAG_LISTING, TAG_BLOCK},
+						{"main", 4, TAG_MAIN, TAG_BLOCK},
+						{"map", 3, TAG_MAP, 0},
+						{"mark", 4, TAG_MARK, 0},
+						{"marquee", 7, TAG_MARQUEE, 0},
+						{"math", 4, TAG_MATH, 0},
+						{"menu", 4, TAG_MENU, TAG_BLOCK},
+						{"menuitem", 8, TAG_MENUITEM, 0},
+						{"meta", 4, TAG_META, TAG_VOID | TAG_METADATA},
+						{"meter", 5, TAG_METER, 0},
+						{"nav", 3, TAG_NAV, TAG_BLOCK},
+						{"nobr", 4, TAG_NOBR, TAG_FORMATTING},
+						{"noembed", 7, TAG_NOEMBED, TAG_RAW_TEXT},
+						{"noframes", 8, TAG_NOFRAMES, TAG_RAW_TEXT},
+						{"noscript", 8, TAG_NOSCRIPT, TAG_METADATA},
+						{"object", 6, TAG_OBJECT, 0},
+						{"ol", 2, TAG_OL, TAG_BLOCK},
+						{"optgroup", 8, TAG_OPTGROUP, 0},
+						{"option", 6, TAG_OPTION, TAG_OPTIONAL_END | TAG_LIST_GROUP},
+						{"output", 6, TAG_OUTPUT, 0},
+						{"p", 1, TAG_P, TAG_BLOCK | TAG_KEEP_CHILDREN},
+						{"param", 5, TAG_PARAM, TAG_VOID},
+						{"picture", 7, TAG_PICTURE, 0},
+						{"plaintext", 9, TAG_PLAINTEXT, TAG_BLOCK},
+						{"pre", 3, TAG_PRE, TAG_BLOCK},
+						{"progress", 8, TAG_PROGRESS, 0},
+						{"q", 1, TAG_Q, 0},
+						{"rb", 2, TAG_RB, 0},
+						{"rp", 2, TAG_RP, 0},
+						{"rt", 2, TAG_RT, 0},
+						{"rtc", 3, TAG_RTC, 0},
+						{"ruby", 4, TAG_RUBY, 0},
+						{"s", 1, TAG_S, TAG_FORMATTING},
+						{"samp", 4, TAG_SAMP, 0},
+						{"script", 6, TAG_SCRIPT, TAG_RAW_TEXT | TAG_METADATA},
+						{"search", 6, TAG_SEARCH, TAG_BLOCK},
+						{"section", 7, TAG_SECTION, TAG_BLOCK},
+						{"select", 6, TAG_SELECT, 0},
+						{"slot", 4, TAG_SLOT, 0},
+						{"small", 5, TAG_SMALL, TAG_FORMATTING},
+						{"source", 6, TAG_SOURCE, TAG_VOID},
+						{"span", 4, TAG_SPAN, 0},
+						{"strike", 6, TAG_STRIKE, TAG_FORMATTING},
+						{"strong", 6, TAG_STRONG, TAG_FORMATTING},
+						{"style", 5, TAG_STYLE, TAG_RAW_TEXT | TAG_METADATA},
+						{"sub", 3, TAG_SUB, 0},
+						{"summary", 7, TAG_SUMMARY, TAG_BLOCK},
+						{"sup", 3, TAG_SUP, 0},
+						{"svg", 3, TAG_SVG, 0},
+						{"table", 5, TAG_TABLE, TAG_BLOCK | TAG_TABLE_SCOPE},
+						{"tbody", 5, TAG_TBODY, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"td", 2, TAG_TD, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"template", 8, TAG_TEMPLATE, TAG_METADATA},
+						{"textarea", 8, TAG_TEXTAREA, TAG_RAW_TEXT},
+						{"tfoot", 5, TAG_TFOOT, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"th", 2, TAG_TH, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"thead", 5, TAG_THEAD, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"time", 4, TAG_TIME, 0},
+						{"title", 5, TAG_TITLE, TAG_RAW_TEXT | TAG_METADATA},
+						{"tr", 2, TAG_TR, TAG_OPTIONAL_END | TAG_BLOCK | TAG_TABLE_GROUP | TAG_TABLE_SCOPE},
+						{"track", 5, TAG_TRACK, TAG_VOID},
+						{"tt", 2, TAG_TT, TAG_FORMATTING},
+						{"u", 1, TAG_U, TAG_FORMATTING},
+						{"ul", 2, TAG_UL, TAG_BLOCK},
+						{"var", 3, TAG_VAR, 0},
+						{"video", 5, TAG_VIDEO, 0},
+						{"wbr", 3, TAG_WBR, TAG_VOID},
+						{"xmp", 3, TAG_XMP, TAG_RAW_TEXT | TAG_BLOCK}
+					};
+					if (id <= TAG_UNKNOWN || id >= TAG_COUNT)
+						return tags[TAG_UNKNOWN];
+					return tags[id];
+				}
+
+				/**
+				 * @brief look up a tag name of the given length, case insensitively
+				 *
+				 * @return the tag info, or the TAG_UNKNOWN entry if it is not a known tag
+				 */
+				static const TagInfo& lookup(const char* name, size_t len) {
+					static const unsigned char displacements[DISPLACEMENT_SIZE] = {
+						0, 2, 1, 3, 1, 6, 4, 4,
+						1, 1, 2, 2, 1, 6, 1, 4,
+						2, 1, 2, 1, 1, 1, 1, 1,
+						2, 1, 0, 2, 1, 0, 1, 4,
+						3, 1, 1, 0, 5, 1, 1, 3,
+						0, 1, 1, 3, 2, 6, 0, 1,
+						2, 3, 1, 1, 2, 1, 2, 1,
+						0, 1, 7, 4, 2, 1, 1, 1
+					};
+					static const unsigned char slots[SLOT_SIZE] = {
+						0, 0, 0, 0, 134, 0, 35, 0, 0, 0, 30, 52, 123, 139, 39, 18,
+						0, 0, 0, 44, 0, 10, 37, 50, 6, 40, 137, 111, 43, 61, 103, 121,
+						36, 0, 0, 0, 19, 12, 23, 96, 0, 138, 68, 0, 125, 45, 63, 99,
+						0, 90, 112, 0, 92, 0, 127, 86, 80, 132, 0, 0, 120, 108, 60, 0,
+						124, 122, 0, 78, 100, 131, 38, 9, 0, 41, 71, 0, 0, 0, 0, 0,
+						0, 0, 0, 82, 22, 107, 0, 67, 91, 116, 0, 17, 0, 59, 0, 4,
+						0, 64, 0, 0, 0, 56, 0, 0, 85, 25, 57, 115, 0, 0, 53, 0,
+						0, 0, 70, 0, 0, 126, 58, 130, 42, 49, 0, 0, 0, 0, 5, 0,
+						13, 0, 114, 33, 62, 0, 0, 21, 119, 77, 66, 0, 16, 0, 11, 0,
+						102, 0, 7, 0, 97, 109, 0, 69, 0, 0, 101, 34, 47, 0, 0, 0,
+						0, 84, 14, 0, 0, 48, 110, 0, 1, 0, 72, 0, 81, 104, 113, 0,
+						0, 106, 32, 0, 105, 93, 0, 0, 0, 0, 28, 76, 0, 27, 0, 88,
+						0, 79, 133, 0, 135, 0, 74, 20, 0, 0, 0, 0, 3, 89, 94, 0,
+						0, 54, 31, 136, 2, 0, 65, 0, 0, 98, 87, 129, 0, 29, 140, 0,
+						8, 0, 0, 0, 26, 15, 118, 46, 128, 55, 0, 117, 0, 73, 0, 0,
+						24, 83, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 95
+					};
+
+					if (len == 0 || len > MAX_TAG_LENGTH)
+						return info(TAG_UNKNOWN);
+
+					unsigned int h = 2166136261u;
+					for (size_t i = 0; i < len; ++i) {
+						h ^= lower(name[i]);
+						h *= 16777619u;
+					}
+					unsigned int slot = ((h ^ displacements[h & (DISPLACEMENT_SIZE - 1)]) * 0x9E3779B1u) >> 24;
+
+					const TagInfo& tag = info(slots[slot]);
+					if (tag.length != len)
+						return info(TAG_UNKNOWN);
+					for (size_t i = 0; i < len; ++i)
+						if (lower(name[i]) != (unsigned char)tag.name[i])
+							return info(TAG_UNKNOWN);
+					return tag;
+				}
+
+				static HtmlTagId lookup_id(const char* name, size_t len) {
+					return lookup(name, len).id;
+				}
+
+				static bool has_property(int id, unsigned int property) {
+					return (info(id).properties & property) != 0;
+				}
+
+			private:
+				enum { MAX_TAG_LENGTH = 10 };
+
+				static unsigned char lower(char c) {
+					return (c >= 'A' && c <= 'Z') ? (unsigned char)(c + ('a' - 'A')) : (unsigned char)c;
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_TAGS_H_ */
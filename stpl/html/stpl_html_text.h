@@ -0,0 +1,297 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_HTML_TEXT_H_
+#define STPL_HTML_TEXT_H_
+
+#include <string>
+#include <cctype>
+
+#include "stpl_html_lexer.h"
+#include "stpl_html_charref.h"
+
+/**
+ * A streaming extraction of the visible text of an HTML page, for when only
+ * the text is wanted and building the element tree would be a waste
+ *
+ * The page is scanned once, no node is created; script, style, head, template,
+ * noscript and comment content is skipped, title and textarea content is
+ * taken as text up to its end tag, character references are decoded and
+ * whitespace is collapsed. The text is handed to a sink one block (a
+ * paragraph, a heading, a table cell, ...) at a time:
+ *
+ * 		struct Sink {
+ * 			void text(const char* text, size_t length);	// the text of a block
+ * 			void block();								// the end of the block
+ * 		};
+ *
+ * Optionally the blocks that look like boilerplate (navigation, link lists,
+ * footers) are dropped, using the link density and the number of words of a
+ * block. Only the current block is buffered.
+ */
+namespace stpl {
+	namespace HTML {
+
+		struct TextExtractorOptions {
+			bool		prune_boilerplate;
+			double		max_link_density;	/// the share of the block text inside links above which a block is dropped
+			size_t		min_words;			/// a block with fewer words is dropped, unless it is a heading
+
+			TextExtractorOptions() :
+				prune_boilerplate(false), max_link_density(0.33), min_words(5) {}
+		};
+
+		/**
+		 * @brief a sink that collects the text in a string, one line per block
+		 */
+		class StringTextSink {
+			private:
+				std::string&	out_;
+
+			public:
+				StringTextSink(std::string& out) : out_(out) {}
+
+				void text(const char* text, size_t length) {
+					out_.append(text, length);
+				}
+
+				void block() {
+					out_.push_back('\n');
+				}
+		};
+
+		template <typename SinkT = StringTextSink>
+		class TextExtractor {
+			private:
+				SinkT&					sink_;
+				TextExtractorOptions	options_;
+
+				std::string				block_;
+				size_t					block_words_;
+				size_t					block_link_chars_;
+				bool					block_heading_;
+				bool					space_pending_;
+
+				int						link_depth_;
+				int						heading_depth_;
+				bool					in_head_;
+
+				size_t					blocks_;
+				size_t					blocks_dropped_;
+
+			public:
+				TextExtractor(SinkT& sink, const TextExtractorOptions& options = TextExtractorOptions()) :
+					sink_(sink), options_(options) { init(); }
+				~TextExtractor() {}
+
+				/**
+				 * @brief extract the text of the page in [begin, end)
+				 */
+				void extract(const char* begin, const char* end) {
+					init();
+					const char* p = begin;
+					while (p < end) {
+						const char* lt = utils::find_char(p, end, '<');
+						if (lt > p)
+							add_text(p, lt);
+						if (lt == end)
+							break;
+						p = markup(lt, end);
+					}
+					end_block();
+				}
+
+				void extract(const std::string& page) {
+					extract(page.data(), page.data() + page.length());
+				}
+
+				size_t blocks() const { return blocks_; }
+				size_t blocks_dropped() const { return blocks_dropped_; }
+
+				TextExtractorOptions& options() { return options_; }
+
+			private:
+				void init() {
+					block_.clear();
+					block_words_ = 0;
+					block_link_chars_ = 0;
+					block_heading_ = false;
+					space_pending_ = false;
+					link_depth_ = 0;
+					heading_depth_ = 0;
+					in_head_ = false;
+					blocks_ = 0;
+					blocks_dropped_ = 0;
+				}
+
+				/**
+				 * @brief handle the markup starting with the '<' at p
+				 *
+				 * @return the position right after it
+				 */
+				const char* markup(const char* p, const char* end) {
+					LexedTag tag;
+					const char* next;
+					switch (HtmlLexer::markup(p, end, tag, next)) {
+						case HtmlLexer::MARKUP_TEXT:
+							add_text(p, next);
+							return next;
+						case HtmlLexer::MARKUP_COMMENT:
+							return next;
+						default:
+							break;
+					}
+
+					if (tag.end_tag) {
+						close_tag(*tag.info);
+						return next;
+					}
+					return open_tag(*tag.info, next, end);
+				}
+
+				const char* open_tag(const TagInfo& tag, const char* after, const char* end) {
+					switch (tag.id) {
+						case TAG_HEAD:
+							in_head_ = true;
+							return after;
+						case TAG_BODY:
+							in_head_ = false;
+							break;
+						case TAG_TITLE:
+						case TAG_TEXTAREA: {
+							// RCDATA, a '<' in it doesn't start a tag; a title in
+							// the head is dropped with the rest of the head
+							const char* close = HtmlLexer::skip_raw_text(tag, after, end);
+							add_text(after, close);
+							return close;
+						}
+						case TAG_NOSCRIPT:
+						case TAG_TEMPLATE:
+							return HtmlLexer::skip_raw_text(tag, after, end);
+						default:
+							if (tag.properties & TAG_RAW_TEXT)
+								return HtmlLexer::skip_raw_text(tag, after, end);
+							// content in the head that doesn't belong there starts the body
+							if (in_head_ && tag.id != TAG_UNKNOWN && tag.id != TAG_HTML && !(tag.properties & TAG_METADATA))
+								in_head_ = false;
+							break;
+					}
+
+					if (tag.properties & TAG_BLOCK)
+						end_block();
+					if (tag.properties & TAG_HEADING)
+						++heading_depth_;
+					else if (tag.id == TAG_A)
+						++link_depth_;
+					return after;
+				}
+
+				void close_tag(const TagInfo& tag) {
+					if (tag.id == TAG_HEAD) {
+						in_head_ = false;
+						return;
+					}
+					if (tag.properties & TAG_HEADING) {
+						if (heading_depth_ > 0)
+							--heading_depth_;
+					}
+					else if (tag.id == TAG_A) {
+						if (link_depth_ > 0)
+							--link_depth_;
+					}
+					if (tag.properties & TAG_BLOCK)
+						end_block();
+				}
+
+				/**
+				 * @brief add a run of text to the current block, decoding the
+				 * references and collapsing the whitespace
+				 */
+				void add_text(const char* begin, const char* end) {
+					if (in_head_)
+						return;
+
+					if (CharRef::has_refs(begin, end)) {
+						std::string decoded;
+						CharRef::decode(begin, end, decoded);
+						append(decoded.data(), decoded.data() + decoded.length());
+					}
+					else
+						append(begin, end);
+				}
+
+				void append(const char* p, const char* end) {
+					size_t before = block_.length();
+					while (p < end) {
+						if (HtmlLexer::is_space(*p)) {
+							space_pending_ = true;
+							++p;
+							continue;
+						}
+
+						if (space_pending_ || block_.empty()) {
+							if (!block_.empty())
+								block_.push_back(' ');
+							++block_words_;
+							space_pending_ = false;
+						}
+
+						const char* word = p;
+						while (p < end && !HtmlLexer::is_space(*p))
+							++p;
+						block_.append(word, p - word);
+					}
+
+					if (heading_depth_ > 0 && block_.length() > before)
+						block_heading_ = true;
+					if (link_depth_ > 0)
+						block_link_chars_ += block_.length() - before;
+				}
+
+				void end_block() {
+					space_pending_ = false;
+					if (block_.empty())
+						return;
+
+					++blocks_;
+					if (options_.prune_boilerplate && is_boilerplate())
+						++blocks_dropped_;
+					else {
+						sink_.text(block_.data(), block_.length());
+						sink_.block();
+					}
+
+					block_.clear();
+					block_words_ = 0;
+					block_link_chars_ = 0;
+					block_heading_ = false;
+				}
+
+				bool is_boilerplate() const {
+					double link_density = (double) block_link_chars_ / block_.length();
+					if (link_density > options_.max_link_density)
+						return true;
+					return !block_heading_ && block_words_ < options_.min_words;
+				}
+		};
+	}
+}
+
+#endif /* STPL_HTML_TEXT_H_ */
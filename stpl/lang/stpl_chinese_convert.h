@@ -0,0 +1,254 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_CHINESE_CONVERT_H_
+#define STPL_CHINESE_CONVERT_H_
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../utils/datrie.h"
+#include "../../utils/simd.h"
+
+namespace stpl {
+	namespace UNICODE {
+
+		enum ChineseVariant { ZH_HANS, ZH_HANT, ZH_TW, ZH_HK, ZH_VARIANTS };
+
+		/**
+		 * @brief the variant of a language code: zh-hans, zh-hant, zh-tw or
+		 * zh-hk, and zh-cn, zh-sg, zh-my for the simplified and zh-mo for the
+		 * traditional ones
+		 *
+		 * @return ZH_VARIANTS if it is none of them
+		 */
+		inline ChineseVariant chinese_variant(const char* code, size_t length) {
+			static const struct { const char* code; ChineseVariant variant; } CODES[] = {
+					{ "zh-hans", ZH_HANS }, { "zh-cn", ZH_HANS }, { "zh-sg", ZH_HANS }, { "zh-my", ZH_HANS },
+					{ "zh-hant", ZH_HANT }, { "zh-tw", ZH_TW }, { "zh-hk", ZH_HK }, { "zh-mo", ZH_HK }
+			};
+			for (size_t i = 0; i < sizeof(CODES) / sizeof(CODES[0]); ++i)
+				if (strlen(CODES[i].code) == length && utils::ascii_iequals(code, CODES[i].code, length))
+					return CODES[i].variant;
+			return ZH_VARIANTS;
+		}
+
+		/**
+		 * @brief a set of phrase conversions, from one string to another, with
+		 * the longest one matched at each position
+		 */
+		class ChineseConversionTable {
+			public:
+				enum { TABLE_OK = 0, TABLE_ERROR = -1 };
+
+			private:
+				std::vector<utils::DoubleArrayTrie::entry_type>		entries_;
+				std::string											targets_;
+				std::vector<size_t>									offsets_;	/// of each target, with one past the last
+				utils::DoubleArrayTrie								trie_;
+				bool												ascii_;		/// whether a key starts with an ASCII byte
+
+			public:
+				ChineseConversionTable() : ascii_(false) { offsets_.push_back(0); }
+				~ChineseConversionTable() {}
+
+				/**
+				 * @brief a conversion, it replaces an earlier one of the same
+				 * string; build() has to be called before the table is used
+				 */
+				void add(const char* from, size_t from_length, const char* to, size_t to_length) {
+					if (from_length == 0)
+						return;
+					entries_.push_back(utils::DoubleArrayTrie::entry_type(std::string(from, from_length), (int32_t) offsets_.size() - 1));
+					targets_.append(to, to_length);
+					offsets_.push_back(targets_.size());
+				}
+
+				void add(const std::string& from, const std::string& to) {
+					add(from.data(), from.length(), to.data(), to.length());
+				}
+
+				/**
+				 * @brief add the conversions of a table file, a line each with
+				 * the string, a tab and what it is converted to; what follows a
+				 * space after that is left out, as are the lines starting with '#'
+				 */
+				int load(const std::string& filename) {
+					FILE* fp = fopen(filename.c_str(), "rb");
+					if (!fp)
+						return TABLE_ERROR;
+					char* line = NULL;
+					size_t capacity = 0;
+					ssize_t length;
+					while ((length = getline(&line, &capacity, fp)) >= 0) {
+						const char* end = line + length;
+						while (end > line && (end[-1] == '\n' || end[-1] == '\r'))
+							--end;
+						if (end == line || *line == '#')
+							continue;
+						const char* tab = utils::find_char(line, end, '\t');
+						if (tab == end)
+							continue;
+						const char* to = tab + 1;
+						add(line, tab - line, to, utils::find_char(to, end, ' ') - to);
+					}
+					free(line);
+					fclose(fp);
+					return TABLE_OK;
+				}
+
+				void build() {
+					trie_.build(entries_);
+					ascii_ = false;
+					for (int c = 0; c < 0x80; ++c)
+						ascii_ = ascii_ || trie_.starts_with((char) c);
+				}
+
+				/**
+				 * @brief drop the conversions, the memory is kept
+				 */
+				void clear() {
+					entries_.clear();
+					targets_.clear();
+					offsets_.assign(1, 0);
+					trie_.clear();
+					ascii_ = false;
+				}
+
+				bool empty() const { return trie_.size() == 0; }
+				size_t size() const { return trie_.size(); }
+				bool has_ascii_keys() const { return ascii_; }
+				bool starts_with(char c) const { return trie_.starts_with(c); }
+
+				/**
+				 * @brief the longest conversion at the beginning of [begin, end)
+				 *
+				 * @return false if there is none, otherwise length is the bytes
+				 * matched and [to, to + to_length) what they are converted to
+				 */
+				bool match(const char* begin, const char* end, size_t& length, const char*& to, size_t& to_length) const {
+					int32_t index = trie_.longest_match(begin, end, length);
+					if (index == utils::DoubleArrayTrie::NO_VALUE)
+						return false;
+					to = targets_.data() + offsets_[index];
+					to_length = offsets_[index + 1] - offsets_[index];
+					return true;
+				}
+		};
+
+		/**
+		 * @brief converts Chinese text into one of its variants with the
+		 * conversion tables of each variant, e.g. the zh2Hant and zh2TW
+		 * tables, the later ones overriding the earlier ones, for zh-tw
+		 */
+		class ChineseConverter {
+			public:
+				enum { CONVERTER_OK = 0, CONVERTER_ERROR = -1 };
+
+			private:
+				ChineseConversionTable		tables_[ZH_VARIANTS];
+
+			public:
+				ChineseConverter() {}
+				~ChineseConverter() {}
+
+				/**
+				 * @brief add the conversions of a table file to a variant
+				 */
+				int load(ChineseVariant variant, const std::string& filename) {
+					if (variant >= ZH_VARIANTS || tables_[variant].load(filename) != ChineseConversionTable::TABLE_OK)
+						return CONVERTER_ERROR;
+					tables_[variant].build();
+					return CONVERTER_OK;
+				}
+
+				ChineseConversionTable& table(ChineseVariant variant) {
+					return tables_[variant];
+				}
+
+				const ChineseConversionTable& table(ChineseVariant variant) const {
+					return tables_[variant];
+				}
+
+				/**
+				 * @brief append [begin, end) converted into the variant to out
+				 *
+				 * @param rules the conversions of the document, they take
+				 * precedence over the tables for a match as long
+				 */
+				void convert(const char* begin, const char* end, ChineseVariant variant, std::string& out,
+						const ChineseConversionTable* rules = NULL) const {
+					const ChineseConversionTable& table = tables_[variant];
+					if (rules && rules->empty())
+						rules = NULL;
+					// the text that can't start a match is copied as it is, the ASCII
+					// bytes in bulk when the keys are all Chinese
+					bool skip_ascii = !table.has_ascii_keys() && !(rules && rules->has_ascii_keys());
+
+					const char* p = begin;
+					const char* copied = begin;
+					while (p < end) {
+						if (skip_ascii && (unsigned char) *p < 0x80) {
+							p = utils::find_non_ascii(p, end);
+							continue;
+						}
+
+						size_t length = 0, rule_length = 0, to_length = 0, rule_to_length = 0;
+						const char* to = NULL;
+						const char* rule_to = NULL;
+						bool found = table.starts_with(*p) && table.match(p, end, length, to, to_length);
+						if (rules && rules->starts_with(*p) && rules->match(p, end, rule_length, rule_to, rule_to_length)
+								&& (!found || rule_length >= length)) {
+							found = true;
+							length = rule_length;
+							to = rule_to;
+							to_length = rule_to_length;
+						}
+
+						if (found) {
+							out.append(copied, p);
+							out.append(to, to_length);
+							p += length;
+							copied = p;
+						}
+						else {
+							// on to the next character
+							++p;
+							while (p < end && ((unsigned char) *p & 0xc0) == 0x80)
+								++p;
+						}
+					}
+					out.append(copied, end);
+				}
+
+				std::string convert(const std::string& text, ChineseVariant variant) const {
+					std::string out;
+					out.reserve(text.length());
+					convert(text.data(), text.data() + text.length(), variant, out);
+					return out;
+				}
+		};
+	}
+}
+
+#endif /* STPL_CHINESE_CONVERT_H_ */
@@ -0,0 +1,643 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_WARC_H_
+#define STPL_WARC_H_
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <zlib.h>
+
+#include "../html/stpl_html_links.h"
+#include "../../utils/bounded_queue.h"
+
+namespace stpl {
+
+	namespace WARC {
+
+		/**
+		 * @brief inflate gzip data from input into out, up to the end of the
+		 * gzip member (or zlib stream) that starts there
+		 *
+		 * @param window_bits as for inflateInit2(), 15 + 16 for gzip, 15 + 32
+		 * for gzip or zlib and -15 for raw deflate
+		 * @param consumed the bytes of input that were inflated
+		 * @return true if the end of the stream was reached
+		 */
+		inline bool inflate_data(const char* input, int64_t size, int window_bits, std::string& out, int64_t& consumed) {
+			z_stream zs;
+			memset(&zs, 0, sizeof(zs));
+			out.clear();
+			consumed = 0;
+			if (inflateInit2(&zs, window_bits) != Z_OK)
+				return false;
+
+			zs.next_in = (Bytef*)input;
+			zs.avail_in = (uInt)std::min<int64_t>(size, 0x40000000);
+
+			if (out.capacity() < 65536)
+				out.reserve(65536);
+			int ret = Z_OK;
+			while (ret == Z_OK) {
+				size_t used = out.size();
+				if (out.capacity() - used < 16384)
+					out.reserve(out.capacity() * 2);
+				out.resize(out.capacity());
+				zs.next_out = (Bytef*)&out[used];
+				zs.avail_out = (uInt)(out.size() - used);
+				ret = ::inflate(&zs, Z_NO_FLUSH);
+				out.resize(out.size() - zs.avail_out);
+				if (ret == Z_BUF_ERROR && zs.avail_in > 0)
+					ret = Z_OK;
+			}
+			consumed = zs.total_in;
+			inflateEnd(&zs);
+			return ret == Z_STREAM_END;
+		}
+
+		/**
+		 * @brief the body of a chunked HTTP transfer, a truncated one is kept up
+		 * to where it stops
+		 *
+		 * @return false if [begin, end) doesn't start with a chunk
+		 */
+		inline bool dechunk(const char* begin, const char* end, std::string& out) {
+			out.clear();
+			const char* p = begin;
+			while (p < end) {
+				char* digits_end;
+				unsigned long long size = strtoull(p, &digits_end, 16);
+				if (digits_end == p || !isxdigit((unsigned char) *p))
+					return p != begin;
+				// the chunk extensions are skipped with the end of the line
+				const char* eol = static_cast<const char*>(memchr(digits_end, '\n', end - digits_end));
+				if (!eol || size == 0)
+					break;
+				p = eol + 1;
+				size_t length = std::min<unsigned long long>(size, end - p);
+				out.append(p, length);
+				p += length;
+				if (p < end && *p == '\r')
+					++p;
+				if (p < end && *p == '\n')
+					++p;
+			}
+			return true;
+		}
+
+		/**
+		 * @brief one WARC record, all the pointers point into the buffer of the reader
+		 * and stay valid until the reader moves on
+		 *
+		 * The payload of a HTTP response is the body as the browser sees it: a
+		 * chunked transfer is put back together and a gzip or deflate content
+		 * encoding is undone into a buffer of the record, which a copy of the
+		 * record copies along.
+		 */
+		class Record {
+			public:
+				const char*		begin;				/// start of the WARC header
+				const char*		end;				/// end of the record including the trailing CRLFs
+				const char*		header_end;			/// start of the content block
+				const char*		block_end;
+
+				std::string		type;				/// WARC-Type
+				std::string		target_uri;			/// WARC-Target-URI
+				std::string		content_type;		/// Content-Type of the block
+				int64_t			content_length;
+
+				int				http_status;		/// 0 if the block is not a HTTP response
+				std::string		http_content_type;
+				const char*		http_header_end;	/// end of the HTTP headers
+				const char*		payload_begin;		/// the body of the HTTP response
+				const char*		payload_end;
+
+				int64_t			offset;				/// input offset of the record (or its gzip member)
+
+				std::string		decoded;			/// the payload when it had to be decoded
+
+			public:
+				Record() { clear(); }
+
+				Record(const Record& other) { assign(other); }
+
+				Record& operator=(const Record& other) {
+					if (this != &other)
+						assign(other);
+					return *this;
+				}
+
+				void clear() {
+					begin = end = header_end = block_end = http_header_end = payload_begin = payload_end = NULL;
+					type.clear();
+					target_uri.clear();
+					content_type.clear();
+					http_content_type.clear();
+					content_length = 0;
+					http_status = 0;
+					offset = 0;
+					decoded.clear();
+				}
+
+				bool is_response() const { return type == "response"; }
+
+				bool is_html() const {
+					if (!is_response() || http_status < 200 || http_status >= 300)
+						return false;
+					return find_ci(http_content_type, "html") != std::string::npos;
+				}
+
+				/**
+				 * @brief the value of a WARC header field, empty if not present
+				 */
+				std::string header(const char* name) const {
+					return field(begin, header_end, name);
+				}
+
+				/**
+				 * @brief the value of a HTTP header field, empty if not present
+				 */
+				std::string http_header(const char* name) const {
+					return http_status ? field(header_end, http_header_end, name) : std::string();
+				}
+
+				static std::string::size_type find_ci(const std::string& str, const char* what) {
+					size_t len = strlen(what);
+					if (str.length() < len)
+						return std::string::npos;
+					for (std::string::size_type i = 0; i + len <= str.length(); ++i)
+						if (strncasecmp(str.c_str() + i, what, len) == 0)
+							return i;
+					return std::string::npos;
+				}
+
+				/**
+				 * @brief undo the transfer and content encodings of the payload
+				 */
+				void decode_payload() {
+					std::string transfer = http_header("Transfer-Encoding");
+					std::string encoding = http_header("Content-Encoding");
+					if (find_ci(transfer, "chunked") != std::string::npos && dechunk(payload_begin, payload_end, decoded))
+						set_payload(decoded);
+
+					if (find_ci(encoding, "gzip") == std::string::npos && find_ci(encoding, "deflate") == std::string::npos)
+						return;
+					std::string inflated;
+					int64_t consumed;
+					// deflate is meant to be zlib, some servers send it raw
+					bool ok = inflate_data(payload_begin, payload_end - payload_begin, 15 + 32, inflated, consumed)
+							|| inflate_data(payload_begin, payload_end - payload_begin, -15, inflated, consumed);
+					if (ok || !inflated.empty()) {
+						decoded.swap(inflated);
+						set_payload(decoded);
+					}
+				}
+
+				static std::string field(const char* begin, const char* end, const char* name) {
+					size_t len = strlen(name);
+					const char* line = begin;
+					while (line && line < end) {
+						const char* eol = static_cast<const char*>(memchr(line, '\n', end - line));
+						if (!eol)
+							eol = end;
+						if ((size_t)(eol - line) > len && line[len] == ':' && strncasecmp(line, name, len) == 0) {
+							const char* value = line + len + 1;
+							const char* value_end = eol;
+							while (value < value_end && (*value == ' ' || *value == '\t'))
+								++value;
+							while (value_end > value && (value_end[-1] == '\r' || value_end[-1] == ' '))
+								--value_end;
+							return std::string(value, value_end);
+						}
+						line = eol + 1;
+					}
+					return std::string();
+				}
+
+			private:
+				void set_payload(const std::string& data) {
+					payload_begin = data.data();
+					payload_end = payload_begin + data.size();
+				}
+
+				void assign(const Record& other) {
+					begin = other.begin;
+					end = other.end;
+					header_end = other.header_end;
+					block_end = other.block_end;
+					http_header_end = other.http_header_end;
+					type = other.type;
+					target_uri = other.target_uri;
+					content_type = other.content_type;
+					content_length = other.content_length;
+					http_status = other.http_status;
+					http_content_type = other.http_content_type;
+					offset = other.offset;
+					decoded = other.decoded;
+					payload_begin = other.payload_begin;
+					payload_end = other.payload_end;
+					// the decoded payload is the copy's own
+					if (payload_begin >= other.decoded.data() && payload_end <= other.decoded.data() + other.decoded.size()
+							&& !other.decoded.empty()) {
+						payload_begin = decoded.data() + (other.payload_begin - other.decoded.data());
+						payload_end = decoded.data() + (other.payload_end - other.decoded.data());
+					}
+				}
+		};
+
+		/**
+		 * @brief parse one record starting at begin, returns the end of the record,
+		 * or NULL if the data is not a WARC record or it is truncated
+		 */
+		inline const char* parse_record(const char* begin, const char* end, Record& record) {
+			record.clear();
+
+			// tolerate the blank lines left between records
+			while (begin < end && (*begin == '\r' || *begin == '\n'))
+				++begin;
+			if (end - begin < 5 || strncmp(begin, "WARC/", 5) != 0)
+				return NULL;
+
+			const char* header_end = NULL;
+			for (const char* p = begin; p + 3 < end; ++p) {
+				p = static_cast<const char*>(memchr(p, '\r', (end - 3) - p));
+				if (!p)
+					break;
+				if (p[1] == '\n' && p[2] == '\r' && p[3] == '\n') {
+					header_end = p + 4;
+					break;
+				}
+			}
+			if (!header_end)
+				return NULL;
+
+			record.begin = begin;
+			record.header_end = header_end;
+
+			std::string length = Record::field(begin, header_end, "Content-Length");
+			record.content_length = strtoll(length.c_str(), NULL, 10);
+			if (length.empty() || record.content_length < 0 || record.content_length > end - header_end)
+				return NULL;
+
+			record.block_end = header_end + record.content_length;
+			record.end = record.block_end;
+			while (record.end < end && (*record.end == '\r' || *record.end == '\n') && record.end - record.block_end < 4)
+				++record.end;
+
+			record.type = Record::field(begin, header_end, "WARC-Type");
+			record.target_uri = Record::field(begin, header_end, "WARC-Target-URI");
+			record.content_type = Record::field(begin, header_end, "Content-Type");
+
+			// the HTTP status line and headers of a response
+			if (Record::find_ci(record.content_type, "application/http") != std::string::npos
+					&& record.block_end - header_end > 12 && strncmp(header_end, "HTTP/", 5) == 0) {
+				const char* sp = static_cast<const char*>(memchr(header_end, ' ', record.block_end - header_end));
+				if (sp)
+					record.http_status = atoi(sp + 1);
+
+				record.payload_begin = record.payload_end = record.block_end;
+				for (const char* p = header_end; p + 1 < record.block_end; ++p) {
+					p = static_cast<const char*>(memchr(p, '\n', (record.block_end - 1) - p));
+					if (!p)
+						break;
+					if (p[1] == '\n') {
+						record.payload_begin = p + 2;
+						break;
+					}
+					if (p + 2 < record.block_end && p[1] == '\r' && p[2] == '\n') {
+						record.payload_begin = p + 3;
+						break;
+					}
+				}
+				record.http_header_end = record.payload_begin;
+				record.http_content_type = Record::field(header_end, record.payload_begin, "Content-Type");
+				record.decode_payload();
+			}
+			else {
+				record.payload_begin = header_end;
+				record.payload_end = record.block_end;
+			}
+			return record.end;
+		}
+
+		/**
+		 * @brief a gzip member inflated from the mapped input
+		 */
+		struct Member {
+			int64_t			offset;
+			int64_t			length;		/// the compressed length, valid if ok
+			bool			ok;
+			std::string		data;
+
+			Member() : offset(0), length(0), ok(false) {}
+
+			/**
+			 * @brief inflate the member at input, zlib stops at its end, which
+			 * is where the next member begins
+			 */
+			bool inflate(const char* input, int64_t size) {
+				return ok = inflate_data(input, size, 15 + 16, data, length);
+			}
+		};
+
+		/**
+		 * @brief reads the records of a WARC file, plain or gzip-member-per-record
+		 *
+		 * The file is memory mapped, so the records of an uncompressed file point
+		 * straight into the mapping; compressed members are inflated one by one
+		 * into a reused buffer. for_each() hands the records to a pool of threads.
+		 */
+		class WarcReader {
+			public:
+				enum { WARC_OK = 0, WARC_ERROR = -1 };
+
+			private:
+				int				fd_;
+				const char*		data_;
+				int64_t			size_;
+				int64_t			pos_;			/// input offset of the next record / member
+				bool			gzip_;
+
+				Member			member_;		/// the current member in sequential mode
+				const char*		member_pos_;
+				std::string		error_;
+
+			public:
+				WarcReader() { init(); }
+				~WarcReader() { close(); }
+
+				int open(const std::string& filename) {
+					close();
+					// the error of the previous file doesn't stop this one
+					error_.clear();
+					fd_ = ::open(filename.c_str(), O_RDONLY);
+					if (fd_ < 0) {
+						error_ = "unable to open file: " + filename;
+						return WARC_ERROR;
+					}
+					struct stat st;
+					if (fstat(fd_, &st) != 0) {
+						error_ = "unable to stat file: " + filename;
+						close();
+						return WARC_ERROR;
+					}
+					size_ = st.st_size;
+					if (size_ > 0) {
+						void* addr = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+						if (addr == MAP_FAILED) {
+							error_ = "unable to map file: " + filename;
+							close();
+							return WARC_ERROR;
+						}
+						data_ = static_cast<const char*>(addr);
+						madvise(addr, size_, MADV_SEQUENTIAL);
+					}
+					gzip_ = size_ >= 2 && (unsigned char)data_[0] == 0x1f && (unsigned char)data_[1] == 0x8b;
+					return WARC_OK;
+				}
+
+				void close() {
+					if (data_)
+						munmap(const_cast<char*>(data_), size_);
+					if (fd_ >= 0)
+						::close(fd_);
+					init();
+				}
+
+				bool is_gzip() const { return gzip_; }
+				const std::string& error() const { return error_; }
+
+				/**
+				 * @brief the input offset the next record will be read from, a
+				 * record boundary that can be given back to seek()
+				 */
+				int64_t offset() const { return pos_; }
+
+				void seek(int64_t offset) {
+					pos_ = std::min(offset, size_);
+					member_pos_ = NULL;
+					member_.data.clear();
+				}
+
+				/**
+				 * @brief the next record, false at the end of the input or on a damaged
+				 * record, in which case error() is set
+				 */
+				bool next(Record& record) {
+					if (!gzip_) {
+						const char* end = parse_record(data_ + pos_, data_ + size_, record);
+						if (!end) {
+							at_end(data_ + pos_, data_ + size_);
+							return false;
+						}
+						record.offset = pos_;
+						pos_ = end - data_;
+						return true;
+					}
+
+					for (;;) {
+						if (member_pos_) {
+							const char* member_end = member_.data.data() + member_.data.size();
+							const char* end = parse_record(member_pos_, member_end, record);
+							if (end) {
+								record.offset = member_.offset;
+								member_pos_ = end;
+								return true;
+							}
+							if (!at_end(member_pos_, member_end))
+								return false;
+							member_pos_ = NULL;
+						}
+						if (pos_ >= size_)
+							return false;
+
+						member_.offset = pos_;
+						if (!member_.inflate(data_ + pos_, size_ - pos_)) {
+							error_ = "damaged gzip member";
+							return false;
+						}
+						pos_ += member_.length;
+						member_pos_ = member_.data.data();
+					}
+				}
+
+				/**
+				 * @brief the next HTML response, the other records are skipped
+				 */
+				bool next_html(Record& record) {
+					while (next(record))
+						if (record.is_html())
+							return true;
+					return false;
+				}
+
+				/**
+				 * @brief call handler(Record&) for every record, with the given
+				 * number of threads
+				 *
+				 * With one thread, or a file that is not compressed, the records
+				 * are handed out in input order on the calling thread. Otherwise
+				 * the calling thread inflates the gzip members one after the
+				 * other, each from where the previous one ended, and a pool of
+				 * threads started once for the whole file parses their records
+				 * and calls the handler, from several threads at once and not in
+				 * input order.
+				 *
+				 * @return the number of records passed to the handler
+				 */
+				template <typename HandlerT>
+				size_t for_each(HandlerT& handler, unsigned threads = 0) {
+					return dispatch(handler, threads, false);
+				}
+
+				/**
+				 * @brief the same as for_each() for the HTML responses only
+				 */
+				template <typename HandlerT>
+				size_t for_each_html(HandlerT& handler, unsigned threads = 0) {
+					return dispatch(handler, threads, true);
+				}
+
+			private:
+				void init() {
+					fd_ = -1;
+					data_ = NULL;
+					size_ = pos_ = 0;
+					gzip_ = false;
+					member_pos_ = NULL;
+				}
+
+				/**
+				 * @brief whether only blank lines are left, otherwise the record is damaged
+				 */
+				bool at_end(const char* begin, const char* end) {
+					if (!only_blanks(begin, end)) {
+						error_ = "damaged WARC record";
+						return false;
+					}
+					return true;
+				}
+
+				template <typename HandlerT>
+				size_t dispatch(HandlerT& handler, unsigned threads, bool html_only) {
+					Record record;
+					if (threads == 0)
+						threads = std::max(1u, std::thread::hardware_concurrency());
+
+					if (!gzip_ || threads == 1) {
+						size_t count = 0;
+						while (next(record))
+							if (!html_only || record.is_html()) {
+								handler(record);
+								++count;
+							}
+						return count;
+					}
+
+					// the members waiting for a thread, a few for each
+					utils::BoundedQueue<Member> members(threads * 4);
+					std::atomic<size_t> count(0);
+					std::mutex error_mutex;
+					std::vector<std::thread> workers;
+					for (unsigned i = 0; i < threads; ++i)
+						workers.push_back(std::thread([&]() {
+							Member member;
+							Record record;
+							while (members.pop(member)) {
+								const char* begin = member.data.data();
+								const char* member_end = begin + member.data.size();
+								const char* end;
+								while ((end = parse_record(begin, member_end, record))) {
+									record.offset = member.offset;
+									if (!html_only || record.is_html()) {
+										handler(record);
+										++count;
+									}
+									begin = end;
+								}
+								if (!only_blanks(begin, member_end)) {
+									std::lock_guard<std::mutex> lock(error_mutex);
+									if (error_.empty())
+										error_ = "damaged WARC record";
+								}
+							}
+						}));
+
+					Member member;
+					while (pos_ < size_) {
+						member.offset = pos_;
+						if (!member.inflate(data_ + pos_, size_ - pos_)) {
+							std::lock_guard<std::mutex> lock(error_mutex);
+							error_ = "damaged gzip member";
+							break;
+						}
+						pos_ += member.length;
+						members.push(std::move(member));
+					}
+					members.close();
+					for (size_t i = 0; i < workers.size(); ++i)
+						workers[i].join();
+					return count;
+				}
+
+				static bool only_blanks(const char* begin, const char* end) {
+					while (begin < end && isspace((unsigned char)*begin))
+						++begin;
+					return begin == end;
+				}
+		};
+
+		/**
+		 * @brief the outlinks of HTML records, resolved against the target URI
+		 * of each record; an extractor keeps the state of the current page, so
+		 * it is used by one thread at a time
+		 */
+		template <typename HandlerT>
+		class LinkRecordExtractor {
+			private:
+				HTML::LinkExtractor<HandlerT>	extractor_;
+
+			public:
+				LinkRecordExtractor(HandlerT& handler) : extractor_(handler) {}
+
+				size_t extract(const Record& record) {
+					if (!record.is_html())
+						return 0;
+					return extractor_.extract(record.payload_begin, record.payload_end, record.target_uri);
+				}
+
+				HTML::LinkExtractor<HandlerT>& extractor() { return extractor_; }
+		};
+	}
+}
+
+#endif /* STPL_WARC_H_ */
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WARC_HTML_H_
+#define STPL_WARC_HTML_H_
+
+#include <string>
+
+#include "stpl_warc.h"
+#include "../html/stpl_html.h"
+#include "../html/stpl_html_charset.h"
+
+namespace stpl {
+
+	namespace WARC {
+
+		/**
+		 * @brief an HTML parser reused for the payload of every HTML record
+		 *
+		 * The payload is transcoded into UTF-8 when it isn't already (the
+		 * charset of the HTTP Content-Type is used as the hint). A payload that
+		 * is used as it is, is copied into a buffer of the parser first, the
+		 * reader's mapping is read only.
+		 */
+		template <typename ParserT = HTML::HParser<icstring, char*> >
+		class HtmlRecordParser {
+			public:
+				typedef typename ParserT::document_type	document_type;
+
+			private:
+				ParserT					parser_;
+				HTML::Utf8Decoder		decoder_;
+				std::string				buffer_;
+
+			public:
+				HtmlRecordParser() : parser_(NULL, NULL) {}
+
+				document_type& parse(const Record& record) {
+					std::string hint = HTML::CharsetSniffer::content_type_charset(record.http_content_type);
+					decoder_.decode(record.payload_begin, record.payload_end - record.payload_begin, hint);
+					char* begin = decoder_.begin();
+					char* end = decoder_.end();
+					if (!decoder_.converted()) {
+						buffer_.assign(begin, end);
+						begin = buffer_.empty() ? NULL : &buffer_[0];
+						end = begin + buffer_.size();
+					}
+					parser_.reset(begin, end);
+					return parser_.parse();
+				}
+
+				ParserT& parser() { return parser_; }
+				HTML::Utf8Decoder& decoder() { return decoder_; }
+		};
+	}
+}
+
+#endif /* STPL_WARC_HTML_H_ */
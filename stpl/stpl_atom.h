@@ -20,16 +20,29 @@
 #ifndef STPL_STPL_STPL_ATOM_H_
 #define STPL_STPL_STPL_ATOM_H_
 
+#include <atomic>
+
 namespace stpl {
-    /**
-	 * The smallest object in the class chain
+	/**
+	 * The ids handed out to the atoms, a template only so the definitions can
+	 * stay in the header without breaking the one definition rule
 	 */
-	class Atom {
+	template <typename T = void>
+	class AtomCounters {
 		public:
-			static int                                      counter;
+			static std::atomic<int>                         counter;		/// the documents can be parsed in parallel
 			static int                                      max_id;
-			static int                                      line_counter;
+	};
+
+	template <typename T>
+	std::atomic<int> AtomCounters<T>::counter(0);
+	template <typename T>
+	int AtomCounters<T>::max_id = -1;
 
+    /**
+	 * The smallest object in the class chain
+	 */
+	class Atom : public AtomCounters<> {
 		protected:
 			int												id_;	
 
@@ -42,9 +55,6 @@ namespace stpl {
 				id_ = id;
 			}
 	};
-
-    int Atom::counter = 0;
-	int Atom::max_id = -1;
 }
 
 #endif /* STPL_STPL_STPL_ATOM_H_ */
@@ -89,6 +89,21 @@ namespace stpl {
 				return this->scanner_.is_end();
 			}
 
+			/**
+			 * @brief point the parser to a new input, the entities of the previous
+			 * parse are released so the same parser can be reused across documents;
+			 * not virtual, so it is only instantiated for the parsers that call it,
+			 * a document over a FileStream can't be pointed elsewhere
+			 */
+			void reset(IteratorT begin, IteratorT end)
+			{
+				doc_->clear();
+				doc_->begin(begin);
+				doc_->end(end);
+				scanner_.set(begin, end);
+				scanner_.reset_state(NULL);
+			}
+
 			DocumentT& doc() { return *doc_; }
 	};
 
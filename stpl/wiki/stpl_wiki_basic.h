@@ -27,6 +27,7 @@
 #include "../../utils/xml.h"
 
 #include "stpl_wiki_constants.h"
+#include "stpl_wiki_writer.h"
 
 #include <map>
 #include <iostream>
@@ -146,24 +147,44 @@ namespace stpl {
 				/**
 				 * By default we don't output
 				 */
-				virtual std::string to_html() {
-					return "";
+				virtual void write_html(WikiWriter& out) {
 				}
 
 				/**
 				 * By default we use what it is for html
 				 */
-				virtual std::string to_json() {
-					return "";
+				virtual void write_json(WikiWriter& out) {
 				}
 
 				/**
 				 * @brief by default we don't output
-				 * 
-				 * @return std::string 
 				 */
-				virtual std::string to_text() {
-					return "";
+				virtual void write_text(WikiWriter& out) {
+				}
+
+				/**
+				 * The renderers write into the sink given, the following are for
+				 * when a string of the entity alone is wanted
+				 */
+				std::string to_html() {
+					std::string output;
+					StringWikiWriter out(output);
+					write_html(out);
+					return output;
+				}
+
+				std::string to_json() {
+					std::string output;
+					StringWikiWriter out(output);
+					write_json(out);
+					return output;
+				}
+
+				std::string to_text() {
+					std::string output;
+					StringWikiWriter out(output);
+					write_text(out);
+					return output;
 				}
 
 				virtual void process_child(BasicWikiEntity<StringT, IteratorT>* child) {
@@ -206,7 +227,16 @@ namespace stpl {
 
 					}
 					return false;
-				}			
+				}
+
+				/**
+				 * @brief whether a text inside this entity can end on a byte that is
+				 * not one of the markup bytes, e.g. on a space of an external link;
+				 * like is_end it is up to the parent unless overridden
+				 */
+				virtual bool ends_text_on_plain_bytes() {
+					return this->parent_ptr_ && this->parent_ptr_->ends_text_on_plain_bytes();
+				}
 
 				virtual bool is_separated(IteratorT& it) {
 					return this->parent_ptr_ && this->parent_ptr_->is_delimiter(it);
@@ -268,8 +298,8 @@ namespace stpl {
 				}
 				virtual ~Text() {}
 
-				virtual std::string to_text() {
-					return this->to_std_string();
+				virtual void write_text(WikiWriter& out) {
+					out << this->to_std_string();
 				}
 
 				virtual bool is_empty() {
@@ -287,17 +317,26 @@ namespace stpl {
 					return is_empty_ == 1;
 				}
 
-				virtual std::string to_json() {
-					return this->to_html();
+				virtual void write_json(WikiWriter& out) {
+					this->write_html(out);
 				}	
 
-				virtual std::string to_html() {
-					std::string html = this->to_std_string();
+				virtual void write_html(WikiWriter& out) {
+					if (this->begin() >= this->end())
+						return;
+
+					const char* begin = &*this->begin();
+					const char* end = begin + (this->end() - this->begin());
 #ifndef DEBUG
-					// this a very time consuming part
-					utils::unescape_xml(html);
+					// the text is written as it is unless there is anything to decode
+					if (utils::needs_xml_decoding(begin, end)) {
+						std::string html;
+						utils::decode_xml(begin, end, html, false);
+						out << html;
+						return;
+					}
 #endif // !DEBUG					
-					return html;
+					out.write(begin, end - begin);
 				}						
 
 				virtual bool is_pause(IteratorT& it) {
@@ -322,6 +361,16 @@ namespace stpl {
 				 * But generally we won't end until a new enity is found which can't be just link and template
 				 */
 				 virtual bool is_end(IteratorT& it, bool advance=true) {
+					 if (advance && !wiki_markup_bytes().contains(*it)) {
+						 // none of the checks below stops on a plain byte, so the run up
+						 // to the next markup byte is taken in one go
+						 IteratorT last = plain_run_last(it);
+						 if (last > it) {
+							 it = last;
+							 return false;
+						 }
+					 }
+
 					 IteratorT from = it;
 					 /**
 					  * @brief there two special characters: - and :
@@ -380,10 +429,30 @@ namespace stpl {
 				}
 
 			private:
-				void init() { 
-					this->group_ = TEXT; 
+				void init() {
+					this->group_ = TEXT;
 					this->is_empty_ = -1;
-				}				 
+				}
+
+				/**
+				 * the last byte before the next markup byte, or it when a parent
+				 * has to see every byte
+				 */
+				IteratorT plain_run_last(IteratorT it) {
+					IteratorT limit = this->end();
+					if (this->parent_ptr_) {
+						if (this->parent_ptr_->ends_text_on_plain_bytes())
+							return it;
+						if (this->parent_ptr_->end() < limit)
+							limit = this->parent_ptr_->end();
+					}
+					if (limit <= it)
+						return it;
+
+					const char* begin = &*it;
+					const char* next = wiki_markup_bytes().find(begin, begin + (limit - it));
+					return it + ((next - begin) - 1);
+				}
 		};
 
 		/**
@@ -417,20 +486,17 @@ namespace stpl {
 				}
 				virtual ~NewLine() {}
 
-				std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					if ((this->end() - this->begin()) >= 2) {
-						std::stringstream ss;
-						if (WikiEntityVariables::tag_ind == 1) {
-							ss << "</p>";
-							WikiEntityVariables::tag_ind = 0;
+						if (out.paragraph_open()) {
+							out << "</p>";
+							out.paragraph_open(false);
 						}
 						else {
-							ss << "<p>";
-							WikiEntityVariables::tag_ind = 1;
+							out << "<p>";
+							out.paragraph_open(true);
 						}
-						return ss.str();
 					}
-					return "";
 				}
 
 				/**
@@ -446,6 +512,10 @@ namespace stpl {
 						++it;
 					return true;
 				}
+
+				virtual bool ends_text_on_plain_bytes() {
+					return true;
+				}
 		};
 
 		template <typename StringT = std::string, typename IteratorT = typename StringT::iterator>
@@ -473,12 +543,12 @@ namespace stpl {
 				}
 				virtual ~Redirect() {}
 
-				virtual std::string to_html() {
-					return this->to_std_string();
+				virtual void write_html(WikiWriter& out) {
+					out << this->to_std_string();
 				}
 
-				virtual std::string to_json() {
-					return this->to_std_string();
+				virtual void write_json(WikiWriter& out) {
+					out << this->to_std_string();
 				}						
 
 				virtual bool is_start(IteratorT& it) {
@@ -496,6 +566,10 @@ namespace stpl {
 					return false;
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					return true;
+				}
+
 				/**
 				 * For the text node, most likely it will encounter a link or template which will mark
 				 * the end of it
@@ -525,8 +599,7 @@ namespace stpl {
 				}
 				virtual ~DebugNode() {}	
 
-				virtual std::string to_html() {
-					return "";
+				virtual void write_html(WikiWriter& out) {
 				}						
 
 				virtual bool is_start(IteratorT& it) {
@@ -541,6 +614,10 @@ namespace stpl {
 					return false;
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					return true;
+				}
+
 				/**
 				 * For the text node, most likely it will encounter a link or template which will mark
 				 * the end of it
@@ -630,27 +707,30 @@ namespace stpl {
 					this->add(child);
 				}
 
-				virtual std::string to_html() {
-					return this->children_to_html(); 
+				virtual void write_html(WikiWriter& out) {
+					this->write_children_html(out); 
 				}			
 
-				virtual std::string to_text() {
-					std::stringstream ss;
+				virtual void write_text(WikiWriter& out) {
 					auto it = this->children_.begin();
 					while (it != this->children_.end()) {
-						ss << (*it++)->to_text();
+						(*it++)->write_text(out);
 					}
-					return ss.str();
 				}
 
-				virtual std::string children_to_html() {
+				virtual void write_children_html(WikiWriter& out) {
 					this->assign_output_format();
-					std::stringstream ss;
 					auto it = this->children_.begin();
 					while (it != this->children_.end()) {
-						ss << (*it++)->to_html();
+						(*it++)->write_html(out);
 					}
-					return ss.str();
+				}
+
+				std::string children_to_html() {
+					std::string output;
+					StringWikiWriter out(output);
+					write_children_html(out);
+					return output;
 				}
 
 				virtual bool is_pause(IteratorT& it) {
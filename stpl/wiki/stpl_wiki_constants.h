@@ -22,8 +22,13 @@
 #define STPL_WIKI_CONSTANTS_H_
 
 #include <map>
+#include <string>
 #include <iostream>
 
+#include <string.h>
+
+#include "../../utils/simd.h"
+
 namespace stpl {
 	namespace WIKI {
 		
@@ -158,62 +163,67 @@ namespace stpl {
 				static const char                                                   WIKI_KEY_SLASH = '/';
 				static const char                                                   WIKI_KEY_OPEN_LANGVARIANT = '-';
 				static const char                                                   WIKI_KEY_CLOSE_LANGVARIANT = '-';
-				static const char                                                  *WIKI_KEY_CHARS_STYLE_INDENT;
-				static const char                                                  *WIKI_KEY_CHARS_NEWLINE;
-				static const char                                                  *WIKI_KEY_CHARS_STYLE;
-				static const char                                                  *WIKI_KEY_CHARS_HEADING;
-				static const char                                                  *WIKI_KEY_CHARS_OPEN_TEMPLATE;
-				static const char                                                  *WIKI_KEY_CHARS_CLOSE_TEMPLATE;
-				static const char                                                  *WIKI_KEY_CHARS_OPEN_TABLE;
-				static const char                                                  *WIKI_KEY_CHARS_CLOSE_TABLE;
-				static const char                                                  *WIKI_KEY_CHARS_OPEN_LINK;
-				static const char                                                  *WIKI_KEY_CHARS_CLOSE_LINK;
-				static const char                                                  *WIKI_KEY_CHARS_OPEN_LANGVARIANT;
-				static const char                                                  *WIKI_KEY_CHARS_CLOSE_LANGVARIANT;
-
-				static std::vector<std::string> 								    IMAGE_SUFFIX_ARRAY;
+				static constexpr const char                                        *WIKI_KEY_CHARS_STYLE_INDENT = ":";
+				static constexpr const char                                        *WIKI_KEY_CHARS_NEWLINE = "\n";
+				static constexpr const char                                        *WIKI_KEY_CHARS_STYLE = "\'";
+				static constexpr const char                                        *WIKI_KEY_CHARS_HEADING = "=";
+				static constexpr const char                                        *WIKI_KEY_CHARS_OPEN_TEMPLATE = "{";
+				static constexpr const char                                        *WIKI_KEY_CHARS_CLOSE_TEMPLATE = "}";
+				static constexpr const char                                        *WIKI_KEY_CHARS_OPEN_TABLE = "{|";
+				static constexpr const char                                        *WIKI_KEY_CHARS_CLOSE_TABLE = "|}";
+				static constexpr const char                                        *WIKI_KEY_CHARS_OPEN_LINK = "[";
+				static constexpr const char                                        *WIKI_KEY_CHARS_CLOSE_LINK = "]";
+				static constexpr const char                                        *WIKI_KEY_CHARS_OPEN_LANGVARIANT = "-{";
+				static constexpr const char                                        *WIKI_KEY_CHARS_CLOSE_LANGVARIANT = "}-";
+
+				/**
+				 * every byte that can start a wiki construct or end a text run,
+				 * the rest of the text never reaches the state machine
+				 */
+				static constexpr const char                                        *WIKI_MARKUP_CHARS = "\n!#$'*-:;<=>[]{|}";
+
+				/**
+				 * @brief whether a file name is one of an image
+				 */
+				static bool is_image_file(const std::string& name) {
+					static constexpr const char* IMAGE_SUFFIXES[] = { ".jpg", ".jpeg", ".png", ".svg", ".jiff" };
+					for (size_t i = 0; i < sizeof(IMAGE_SUFFIXES) / sizeof(IMAGE_SUFFIXES[0]); ++i) {
+						size_t length = strlen(IMAGE_SUFFIXES[i]);
+						if (name.length() >= length && utils::ascii_iequals(name.data() + name.length() - length, IMAGE_SUFFIXES[i], length))
+							return true;
+					}
+					return false;
+				}
 		};
 
-		class WikiEntityVariables {
+		/**
+		 * @brief the names of the namespaces the parser tells the links apart
+		 * with, they are only read while parsing
+		 *
+		 * A template only so the definitions can stay in the header without
+		 * breaking the one definition rule.
+		 */
+		template <typename T = void>
+		class WikiEntityVariablesT {
 			public:
-				static std::string 									protocol;
-				static std::string 									path;
-				static std::string 									host;
-
-				static std::string 									html_head;
-
 				static std::string 									link_category;
 				static std::string 									link_file;
-
-				static int                                          math_ind;
-				static int                                          tag_ind;
 		};
 
-		std::string WikiEntityVariables::host = "localhost";
-		std::string WikiEntityVariables::protocol = "http";
-		std::string WikiEntityVariables::path = "/";		
-
-		std::string WikiEntityVariables::link_category = "Category";
-		std::string WikiEntityVariables::link_file = "File";
-
-		std::string WikiEntityVariables::html_head = "";
-		int WikiEntityVariables::math_ind = 0;
-		int WikiEntityVariables::tag_ind = 0;
-
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_STYLE_INDENT = ":";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_NEWLINE = "\n";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_STYLE = "\'";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_HEADING = "=";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_OPEN_TEMPLATE = "{";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_CLOSE_TEMPLATE = "}";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_OPEN_TABLE = "{|";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_CLOSE_TABLE = "|}";				
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_OPEN_LINK = "[";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_CLOSE_LINK = "]";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_OPEN_LANGVARIANT = "-{";
-		const char *WikiEntityConstants::WIKI_KEY_CHARS_CLOSE_LANGVARIANT = "}-";		
-
-		std::vector<std::string> WikiEntityConstants::IMAGE_SUFFIX_ARRAY;
+		template <typename T>
+		std::string WikiEntityVariablesT<T>::link_category = "Category";
+		template <typename T>
+		std::string WikiEntityVariablesT<T>::link_file = "File";
+
+		typedef WikiEntityVariablesT<>								WikiEntityVariables;
+
+		/**
+		 * @brief the lookup table of the markup bytes, built once
+		 */
+		inline const utils::ByteSet& wiki_markup_bytes() {
+			static const utils::ByteSet markup_bytes(WikiEntityConstants::WIKI_MARKUP_CHARS);
+			return markup_bytes;
+		}
 	}
 
 }
@@ -43,6 +43,8 @@ namespace stpl {
 				EntityT                                                             *redirect_;		
 				bool                                                                organized_;		
 
+				WikiTitleArena                                                      titles_;      // the link targets of the page
+
 			public:
 				WikiDoc() : Document<EntityT>::Document() { init(); }
 				WikiDoc(IteratorT it) : Document<EntityT>::Document(it) {
@@ -83,44 +85,63 @@ namespace stpl {
 				}
 
 				std::string to_text() {
+					std::string output;
+					output.reserve(this->length());
+					StringWikiWriter out(output);
+					write_text(out);
+					return output;
+				}
+
+				void write_text(WikiWriter& ss) {
 					organize();
-					std::stringstream ss;
 					
 					if (redirect_) {
-						ss << redirect_->to_std_string() << std::endl;
-						return ss.str();
+						ss << redirect_->to_std_string() << '\n';
+						return;
 					}
 					WikiSection<string_type, iterator> *last_section = NULL;
 					auto it = sections_.begin();
 					if (it != sections_.end()) 
 					do {
 						WikiSection<string_type, iterator> *section = (WikiSection<string_type, iterator> *)(*it);
-						ss << section->to_text() << std::endl;
+						section->write_text(ss);
+						ss << '\n';
 
-						ss << std::endl;
+						ss << '\n';
 						++it;
 					} while (it != sections_.end());
-
-					return ss.str();
 				}				
 
-				std::string to_html() {
+				/**
+				 * @brief the renderers below write the page into the sink given,
+				 * the string versions reserve their output from the size of the
+				 * source so a page takes one allocation
+				 */
+				std::string to_html(const WikiRenderContext& context = WikiRenderContext::defaults()) {
+					std::string output;
+					output.reserve(2 * this->length());
+					StringWikiWriter out(output, context);
+					write_html(out);
+					return output;
+				}
+
+				void write_html(WikiWriter& ss) {
 					organize();
-					std::stringstream ss;
 					
 					if (redirect_) {
-						ss << "<meta http-equiv='refresh' content='0;url=\"/" << redirect_->to_std_string() << "\'" << ">" << std::endl;
-						return ss.str();
+						ss << "<meta http-equiv='refresh' content='0;url=\"/" << redirect_->to_std_string() << "\'" << ">" << '\n';
+						return;
 					}
 
-					ss << "<html>" << std::endl;
-					ss << "<head>" << std::endl;
-					ss << WikiEntityVariables::html_head << std::endl;
-					ss << "</head>" << std::endl;
-					ss << "<body>" << std::endl;
+					ss << "<html>" << '\n';
+					ss << "<head>" << '\n';
+					ss << ss.context().html_head << '\n';
+					ss << "</head>" << '\n';
+					ss << "<body>" << '\n';
 
 					for (auto it = templates_.begin(); it != templates_.end(); ++it) {
-						ss << (*it)->to_html() << std::endl;
+						(*it)->write_html(ss);
+						ss << '\n';
 					}
 
 					int count = 0;
@@ -137,35 +158,36 @@ namespace stpl {
 						// }
 
 						if (count > 0 && section->get_level() <= 2)
-							ss << "</section>" << std::endl;
+							ss << "</section>" << '\n';
 
 						if (section->get_level() <= 2) {
-							ss << "<section id=\"" << count << "\">" << std::endl;
+							ss << "<section id=\"" << count << "\">" << '\n';
 							if (section->get_level() >= 2)
-								ss << "<div class=\"row\"><h2 class=\"section-title\">" << section->get_line() << "</h2></div>" << std::endl;
+								ss << "<div class=\"row\"><h2 class=\"section-title\">" << section->get_line() << "</h2></div>" << '\n';
 							if (section->size() > 0) {
-								ss << "<div class=\"row\">" << std::endl;			
-								ss << section->to_html() << std::endl;
-								ss << "</div>" << std::endl;
+								ss << "<div class=\"row\">" << '\n';			
+								section->write_html(ss);
+								ss << '\n';
+								ss << "</div>" << '\n';
 							}
 							++count;
 						}
 						else {	
 							int level = section->get_level();
-							ss << "<div class=\"row\"><h" << level << ">" << section->get_line() << "</h" << level << ">" << std::endl;
-							ss << section->to_html() << std::endl;
-							ss << "</div>" << std::endl;
+							ss << "<div class=\"row\"><h" << level << ">" << section->get_line() << "</h" << level << ">" << '\n';
+							section->write_html(ss);
+							ss << '\n';
+							ss << "</div>" << '\n';
 						}
-						ss << std::endl;
+						ss << '\n';
 						last_section = section;
 						++it;
 					} while (it != sections_.end());
 
 					if (count > 0)
-						ss << "</section>" << std::endl;	
-					ss << "</body>" << std::endl;
+						ss << "</section>" << '\n';	
+					ss << "</body>" << '\n';
 					ss << "</html>";
-					return ss.str();
 				}
 
 				/**
@@ -173,135 +195,185 @@ namespace stpl {
 				 * 
 				 * @return std::string 
 				 */
-				std::string to_trec(const char *title = "", int id = -1, int to_html = 1) {
+				std::string to_trec(const char *title = "", int id = -1, int to_html = 1,
+						const WikiRenderContext& context = WikiRenderContext::defaults()) {
+					std::string output;
+					output.reserve(2 * this->length());
+					StringWikiWriter out(output, context);
+					write_trec(out, title, id, to_html);
+					return output;
+				}
+
+				void write_trec(WikiWriter& ss, const char *title = "", int id = -1, int to_html = 1) {
 					organize();
-					std::stringstream ss;
-					ss << "<DOC>" << std::endl;
+					ss << "<DOC>" << '\n';
 					if (id > -1)
-						ss << "<DOCNO>" << id << "</DOCNO>" << std::endl;
-					ss << "<TITLE>" << title << "</TITLE>" << std::endl;
+						ss << "<DOCNO>" << id << "</DOCNO>" << '\n';
+					ss << "<TITLE>" << title << "</TITLE>" << '\n';
 					// categories
-					ss << "<CATEGORIES>" << std::endl;
+					ss << "<CATEGORIES>" << '\n';
 					for (auto it = categories_.begin(); it != categories_.end(); ++it) {			
-						ss << "<CATEGORY>" << std::endl;
-						ss << (*it)->to_text();
-						ss << "<CATEGORY>" << std::endl;
+						ss << "<CATEGORY>" << '\n';
+						(*it)->write_text(ss);
+						ss << "<CATEGORY>" << '\n';
 					}
-					ss << "</CATEGORIES>" << std::endl;
-					ss << "<TITLE>" << title << "</TITLE>" << std::endl;
-					ss << "<TEXT>" << std::endl;
+					ss << "</CATEGORIES>" << '\n';
+					ss << "<TITLE>" << title << "</TITLE>" << '\n';
+					ss << "<TEXT>" << '\n';
 					for (auto it = sections_.begin(); it != sections_.end(); ++it) {
 						// html actually contain more information than text
 						if (to_html == 1)	
-							ss << (*it)->to_html();
+							(*it)->write_html(ss);
 						else
-							ss << (*it)->to_text();
-						ss << std::endl;
+							(*it)->write_text(ss);
+						ss << '\n';
 					}
-					ss << "</TEXT>" << std::endl;
+					ss << "</TEXT>" << '\n';
 
-					ss << "<DOC>" << std::endl;
-					return ss.str();
+					ss << "<DOC>" << '\n';
 				}
 
 				std::string to_tyokiie(const char* title = "", const char* id = "", const char* extras = "") {
 					return to_json(title, id, extras, OUTPUT_TYOKIIE);
 				}				
 
-				std::string to_json(const char* title = "", const char* id = "", const char* extras = "", int format = OUTPUT_JSON) {
-					organize(format);
+				std::string to_json(const char* title = "", const char* id = "", const char* extras = "", int format = OUTPUT_JSON,
+						const WikiRenderContext& context = WikiRenderContext::defaults()) {
+					std::string output;
+					output.reserve(2 * this->length());
+					StringWikiWriter out(output, context);
+					write_json(out, title, id, extras, format);
+					return output;
+				}
 
-					std::stringstream ss;
+				/**
+				 * @brief the title and id are escaped as JSON strings
+				 */
+				void write_json(WikiWriter& ss, const char* title = "", const char* id = "", const char* extras = "", int format = OUTPUT_JSON) {
+					organize(format);
 
-					ss << "{" << std::endl;
+					ss << "{" << '\n';
 
 					if (redirect_) {
-						ss << "\"redirect\": \"" << redirect_->to_std_string() << "\"" << std::endl;
+						ss << "\"redirect\": \"" << redirect_->to_std_string() << "\"" << '\n';
 					}
 					else {
-						ss << "\"article\": {" << std::endl;
+						ss << "\"article\": {" << '\n';
 
-						ss << "\"title\": \"" << title << "\"," << std::endl;
-						ss << "\"id\": \"" << id << "\"," << std::endl;
+						ss << "\"title\": \"";
+						ss.escape_json(title, strlen(title));
+						ss << "\"," << '\n';
+						ss << "\"id\": \"";
+						ss.escape_json(id, strlen(id));
+						ss << "\"," << '\n';
 
 						int count = 0;
 						// template
-						ss << "\"templates\": [" << std::endl;
+						ss << "\"templates\": [" << '\n';
 						count = 0;
 						for (auto it = templates_.begin(); it != templates_.end(); ++it) {
-							std::string link = (*it)->to_json();
 							if (count > 0) 
-								ss << "," << std::endl;	
+								ss << "," << '\n';	
 
-							if (link.length() > 0) {
-								ss << link;
-								ss << std::endl;
-								++count;
-							}
+							(*it)->write_json(ss);
+							ss << '\n';
+							++count;
 						}
-						ss << "]," << std::endl;
+						ss << "]," << '\n';
 
 						// article section
-						ss << "\"sections\": [" << std::endl;
+						ss << "\"sections\": [" << '\n';
 						count = 0;
 						for (auto it = sections_.begin(); it != sections_.end(); ++it) {
 							if (count > 0) 
-								ss << "," << std::endl;				
-							ss << (*it)->to_json();
-							ss << std::endl;
+								ss << "," << '\n';				
+							(*it)->write_json(ss);
+							ss << '\n';
 							++count;
 						}
-						ss << "]," << std::endl;
+						ss << "]," << '\n';
 
 						// data
-						ss << "\"templates2\": [" << std::endl;
+						ss << "\"templates2\": [" << '\n';
 						count = 0;
 						for (auto it = templates2_.begin(); it != templates2_.end(); ++it) {
 							if (count > 0) 
-								ss << "," << std::endl;				
-							ss << (*it)->to_json();
-							ss << std::endl;
+								ss << "," << '\n';				
+							(*it)->write_json(ss);
+							ss << '\n';
 							++count;
 						}
-						ss << "]," << std::endl;
+						ss << "]," << '\n';
 
 						// categories
-						ss << "\"categories\": [" << std::endl;
+						ss << "\"categories\": [" << '\n';
 						count = 0;
 						for (auto it = categories_.begin(); it != categories_.end(); ++it) {
 							if (count > 0) 
-								ss << "," << std::endl;				
-							ss << (*it)->to_json();
+								ss << "," << '\n';				
+							(*it)->write_json(ss);
 							++count;
 						}
-						ss << "]" << std::endl;
+						ss << "]" << '\n';
 
 						// images
 						if (images_.size() > 0) {
 							count = 0;
-							ss << "," << std::endl;
-							ss << "\"image\": [" << std::endl;
+							ss << "," << '\n';
+							ss << "\"image\": [" << '\n';
 							for (auto it = images_.begin(); it != images_.end(); ++it) {
 								if (count > 0) 
-									ss << "," << std::endl;				
-								ss << (*it)->to_json();
-								ss << std::endl;
+									ss << "," << '\n';				
+								(*it)->write_json(ss);
+								ss << '\n';
 								++count;
 							}
-							ss << "]" << std::endl;
+							ss << "]" << '\n';
 						}
 
-						ss << "}" << std::endl;	
+						ss << "}" << '\n';	
 
 						if (strlen(extras) > 0) {
-							ss << "," << std::endl;
-							ss << "\"extras\": " << extras << std::endl;
+							ss << "," << '\n';
+							ss << "\"extras\": " << extras << '\n';
 						}								
 					}
 
-					ss << "}" << std::endl;
+					ss << "}" << '\n';
+				}
+
+				/**
+				 * @brief take over the top level entities of a document parsed
+				 * from the text right after this one, see WikiSectionParser
+				 */
+				void append(WikiDoc& other) {
+					container_type& nodes = other.children();
+					for (auto it = nodes.begin(); it != nodes.end(); ++it)
+						this->add(*it);
+					nodes.clear();
+
+					if (organized_) {
+						clear_sections();
+						templates_.clear();
+						templates2_.clear();
+						images_.clear();
+						categories_.clear();
+						redirect_ = NULL;
+						organized_ = false;
+					}
+				}
+
+				/**
+				 * @brief the canonical titles the links of the page are to, in the
+				 * order they appear, each interned in titles()
+				 */
+				void link_targets(std::vector<WikiTitleArena::id_type>& targets) {
+					targets.clear();
+					collect_targets(this->children(), targets);
+				}
 
-					return ss.str();
+				WikiTitleArena& titles() {
+					return titles_;
 				}
 
 				bool isorganized() const {
@@ -313,6 +385,21 @@ namespace stpl {
 				}
 
 			private:
+				template <typename ContainerT>
+				void collect_targets(ContainerT& nodes, std::vector<WikiTitleArena::id_type>& targets) {
+					for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+						if (!*it)
+							continue;
+						if ((*it)->get_group() == LINK) {
+							WikiTitleArena::id_type id = ((Link<StringT, IteratorT> *)(*it))->target(titles_);
+							if (id != WikiTitleArena::NO_ID)
+								targets.push_back(id);
+						}
+						if ((*it)->should_have_children())
+							collect_targets(((WikiEntity<StringT, IteratorT> *)(*it))->children(), targets);
+					}
+				}
+
 				void clear_sections() {
 					auto it = sections_.begin();
 					while (it != sections_.end()) {
@@ -382,7 +469,7 @@ namespace stpl {
 									if (link->children().size() > 0) {
 										auto child = link->children().begin();
 										std::string link_text = (*child)->to_std_string();
-										if (utils::ends_with(link_text, WikiEntityConstants::IMAGE_SUFFIX_ARRAY)) {
+										if (WikiEntityConstants::is_image_file(link_text)) {
 											templates_.push_back(*child);
 										}
 									}
@@ -467,14 +554,6 @@ namespace stpl {
 				void init() {
 					organized_ = false;
 					redirect_ = NULL;
-
-					if (WikiEntityConstants::IMAGE_SUFFIX_ARRAY.size() == 0) {
-						WikiEntityConstants::IMAGE_SUFFIX_ARRAY.push_back(".jpg");
-						WikiEntityConstants::IMAGE_SUFFIX_ARRAY.push_back(".jpeg");
-						WikiEntityConstants::IMAGE_SUFFIX_ARRAY.push_back(".png");
-						WikiEntityConstants::IMAGE_SUFFIX_ARRAY.push_back(".svg");
-						WikiEntityConstants::IMAGE_SUFFIX_ARRAY.push_back(".jiff");
-					}
 				}
 		};
 
@@ -550,6 +629,13 @@ namespace stpl {
 							return parent_ptr;
 					}
 
+					/**
+					 * only the markup bytes can start a construct, anything else is
+					 * text and doesn't need to go through the checks below
+					 */
+					if (it < end && !wiki_markup_bytes().contains(*it))
+						return text_entity(begin, it, end, parent_ptr);
+
 					/**
 					 * We only need the openings, and let the entity finish itself
 					 * but for the text node, we won't be able to do so, so anything that is between those
@@ -1118,22 +1204,7 @@ namespace stpl {
 							// otherwise, if something bad happened, it will get stuck
 							// no key char found, things are much simpler
 							if (new_entity_check_passed == 0 || (new_entity_check_passed == 1 && new_entity_start == 1)) {
-								begin = it;
-								if (parent_ptr->should_have_children()) {
-									// none of obvious entity is found, so let take it as a text node
-									// there could be a few cases here
-									// 1. parent has started with text but not in text node
-									// this is handled in create text pre function
-									// 2. parent has pushed child(ren) in
-									// this is in the middle of it
-									// 3. if parent has no child(ren) yet
-									// this is the first one, so it would hurt either
-									EntityT *text_ptr = parent_ptr->create_child(begin, end);
-									text_ptr->set_parent(parent_ptr);							
-									return text_ptr;
-								}
-								else
-									return parent_ptr;
+								return text_entity(begin, it, end, parent_ptr);
 							}
 							else {
 								if (new_entity_check_passed == 1 && new_entity_start == 0) {
@@ -1187,6 +1258,33 @@ namespace stpl {
 					}
 					return entity_ptr;
 				}
+
+				/**
+				 * none of obvious entity is found at it, so it is taken as a text node
+				 */
+				EntityT* text_entity(IteratorT& begin, IteratorT it, IteratorT end, EntityT* parent_ptr) {
+					begin = it;
+					if (parent_ptr && parent_ptr->isopen()) {
+						if (!parent_ptr->should_have_children())
+							return parent_ptr;
+						// there could be a few cases here
+						// 1. parent has started with text but not in text node
+						// this is handled in create text pre function
+						// 2. parent has pushed child(ren) in
+						// this is in the middle of it
+						// 3. if parent has no child(ren) yet
+						// this is the first one, so it would hurt either
+						EntityT *text_ptr = parent_ptr->create_child(begin, end);
+						text_ptr->set_parent(parent_ptr);
+						return text_ptr;
+					}
+
+					EntityT *text_ptr = new Text<StringT, IteratorT>(begin, end);
+					if (parent_ptr && parent_ptr->should_have_children()) {
+						text_ptr->set_parent(parent_ptr);
+					}
+					return text_ptr;
+				}
 		};
 
 		template <
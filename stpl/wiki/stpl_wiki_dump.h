@@ -0,0 +1,411 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_WIKI_DUMP_H_
+#define STPL_WIKI_DUMP_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <bzlib.h>
+
+#include "../../utils/xml.h"
+
+namespace stpl {
+
+	namespace WIKI {
+
+		/**
+		 * @brief one <page> record of a MediaWiki XML dump
+		 */
+		struct WikiPage {
+			std::string		title;
+			int				ns;
+			long long		id;
+			std::string		redirect;		/// the target of <redirect title="..."/>
+			std::string		text;			/// the wikitext, with the XML escapes decoded
+
+			WikiPage() { clear(); }
+
+			void clear() {
+				title.clear();
+				redirect.clear();
+				text.clear();
+				ns = 0;
+				id = 0;
+			}
+		};
+
+		class WikiDumpPage {
+			public:
+				/**
+				 * @brief find the next <page> ... </page> record in [begin, end)
+				 *
+				 * @return false if there is no complete page record in the range
+				 */
+				static bool find(const char* begin, const char* end, const char*& page_begin, const char*& page_end) {
+					page_begin = search(begin, end, "<page>", 6);
+					if (!page_begin)
+						return false;
+					page_end = search(page_begin + 6, end, "</page>", 7);
+					if (!page_end)
+						return false;
+					page_end += 7;
+					return true;
+				}
+
+				/**
+				 * @brief fill the fields of a page from a <page> ... </page> record
+				 */
+				static bool parse(const char* begin, const char* end, WikiPage& page, bool with_text = true) {
+					page.clear();
+
+					const char* revision = search(begin, end, "<revision", 9);
+					const char* head_end = revision ? revision : end;
+
+					if (!element(begin, head_end, "title", page.title))
+						return false;
+					utils::unescape_xml(page.title);
+
+					std::string value;
+					if (element(begin, head_end, "ns", value))
+						page.ns = atoi(value.c_str());
+					// the first <id> is the page id, the revision has its own
+					if (element(begin, head_end, "id", value))
+						page.id = atoll(value.c_str());
+
+					const char* redirect = search(begin, head_end, "<redirect title=\"", 17);
+					if (redirect) {
+						redirect += 17;
+						const char* quote = static_cast<const char*>(memchr(redirect, '"', head_end - redirect));
+						if (quote) {
+							page.redirect.assign(redirect, quote);
+							utils::unescape_xml(page.redirect);
+						}
+					}
+
+					if (with_text && revision) {
+						const char* text = search(revision, end, "<text", 5);
+						if (text) {
+							const char* gt = static_cast<const char*>(memchr(text, '>', end - text));
+							if (gt && gt[-1] != '/') {
+								const char* text_end = search(gt + 1, end, "</text>", 7);
+								if (text_end) {
+									page.text.assign(gt + 1, text_end);
+									utils::unescape_xml(page.text);
+								}
+							}
+						}
+					}
+					return true;
+				}
+
+				/**
+				 * @brief the content of the first <name>...</name> element in the range
+				 */
+				static bool element(const char* begin, const char* end, const char* name, std::string& value) {
+					std::string open = std::string("<") + name + ">";
+					std::string close = std::string("</") + name + ">";
+					const char* start = search(begin, end, open.c_str(), open.length());
+					if (!start)
+						return false;
+					start += open.length();
+					const char* stop = search(start, end, close.c_str(), close.length());
+					if (!stop)
+						return false;
+					value.assign(start, stop);
+					return true;
+				}
+
+				static const char* search(const char* begin, const char* end, const char* what, size_t len) {
+					while (begin && end - begin >= (long)len) {
+						begin = static_cast<const char*>(memchr(begin, what[0], end - begin - len + 1));
+						if (!begin)
+							return NULL;
+						if (memcmp(begin, what, len) == 0)
+							return begin;
+						++begin;
+					}
+					return NULL;
+				}
+		};
+
+		/**
+		 * @brief reads the <page> records of a dump one by one, from an XML file,
+		 * a bzip2 compressed one (single or multistream), or stdin ("-")
+		 *
+		 * Only the page being read is kept in memory, offset() is the position
+		 * in the uncompressed input right after the last page returned. For a
+		 * multistream dump stream() is the compressed offset of the bz2 stream
+		 * that position is in and stream_offset() the position in that stream,
+		 * so a reader can be put back there without decompressing what is
+		 * before the stream.
+		 */
+		class WikiDumpReader {
+			public:
+				enum { DUMP_OK = 0, DUMP_ERROR = -1 };
+				enum { CHUNK_SIZE = 1 << 20 };
+
+			private:
+				typedef std::pair<long long, long long>		stream_type;	/// uncompressed and compressed offset of a bz2 stream
+
+				FILE*			fp_;
+				BZFILE*			bzf_;
+				bool			compressed_;
+				bool			eof_;
+				std::string		buffer_;
+				size_t			pos_;
+				long long		buffer_offset_;		/// input offset of buffer_[0]
+				std::vector<stream_type>	streams_;	/// from the one buffer_[0] is in
+				std::string		filename_;
+				std::string		error_;
+
+			public:
+				WikiDumpReader() { init(); }
+				virtual ~WikiDumpReader() { close(); }
+
+				int open(const std::string& filename) {
+					close();
+					filename_ = filename;
+					error_.clear();
+					if (filename == "-")
+						fp_ = stdin;
+					else if (!(fp_ = fopen(filename.c_str(), "rb"))) {
+						error_ = "unable to open dump file: " + filename;
+						return DUMP_ERROR;
+					}
+
+					compressed_ = filename.length() > 4 && filename.compare(filename.length() - 4, 4, ".bz2") == 0;
+					if (compressed_) {
+						int bzerror;
+						bzf_ = BZ2_bzReadOpen(&bzerror, fp_, 0, 0, NULL, 0);
+						if (bzerror != BZ_OK) {
+							error_ = "unable to read compressed dump file: " + filename;
+							close();
+							return DUMP_ERROR;
+						}
+						streams_.push_back(stream_type(0, 0));
+					}
+					return DUMP_OK;
+				}
+
+				void close() {
+					if (bzf_) {
+						int bzerror;
+						BZ2_bzReadClose(&bzerror, bzf_);
+					}
+					if (fp_ && fp_ != stdin)
+						fclose(fp_);
+					init();
+				}
+
+				const std::string& error() const { return error_; }
+
+				long long offset() const { return buffer_offset_ + pos_; }
+
+				/**
+				 * @return the compressed offset of the bz2 stream offset() is in, 0
+				 * if the dump is not compressed
+				 */
+				long long stream() const {
+					return streams_.empty() ? 0 : streams_[current_stream()].second;
+				}
+
+				/**
+				 * @return offset() from the beginning of stream()
+				 */
+				long long stream_offset() const {
+					return streams_.empty() ? offset() : offset() - streams_[current_stream()].first;
+				}
+
+				/**
+				 * @brief continue reading from a position returned by stream() and
+				 * stream_offset() earlier, or by offset() with stream 0; the reader
+				 * resyncs on the next <page> from there
+				 *
+				 * A compressed dump is decompressed from the beginning of the stream
+				 * up to the offset, that is from the start of the file for a dump
+				 * of a single stream, and offset() counts from the stream on. stdin
+				 * can't be repositioned.
+				 */
+				int seek(long long offset, long long stream = 0) {
+					if (!fp_ || fp_ == stdin) {
+						error_ = "the input can't be repositioned";
+						return DUMP_ERROR;
+					}
+
+					if (!compressed_) {
+						if (fseeko(fp_, offset, SEEK_SET) != 0) {
+							error_ = "unable to seek in the dump";
+							return DUMP_ERROR;
+						}
+						buffer_.clear();
+						pos_ = 0;
+						buffer_offset_ = offset;
+						eof_ = false;
+						return DUMP_OK;
+					}
+
+					if (open(std::string(filename_)) != DUMP_OK)
+						return DUMP_ERROR;
+					if (stream > 0) {
+						int bzerror;
+						BZ2_bzReadClose(&bzerror, bzf_);
+						bzf_ = NULL;
+						if (fseeko(fp_, stream, SEEK_SET) != 0
+								|| (bzf_ = BZ2_bzReadOpen(&bzerror, fp_, 0, 0, NULL, 0), bzerror != BZ_OK)) {
+							error_ = "unable to seek to the stream in the dump";
+							close();
+							return DUMP_ERROR;
+						}
+						streams_.assign(1, stream_type(0, stream));
+					}
+					while (buffer_offset_ + (long long) buffer_.size() < offset) {
+						discard(buffer_.size());
+						if (!fill()) {
+							error_ = "the offset is beyond the end of the dump";
+							return DUMP_ERROR;
+						}
+					}
+					discard(offset - buffer_offset_);
+					return DUMP_OK;
+				}
+
+				bool next(WikiPage& page) {
+					for (;;) {
+						const char* begin = buffer_.data() + pos_;
+						const char* end = buffer_.data() + buffer_.size();
+						const char* page_begin;
+						const char* page_end;
+						if (WikiDumpPage::find(begin, end, page_begin, page_end)) {
+							pos_ = page_end - buffer_.data();
+							if (WikiDumpPage::parse(page_begin, page_end, page))
+								return true;
+							continue;
+						}
+
+						// keep the partial page, or the tail a "<page>" may start in
+						size_t keep_from = page_begin ? page_begin - buffer_.data()
+									: (buffer_.size() > 6 ? std::max(pos_, buffer_.size() - 6) : pos_);
+						discard(keep_from);
+
+						if (!fill())
+							return false;
+					}
+				}
+
+			private:
+				void init() {
+					fp_ = NULL;
+					bzf_ = NULL;
+					compressed_ = false;
+					eof_ = false;
+					buffer_.clear();
+					pos_ = 0;
+					buffer_offset_ = 0;
+					streams_.clear();
+				}
+
+				void discard(size_t n) {
+					buffer_.erase(0, n);
+					buffer_offset_ += n;
+					pos_ = pos_ > n ? pos_ - n : 0;
+					while (streams_.size() > 1 && streams_[1].first <= buffer_offset_)
+						streams_.erase(streams_.begin());
+				}
+
+				/**
+				 * the last stream starting at or before offset()
+				 */
+				size_t current_stream() const {
+					size_t i = streams_.size() - 1;
+					while (i > 0 && streams_[i].first > offset())
+						--i;
+					return i;
+				}
+
+				bool fill() {
+					if (eof_ || !fp_)
+						return false;
+
+					size_t used = buffer_.size();
+					buffer_.resize(used + CHUNK_SIZE);
+					int n = 0;
+					if (compressed_) {
+						int bzerror;
+						n = BZ2_bzRead(&bzerror, bzf_, &buffer_[used], CHUNK_SIZE);
+						if (bzerror == BZ_STREAM_END)
+							next_stream(buffer_offset_ + (long long) used + (n > 0 ? n : 0));
+						else if (bzerror != BZ_OK) {
+							error_ = "damaged compressed dump";
+							eof_ = true;
+						}
+					}
+					else {
+						n = fread(&buffer_[used], 1, CHUNK_SIZE, fp_);
+						if (n < CHUNK_SIZE)
+							eof_ = true;
+					}
+					buffer_.resize(used + (n > 0 ? n : 0));
+					return n > 0 || !eof_;
+				}
+
+				/**
+				 * @brief continue with the next bz2 stream of a multistream file,
+				 * its data starts at offset
+				 */
+				void next_stream(long long offset) {
+					void* unused;
+					int nunused, bzerror;
+					char left[BZ_MAX_UNUSED];
+					BZ2_bzReadGetUnused(&bzerror, bzf_, &unused, &nunused);
+					if (bzerror != BZ_OK) {
+						eof_ = true;
+						return;
+					}
+					memcpy(left, unused, nunused);
+					BZ2_bzReadClose(&bzerror, bzf_);
+					bzf_ = NULL;
+					if (nunused == 0 && (feof(fp_) || ungetc(getc(fp_), fp_) == EOF)) {
+						eof_ = true;
+						return;
+					}
+					long long position = ftello(fp_);
+					bzf_ = BZ2_bzReadOpen(&bzerror, fp_, 0, 0, left, nunused);
+					if (bzerror != BZ_OK) {
+						error_ = "damaged compressed dump";
+						eof_ = true;
+						return;
+					}
+					// the bytes read ahead are the beginning of the stream
+					if (position >= 0)
+						streams_.push_back(stream_type(offset, position - nunused));
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_DUMP_H_ */
@@ -25,9 +25,9 @@
 #include <cassert>
 #include <map>
 #include <list>
-#include <regex>
 
 #include "stpl_wiki_basic.h"
+#include "stpl_wiki_title.h"
 
 #include "../stpl_property.h"
 
@@ -63,13 +63,13 @@ namespace stpl {
 				virtual ~CommonChildEntity() {
 				}
 
-				virtual std::string to_text() {
-					return WikiEntity<StringT, IteratorT>::to_text();
+				virtual void write_text(WikiWriter& out) {
+					WikiEntity<StringT, IteratorT>::write_text(out);
 				}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					if (this->children().size() == 0) 
-						return "";
+						return;
 					
 					this->assign_output_format();
 					/**
@@ -79,33 +79,26 @@ namespace stpl {
 					WikiNodeGroup group = this->parent_ptr_->get_group();
 					WikiNodeType type = this->parent_ptr_->get_type();
 					if (group == LINK && type == LINK_EXTERNAL) {
-						std::stringstream ss;
 						auto first = this->children().begin();
 						auto second = first + 1;
-						ss << "<a href=\"";
-						ss << (*first)->to_std_string();
-						ss << "\">";
+						out << "<a href=\"";
+						out << (*first)->to_std_string();
+						out << "\">";
 
 						// now the anchor text
 						// the anchor text could be a compound entity
 						if (second != this->children().end())
-							ss << (*second)->to_html();
+							(*second)->write_html(out);
 						// we are using the url as the anchor text
 						else
-							ss << (*first)->to_std_string();
-						ss << "</a> ";
-						return ss.str();
+							out << (*first)->to_std_string();
+						out << "</a> ";
+						return;
 					}
 					
-					std::stringstream ss;
-
 					auto it = this->children_.begin();
 					for (; it != this->children_.end(); ++it)
-						ss << (*it)->to_html();
-
-					return ss.str();
-
-					return this->to_std_string();
+						(*it)->write_html(out);
 				}
 
 				virtual bool is_child_end(WikiNodeGroup group, WikiNodeType type, IteratorT& it) {
@@ -181,68 +174,71 @@ namespace stpl {
 				virtual std::string to_std_string() {
 					this->assign_output_format();
 					if (this->children_.size() > 0) {
-						stringstream ss;
+						std::string output;
+						StringWikiWriter out(output);
 						auto it = this->children_.begin();
 						while (it != this->children_.end()) {
-							ss << (*it++)->to_html();
+							(*it++)->write_html(out);
 						}
-						return ss.str();
+						return output;
 					}
 					return BasicWikiEntity<StringT, IteratorT>::to_std_string();
 				}
 
-				virtual std::string to_json() {
+				virtual void write_json(WikiWriter& out) {
 					this->assign_output_format();
 
-					stringstream ss;
-					ss << "{" << std::endl;
+					out << "{" << '\n';
 					auto it = this->children_.begin();
-					ss << "\"name\": ";
+					out << "\"name\": ";
 					if (this->has_delimiter_) {
-						ss << "\"" << std::string(this->name_.begin(), this->name_.end()) << "\",";
-						ss << "\"value\": ";
-						ss <<  "\"";
+						out << "\"" << std::string(this->name_.begin(), this->name_.end()) << "\",";
+						out << "\"value\": ";
+						out <<  "\"";
 						it = it + name_count_;
 						// ss << name << "=";
 						// if (this->has_quote())
 						// 	ss << "\"";
 						while (it != this->children_.end()) {
 							(*it)->set_output_format(this->get_output_format());
-							std::string content = (*it++)->to_html();
-							ss << utils::escape_quote(content);
+							WikiWriter::EscapeQuotes escape(out);
+							(*it++)->write_html(out);
 						}
 
-						ss << "\"" << std::endl;
+						out << "\"" << '\n';
 					}
 					else {
-						std::string content = this->children_to_html();
-						ss <<  "\"" << utils::escape_quote(content) << "\"" << std::endl;	
+						out <<  "\"";
+						{
+							WikiWriter::EscapeQuotes escape(out);
+							this->write_children_html(out);
+						}
+						out << "\"" << '\n';	
 					}			
-					ss << "}" << std::endl;	
-					return ss.str();
+					out << "}" << '\n';	
 				}
 
-				virtual std::string to_text() {
-					return "";
+				virtual void write_text(WikiWriter& out) {
 				};
 
 				/**
 				 * For all properties, it could be a property name or property value, which is decided by 
 				 * the appearing order
 				 */
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
 
-					stringstream ss;
 					auto it = this->children_.begin();
 
-					ss << "<property";
+					out << "<property";
 					if (this->has_delimiter_) {
-						ss << " name=\"";
-						std::string name = std::string(this->name_.begin(), this->name_.end());
-						name = utils::escape_quote(name);
+						out << " name=\"";
+						{
+							WikiWriter::EscapeQuotes escape(out);
+							out << std::string(this->name_.begin(), this->name_.end());
+						}
 
-						ss << name << "\">";
+						out << "\">";
 						if (this->children_.size() > 0) {
 							// name is a child too
 							it = it + name_count_;
@@ -250,31 +246,24 @@ namespace stpl {
 							// if (this->has_quote())
 							// 	ss << "\"";
 							while (it != this->children_.end()) {
-								ss << (*it++)->to_html();
+								(*it++)->write_html(out);
 							}
 
 							// if (this->has_quote())
 							// 	ss << "\"";
 						}
 						else {
-							std::string value;
 							//if (this->has_delimiter()) {
-							value = this->value_.to_std_string();
-							value = std::regex_replace(value, std::regex("'"), "&apos;");
-							value = std::regex_replace(value, std::regex("\""), "&quot;");
-							ss << value;
+							out.escape_html(this->value_.to_std_string(), true);
 								//return name + "=\"" + value + "\"";
 							//}
 						}
 					}
 					else {
-						ss << ">";
-						ss << this->children_to_html();
+						out << ">";
+						this->write_children_html(out);
 					}
-					ss << "</property>";
-	
-					//return Property<StringT, IteratorT>::to_std_string();
-					return ss.str();
+					out << "</property>";
 				}
 
 				virtual bool is_start(IteratorT& it) {
@@ -422,8 +411,8 @@ namespace stpl {
 				}
 				virtual ~WikiSection() {};
 
-				virtual std::string to_json() {
-					return to_output(this->get_output_format());
+				virtual void write_json(WikiWriter& out) {
+					write_output(out, this->get_output_format());
 				}
 							
 				int get_id() const {
@@ -453,33 +442,32 @@ namespace stpl {
 				 * 
 				 * @param format 0 json, 1 html, 2 text, 3 tyokiie
 				 */
-				std::string to_output(int format = 0) {
+				void write_output(WikiWriter& out, int format = 0) {
 
-					stringstream ss;
-					ss << "{" << std::endl;
-					ss << "\"id\": "  << "\"" << this->get_id() << "\"," << std::endl;
+					out << "{" << '\n';
+					out << "\"id\": "  << "\"" << this->get_id() << "\"," << '\n';
 					if (this->get_level() > 0) {
-						ss << "\"level\": " << "\"" << this->get_level() << "\"," << std::endl;
-						ss << "\"line\": "  << "\"" << this->get_line() << "\"," << std::endl;
+						out << "\"level\": " << "\"" << this->get_level() << "\"," << '\n';
+						out << "\"line\": "  << "\"" << this->get_line() << "\"," << '\n';
 					}
-					std::string content;
-					content  = this->children_to_html();
-					content .erase(std::remove(content .begin(), content .end(), '\n'), content .end());
-					ss <<  "\"text\": "  << "\"" << utils::escape_quote(content ) << "\"" << std::endl;
-					ss <<  "}" << std::endl;
-
-					return ss.str();
+					out <<  "\"text\": "  << "\"";
+					{
+						WikiWriter::StripNewlines strip(out);
+						WikiWriter::EscapeQuotes escape(out);
+						this->write_children_html(out);
+					}
+					out << "\"" << '\n';
+					out <<  "}" << '\n';
 				}
 
-				virtual std::string children_to_html() {
-					stringstream ss;
+				virtual void write_children_html(WikiWriter& out) {
 					// ss << "<p>";
-					WikiEntityVariables::tag_ind = 0;
-					ss << WikiEntity<StringT, IteratorT>::children_to_html();
-					if (WikiEntityVariables::tag_ind == 1) {
-						ss << "</p>";
+					out.paragraph_open(false);
+					WikiEntity<StringT, IteratorT>::write_children_html(out);
+					if (out.paragraph_open()) {
+						out << "</p>";
+						out.paragraph_open(false);
 					}
-					return ss.str();
 				}
 		};
 
@@ -516,8 +504,7 @@ namespace stpl {
 				}
 				virtual ~TableCell() {};
 
-				virtual std::string to_text() {
-					return "";
+				virtual void write_text(WikiWriter& out) {
 				}			
 
 				int get_cell_id() const {
@@ -535,6 +522,11 @@ namespace stpl {
 					return false;
 				}					
 
+				virtual bool ends_text_on_plain_bytes() {
+					// only a newline or a pipe ends a cell
+					return false;
+				}
+
 				virtual bool is_end(IteratorT& it, bool advance=true) {
 					// no, newline is not end yet
 				    if (*it == '\n') {
@@ -626,13 +618,20 @@ namespace stpl {
 				}
 				virtual ~ListItem() {};
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
-					return "<li>" + WikiEntity<StringT, IteratorT>::to_html() + "</li>";
+					out << "<li>";
+					WikiEntity<StringT, IteratorT>::write_html(out);
+					out << "</li>";
 				}
 
 				virtual void set_key_char() = 0;					
 
+				virtual bool ends_text_on_plain_bytes() {
+					// only a newline ends an item, the parent isn't asked
+					return false;
+				}
+
 				virtual bool is_end(IteratorT& it, bool advance=true) {
 					if (*it == '\n') {
 						// if (this->last_child_ && it > this->last_child_->end()) {
@@ -795,6 +794,11 @@ namespace stpl {
 					return this;
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					// a list ends on anything but its key char
+					return true;
+				}
+
 			private:
 				void init() { 
 					this->set_group(LAYOUT_LIST);
@@ -823,9 +827,11 @@ namespace stpl {
 				virtual ~LayoutUnorderedList() {
 				}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
-					return "<ul>" + LayoutList<StringT, IteratorT>::to_html() + "</ul>";
+					out << "<ul>";
+					LayoutList<StringT, IteratorT>::write_html(out);
+					out << "</ul>";
 				}
 
 				virtual bool is_start(IteratorT& it) {
@@ -883,9 +889,11 @@ namespace stpl {
 				}
 				virtual ~LayoutOrderedList() {}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
-					return "<ol>" + LayoutList<StringT, IteratorT>::to_html() + "</ol>";
+					out << "<ol>";
+					LayoutList<StringT, IteratorT>::write_html(out);
+					out << "</ol>";
 				}
 
 				virtual bool is_end(IteratorT& it, bool advance=true) {
@@ -1131,16 +1139,16 @@ namespace stpl {
 				}
 				virtual ~LangVariantProperty() {};
 
-				virtual std::string to_html() {
-					return this->to_std_string();
+				virtual void write_html(WikiWriter& out) {
+					out << this->to_std_string();
 				}
 
-				virtual std::string to_json() {
-					return this->to_std_string();
+				virtual void write_json(WikiWriter& out) {
+					out << this->to_std_string();
 				}
 
-				virtual std::string to_text() {
-					return this->to_std_string();
+				virtual void write_text(WikiWriter& out) {
+					out << this->to_std_string();
 				}
 
 				virtual std::string to_std_string() {
@@ -1339,18 +1347,27 @@ namespace stpl {
 				}
 				virtual ~Style() {}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
 
-					if (this->level_ == 2)
-						// return "<span style=\"font-style: italic;\">" + WikiEntityLeveled<StringT, IteratorT>::to_html() + "</span>";
-						return "<i>" + WikiEntityLeveled<StringT, IteratorT>::to_html() + "</i>";
-					else if (this->level_ == 3)
-						return "<b>" + WikiEntityLeveled<StringT, IteratorT>::to_html() + "</b>";
-					else if (this->level_ == 5)
-						return "<b><i>" + WikiEntityLeveled<StringT, IteratorT>::to_html() + "</i></b>";
-					else
-						return WikiEntityLeveled<StringT, IteratorT>::to_html();
+					const char* open = "";
+					const char* close = "";
+					if (this->level_ == 2) {
+						// <span style="font-style: italic;">
+						open = "<i>";
+						close = "</i>";
+					}
+					else if (this->level_ == 3) {
+						open = "<b>";
+						close = "</b>";
+					}
+					else if (this->level_ == 5) {
+						open = "<b><i>";
+						close = "</i></b>";
+					}
+					out << open;
+					WikiEntityLeveled<StringT, IteratorT>::write_html(out);
+					out << close;
 				}
 
 				virtual void set_wiki_key_char() override {
@@ -1409,6 +1426,11 @@ namespace stpl {
 				virtual ~StyleIndent() {}
 
 			public:
+				virtual bool ends_text_on_plain_bytes() {
+					// only a newline ends an indent
+					return false;
+				}
+
 				virtual bool is_end(IteratorT& it, bool advance=true) {
 					if (*it == '\n') {
 						return true;
@@ -1424,16 +1446,12 @@ namespace stpl {
 					return true;
 				}
 				
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
 
-					std::stringstream ss;
-					
-					ss << "<div class=\"textindent" << this->level_ << "\"" << ">" << std::endl;
-					ss << this->children_to_html();
-					ss << "</div>" << std::endl;
-					
-					return ss.str();
+					out << "<div class=\"textindent" << this->level_ << "\"" << ">" << '\n';
+					this->write_children_html(out);
+					out << "</div>" << '\n';
 				}							
 
 			protected:
@@ -1491,6 +1509,11 @@ namespace stpl {
 					return external_;
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					// the url of an external link ends on a space
+					return this->get_type() == LINK_EXTERNAL || WikiEntityLeveled<StringT, IteratorT>::ends_text_on_plain_bytes();
+				}
+
 				virtual bool is_start(IteratorT& it) {
 					bool ret = WikiEntityLeveled<StringT, IteratorT>::is_start(it);
 					if (ret) {
@@ -1530,11 +1553,11 @@ namespace stpl {
 								if (*it == ':') {
 								// ok, now we backward to see what kind of link it is
 									IteratorT pre = this->begin() + this->level_;
-									std::string link_kind = std::string(pre, it);
-									if (utils::iccompare(link_kind, WikiEntityVariables::link_category)) {
+									const WikiNamespaceName* ns = WikiNamespaceTable::defaults().find(pre, it);
+									if (ns && ns->id == NS_CATEGORY) {
 										this->set_type(LINK_CATEGORY);
 									}
-									else if (utils::iccompare(link_kind, WikiEntityVariables::link_file)) {
+									else if (ns && ns->id == NS_FILE) {
 										this->set_type(LINK_IMAGE);
 									}
 									// we need to move forward otherwise it will be stopped
@@ -1570,20 +1593,33 @@ namespace stpl {
 					url_ = url;
 				}
 
-				virtual std::string to_text() {
-					std::stringstream ss;
+				/**
+				 * @brief the canonical title of the page the link is to, interned
+				 * in titles; NO_ID for an external link or one to a section of
+				 * the same page
+				 */
+				WikiTitleArena::id_type target(WikiTitleArena& titles) {
+					if (this->external_ || this->children_.size() == 0)
+						return WikiTitleArena::NO_ID;
+					BasicWikiEntity<StringT, IteratorT>* first = *this->children_.begin();
+					return titles.intern(first->begin(), first->end());
+				}
+
+				virtual void write_text(WikiWriter& out) {
 					if (this->get_type() == LINK_IMAGE)
-						return "";
+						return;
 					else if (this->get_type() == LINK_EXTERNAL)
-						return "";
+						return;
 					auto first = this->children_.begin();
 					std::string url = (*first)->to_text();
 
-					ss << (this->get_type() == LINK_CATEGORY ? url.substr(9) : url);
+					out << (this->get_type() == LINK_CATEGORY ? url.substr(9) : url);
 					auto second = this->children_.end() - 1;
-					if (second > first)
-						ss << "(" << (*second)->to_text() <<  ") ";
-					return ss.str();
+					if (second > first) {
+						out << "(";
+						(*second)->write_text(out);
+						out <<  ") ";
+					}
 				}
 
 				/**
@@ -1591,13 +1627,12 @@ namespace stpl {
 				 * 
 				 * @param format 0 json, 1 html, 2 text, 3 tyokiie
 				 */
-				std::string to_output(int format = 0) {				
+				void write_output(WikiWriter& ss, int format = 0) {				
 					if (this->children_.size() == 0)
-						return "";
+						return;
 						
 					auto first = this->children_.begin();
 					auto second = this->children_.end() - 1;
-					stringstream ss;
 					if (this->get_type() == LINK_IMAGE) {
 						ss << "<div class=\"placeholder\" style=\"display:none;\"";
 						// must be a file link
@@ -1609,44 +1644,41 @@ namespace stpl {
 							}
 						}
 
-						ss << ">" << std::endl;
+						ss << ">" << '\n';
 
-						ss << "<div class='innerlink'>" << std::endl;
+						ss << "<div class='innerlink'>" << '\n';
 						ss << "<a href=\"";
-						std::string img_url;
-						img_url =  WikiEntityVariables::path + (*first)->to_std_string();
-						// }
-						ss << img_url;
+						ss << ss.context().path << (*first)->to_std_string();
 						ss << "\">";
-						ss << "<img src=\"" << "\">" << std::endl;
-						ss << "</img>" << std::endl;
-						ss << "</a>" << std::endl;
-						ss << "<div class='linkcaption'>" << std::endl;
-						ss << (*second)->to_html();
-						ss << "</div>" << std::endl;
-						ss << "</div>" << std::endl;
+						ss << "<img src=\"" << "\">" << '\n';
+						ss << "</img>" << '\n';
+						ss << "</a>" << '\n';
+						ss << "<div class='linkcaption'>" << '\n';
+						(*second)->write_html(ss);
+						ss << "</div>" << '\n';
+						ss << "</div>" << '\n';
 
-						ss << "</div>" << std::endl;
+						ss << "</div>" << '\n';
 					}
 					else {
 						if (this->external_) {
 							// as external link use space to break
 							// the child will be CommonChildProperty type
-							ss << (*first)->to_html();
+							(*first)->write_html(ss);
 						}
 						else {
 							if (format == 3)
 								ss << "<span id=\"" << this->get_id() << "\" to=\"" << (*first)->to_std_string() <<  "\" type=\"link\" available=\"no\" url=\"";
 							else
 								ss << "<a href=\"";	
-							ss << WikiEntityVariables::protocol << "://" + WikiEntityVariables::host << WikiEntityVariables::path <<  (*first)->to_std_string();
+							ss << ss.context().protocol << "://" << ss.context().host << ss.context().path <<  (*first)->to_std_string();
 							
 							ss << "\">";
 
 							// now the anchor text
 							// the anchor text could be a compound entity
 							if (second > first)
-								ss << (*second)->to_html();
+								(*second)->write_html(ss);
 							// we are using the url as the anchor text
 							else
 								ss << (*first)->to_std_string();
@@ -1656,53 +1688,51 @@ namespace stpl {
 								ss << "</a> ";							
 						}
 					}
-
-					return ss.str();
 				}
 
 				/**
 				 * For the link things might get a bit interesting
 				 * 
 				 */
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& out) {
 					this->assign_output_format();
-					return to_output(this->get_output_format());
+					write_output(out, this->get_output_format());
 				}
 
-				virtual std::string to_json() {			
-					if (this->children_.size() == 0)
-						return "{url: \"\"}";
+				virtual void write_json(WikiWriter& ss) {			
+					if (this->children_.size() == 0) {
+						ss << "{url: \"\"}";
+						return;
+					}
 
 					this->assign_output_format();
 
 					auto first = this->children_.begin();
 					auto second = this->children_.end() - 1;
-					stringstream ss;
-					ss << "{" << std::endl;
+					ss << "{" << '\n';
 					if (second > first) {
-						std::string html = (*second)->to_html();
-						html = utils::escape_quote(html);
 						if (this->children().size() > 2) {
 							ss << "\"caption\":\"";
-							ss << html;
-							ss  << "\"," << std::endl;
+							write_escaped_html(ss, *second);
+							ss  << "\"," << '\n';
 							ss << "\"properties\": [";
 							auto it = first + 1;
 							int count = 0;
 							while (it < second) {
 								if (count > 0)
 									ss << ",";
-								std::string content =  (*it)->to_html();
-								ss << "\"" << utils::escape_quote(content) << "\"" ;
+								ss << "\"";
+								write_escaped_html(ss, *it);
+								ss << "\"" ;
 								++it;
 								++count;
 							}
-							ss  << "]," << std::endl;
+							ss  << "]," << '\n';
 						}
 						else {
 							ss << "\"anchor\":\"";
-							ss << html;
-							ss  << "\"," << std::endl;
+							write_escaped_html(ss, *second);
+							ss  << "\"," << '\n';
 						}
 					}
 					ss << "\"url\":\"";
@@ -1710,11 +1740,15 @@ namespace stpl {
 						ss << (*first)->to_std_string();
 					}
 					else {
-						ss /* << WikiEntityVariables::path */ <<  (*first)->to_std_string();
+						ss /* << ss.context().path */ <<  (*first)->to_std_string();
 					}
-					ss << "\"" << std::endl;
-					ss << "}" << std::endl;
-					return ss.str();
+					ss << "\"" << '\n';
+					ss << "}" << '\n';
+				}
+
+				static void write_escaped_html(WikiWriter& out, BasicWikiEntity<StringT, IteratorT>* entity) {
+					WikiWriter::EscapeQuotes escape(out);
+					entity->write_html(out);
 				}
 
 				virtual std::string to_std_string() {
@@ -1889,7 +1923,7 @@ namespace stpl {
 					#endif // DEBUG
 				}
 
-				void print_last_cell(std::ostream &ss, TableCell<StringT, IteratorT> *last_format, std::vector<TableCell<StringT, IteratorT>* >& last_cells, int rows, bool row_header, bool& first_col) {
+				void print_last_cell(WikiWriter& ss, TableCell<StringT, IteratorT> *last_format, std::vector<TableCell<StringT, IteratorT>* >& last_cells, int rows, bool row_header, bool& first_col) {
 					if (!last_format)
 						return;
 
@@ -1923,37 +1957,36 @@ namespace stpl {
 						for (int i = 0; i < last_cells.size(); ++i) {
 							auto cell = last_cells[i];
 							if (i == 0)
-								ss << cell->to_html();
+								cell->write_html(ss);
 							else {
 								ss << "|";
-								ss << cell->to_html();
+								cell->write_html(ss);
 							}
 						}
 					}
 					else if (last_format)
-						ss << last_format->to_html();
+						last_format->write_html(ss);
 
 					if (rows == 0 && row_header) {
-						ss << "</th>" << std::endl;
+						ss << "</th>" << '\n';
 					}
 					else {
-						ss << "</td>" << std::endl;
+						ss << "</td>" << '\n';
 					}
 					last_format = NULL;
 					last_cells.clear();
 				}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& ss) {
 					this->assign_output_format();
 
-					std::stringstream ss;
 					ss << "<table";
 					if (style_.length() > 0) {
 						std::string table_style = style_.to_std_string();
 						utils::unescape_xml(table_style);
 						ss << " " << table_style;
 					}
-					ss << ">" << std::endl;;
+					ss << ">" << '\n';
 					int rows = -1;
 					int cols = -1;
 					auto it = this->children_.begin();
@@ -1970,9 +2003,9 @@ namespace stpl {
 							}
 
 							if (rows > 0) {
-								ss << "</tr>" << std::endl;
+								ss << "</tr>" << '\n';
 							}
-							ss << "<tr>" << std::endl;
+							ss << "<tr>" << '\n';
 							cols = 0;
 							++rows;
 							last_cells.clear();
@@ -2009,10 +2042,10 @@ namespace stpl {
 								// fill up the missing cells
 								for (int i = 1; i < skip_cells; ++i) {
 									if (rows == 0 && row_header) {
-										ss << "<th ></th>" << std::endl;
+										ss << "<th ></th>" << '\n';
 									}
 									else
-										ss << "<td ></td>" << std::endl;
+										ss << "<td ></td>" << '\n';
 								}
 								last_cell_id += skip_cells - 1;
 							}
@@ -2045,9 +2078,8 @@ namespace stpl {
 
 					print_last_cell(ss, last_format, last_cells, rows, row_header, first_col);
 					if (rows > 0)
-						ss << "</tr>" << std::endl;
+						ss << "</tr>" << '\n';
 					ss << "</table>";
-					return ss.str();
 				}
 
 				virtual bool is_start(IteratorT& it) {
@@ -2179,6 +2211,11 @@ namespace stpl {
 					return false;
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					// a table ends on its own boundary
+					return false;
+				}
+
 				/**
 				 * It has clear end boundary, it end only when a boundary is seen
 				 */
@@ -2274,29 +2311,26 @@ namespace stpl {
 					return new WikiProperty<StringT, IteratorT>(begin, end);
 				}
 
-				virtual std::string to_json() {
+				virtual void write_json(WikiWriter& ss) {
 					this->assign_output_format();
 
-					std::stringstream ss;
-					ss << "{" << std::endl;
-					ss << "\"name\": \"" << this->name_.to_std_string() << "\"," << std::endl;
-					ss << "\"properties\": [" << std::endl;
+					ss << "{" << '\n';
+					ss << "\"name\": \"" << this->name_.to_std_string() << "\"," << '\n';
+					ss << "\"properties\": [" << '\n';
 					auto it = this->children_.begin();
 					while (it != this->children_.end()) {
 						if (it > this->children_.begin())
 							ss << ",";
-						ss << (*it)->to_json();
+						(*it)->write_json(ss);
 						++it;
 					}
-					ss << "]" << std::endl;
-					ss << "}" << std::endl;
-					return ss.str();
+					ss << "]" << '\n';
+					ss << "}" << '\n';
 				}
 
-				virtual std::string to_html() {
+				virtual void write_html(WikiWriter& ss) {
 					this->assign_output_format();
 
-					std::stringstream ss;
 					int count = 0;
 					std::string name = this->name_.to_std_string();
 					if (("lang") == name.substr(0, 4)) {
@@ -2329,20 +2363,24 @@ namespace stpl {
 						ss << "<template ";
 						ss << " name=\"" << name << "\">";
 						while (it != this->children_.end()) {
-							ss  << (*it)->to_html();
+							(*it)->write_html(ss);
 
 							++count;
 							++it;
 						}
 						ss << "</template>";
 					}
-					return ss.str();
 				}
 
 				virtual bool is_pause(IteratorT& it) {
 					return (*it == '|');
 				}
 
+				virtual bool ends_text_on_plain_bytes() {
+					// a template ends on its own boundary
+					return false;
+				}
+
 				virtual bool is_end(IteratorT& it, bool advance = true) {
 					if (*it == '}') {
 						IteratorT next = it + 1;
@@ -0,0 +1,397 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_META_H_
+#define STPL_WIKI_META_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <stdio.h>
+
+#include "stpl_wiki_constants.h"
+#include "../../utils/simd.h"
+#include "../../utils/intern.h"
+
+/**
+ * A fast path for the metadata of a page: the link targets, the categories,
+ * the redirect and the templates with their parameters
+ *
+ * Only [[ ]], {{ }}, {{{ }}} and the pipes and equal signs inside them are
+ * looked at, the text in between is skipped to the next of those bytes
+ * without building any entity. Styles, tables, lists and sections are not
+ * recognised at all. Comments, <nowiki>, <pre> and <math> are stepped over.
+ * The strings go into a StringInterner that can be shared by all the pages of
+ * a dump, the page itself only keeps flat vectors of ids.
+ */
+namespace stpl {
+	namespace WIKI {
+
+		typedef utils::StringInterner::id_type		wiki_string_id;
+
+		struct WikiMetaProperty {
+			wiki_string_id		name;			/// the positional parameters are named "1", "2" ...
+			wiki_string_id		value;
+		};
+
+		struct WikiMetaTemplate {
+			wiki_string_id		name;
+			size_t				first;			/// the first parameter in WikiMeta::properties
+			size_t				count;
+		};
+
+		struct WikiMeta {
+			wiki_string_id						redirect;
+			std::vector<wiki_string_id>			links;
+			std::vector<wiki_string_id>			categories;
+			std::vector<WikiMetaTemplate>		templates;		/// in the order they are opened
+			std::vector<WikiMetaProperty>		properties;
+
+			WikiMeta() { clear(); }
+
+			bool is_redirect() const {
+				return redirect != utils::StringInterner::NO_ID;
+			}
+
+			void clear() {
+				redirect = utils::StringInterner::NO_ID;
+				links.clear();
+				categories.clear();
+				templates.clear();
+				properties.clear();
+			}
+		};
+
+		class WikiMetaExtractor {
+			private:
+				enum FrameType { FRAME_LINK, FRAME_TEMPLATE, FRAME_PARAMETER };
+
+				/**
+				 * an open [[, {{ or {{{
+				 */
+				struct Frame {
+					FrameType		type;
+					const char*		part;			/// where the current part begins
+					const char*		equals;			/// the first '=' of the current part
+					const char*		target_end;		/// the first '|' of a link
+					size_t			index;			/// the template in WikiMeta::templates
+					size_t			pending;		/// its first parameter in pending_
+					int				positional;
+				};
+
+				utils::StringInterner&				strings_;
+				WikiMeta*							meta_;
+				std::vector<Frame>					frames_;
+				std::vector<WikiMetaProperty>		pending_;	/// the parameters of the open templates
+
+			public:
+				WikiMetaExtractor(utils::StringInterner& strings) : strings_(strings), meta_(NULL) {}
+				~WikiMetaExtractor() {}
+
+				utils::StringInterner& strings() { return strings_; }
+
+				/**
+				 * @brief extract the metadata of the wikitext in [begin, end) into meta
+				 */
+				void extract(const char* begin, const char* end, WikiMeta& meta) {
+					static const utils::ByteSet markup_bytes("[]{}|=\n<");
+
+					meta.clear();
+					meta_ = &meta;
+					frames_.clear();
+					pending_.clear();
+
+					const char* p = redirect(begin, end);
+					while ((p = markup_bytes.find(p, end)) < end) {
+						const char* next = p + 1;
+						switch (*p) {
+							case '[':
+								if (next < end && *next == '[') {
+									open(FRAME_LINK, p + 2);
+									++next;
+								}
+								break;
+							case ']':
+								if (next < end && *next == ']' && top(FRAME_LINK)) {
+									close_link(p);
+									++next;
+								}
+								break;
+							case '{':
+								if (next < end && *next == '{') {
+									if (next + 1 < end && next[1] == '{') {
+										open(FRAME_PARAMETER, p + 3);
+										next += 2;
+									}
+									else {
+										open(FRAME_TEMPLATE, p + 2);
+										++next;
+									}
+								}
+								break;
+							case '}':
+								if (next < end && *next == '}')
+									next = close_brace(p, end);
+								break;
+							case '|':
+								if (top(FRAME_TEMPLATE))
+									next_part(p);
+								else if (top(FRAME_LINK) && !frames_.back().target_end)
+									frames_.back().target_end = p;
+								break;
+							case '=':
+								if (top(FRAME_TEMPLATE) && !frames_.back().equals)
+									frames_.back().equals = p;
+								break;
+							case '\n':
+								// a link target doesn't go over a line
+								if (top(FRAME_LINK) && !frames_.back().target_end)
+									frames_.pop_back();
+								break;
+							case '<':
+								next = skip_tag(p, end);
+								break;
+						}
+						p = next;
+					}
+
+					// the templates left open at the end of the page are taken as they are
+					while (!frames_.empty()) {
+						if (frames_.back().type == FRAME_TEMPLATE)
+							close_template(end);
+						else
+							frames_.pop_back();
+					}
+					meta_ = NULL;
+				}
+
+				void extract(const std::string& text, WikiMeta& meta) {
+					extract(text.data(), text.data() + text.length(), meta);
+				}
+
+			private:
+				bool top(FrameType type) const {
+					return !frames_.empty() && frames_.back().type == type;
+				}
+
+				void open(FrameType type, const char* part) {
+					Frame frame;
+					frame.type = type;
+					frame.part = part;
+					frame.equals = NULL;
+					frame.target_end = NULL;
+					frame.index = 0;
+					frame.pending = pending_.size();
+					frame.positional = 0;
+					if (type == FRAME_TEMPLATE) {
+						frame.index = meta_->templates.size();
+						WikiMetaTemplate tmpl = { utils::StringInterner::NO_ID, 0, 0 };
+						meta_->templates.push_back(tmpl);
+					}
+					frames_.push_back(frame);
+				}
+
+				/**
+				 * }} closes a template, }}} a parameter; the links left open
+				 * inside them are dropped
+				 *
+				 * @return where to go on from
+				 */
+				const char* close_brace(const char* p, const char* end) {
+					size_t i = frames_.size();
+					while (i > 0 && frames_[i - 1].type == FRAME_LINK)
+						--i;
+					if (i == 0)
+						return p + 2;
+
+					FrameType type = frames_[i - 1].type;
+					if (type == FRAME_PARAMETER && (p + 2 >= end || p[2] != '}'))
+						return p + 2;
+					frames_.resize(i);
+					if (type == FRAME_PARAMETER) {
+						frames_.pop_back();
+						return p + 3;
+					}
+					close_template(p);
+					return p + 2;
+				}
+
+				void next_part(const char* p) {
+					Frame& frame = frames_.back();
+					WikiMetaTemplate& tmpl = meta_->templates[frame.index];
+					if (tmpl.name == utils::StringInterner::NO_ID)
+						tmpl.name = intern_trimmed(frame.part, p);
+					else
+						add_property(frame, p);
+					frame.part = p + 1;
+					frame.equals = NULL;
+				}
+
+				void close_template(const char* p) {
+					next_part(p);
+
+					Frame& frame = frames_.back();
+					WikiMetaTemplate& tmpl = meta_->templates[frame.index];
+					tmpl.first = meta_->properties.size();
+					tmpl.count = pending_.size() - frame.pending;
+					meta_->properties.insert(meta_->properties.end(), pending_.begin() + frame.pending, pending_.end());
+					pending_.resize(frame.pending);
+					frames_.pop_back();
+				}
+
+				/**
+				 * name=value, or a positional value which is kept as it is, like
+				 * MediaWiki does
+				 */
+				void add_property(Frame& frame, const char* end) {
+					WikiMetaProperty property;
+					if (frame.equals) {
+						property.name = intern_trimmed(frame.part, frame.equals);
+						property.value = intern_trimmed(frame.equals + 1, end);
+					}
+					else {
+						char name[16];
+						int length = snprintf(name, sizeof(name), "%d", ++frame.positional);
+						property.name = strings_.intern(name, length);
+						property.value = strings_.intern(frame.part, end - frame.part);
+					}
+					pending_.push_back(property);
+				}
+
+				void close_link(const char* p) {
+					Frame frame = frames_.back();
+					frames_.pop_back();
+
+					const char* begin = frame.part;
+					const char* end = frame.target_end ? frame.target_end : p;
+					trim(begin, end);
+
+					// [[:Category:..]] is a link to the category, not a categorisation
+					bool colon = begin < end && *begin == ':';
+					if (colon)
+						++begin;
+					if (!colon) {
+						const char* name = category(begin, end);
+						if (name) {
+							if (name < end)
+								meta_->categories.push_back(strings_.intern(name, end - name));
+							return;
+						}
+					}
+
+					// the fragment is not part of the target, [[#..]] is on the same page
+					end = utils::find_char(begin, end, '#');
+					trim(begin, end);
+					if (begin < end)
+						meta_->links.push_back(strings_.intern(begin, end - begin));
+				}
+
+				/**
+				 * @return the category name of a Category: target, NULL for the
+				 * other targets
+				 */
+				const char* category(const char* begin, const char* end) {
+					const std::string& prefix = WikiEntityVariables::link_category;
+					if ((size_t) (end - begin) <= prefix.length() || !utils::ascii_iequals(begin, prefix.data(), prefix.length()))
+						return NULL;
+					const char* p = begin + prefix.length();
+					while (p < end && (*p == ' ' || *p == '_'))
+						++p;
+					if (p == end || *p != ':')
+						return NULL;
+					++p;
+					trim(p, end);
+					return p;
+				}
+
+				/**
+				 * #REDIRECT [[target]] at the beginning of the page
+				 *
+				 * @return where the scan goes on from
+				 */
+				const char* redirect(const char* begin, const char* end) {
+					const char* p = begin;
+					while (p < end && isspace((unsigned char) *p))
+						++p;
+					if (end - p < 9 || *p != '#' || !utils::ascii_iequals(p + 1, "REDIRECT", 8))
+						return begin;
+					p += 9;
+					while (p < end && (isspace((unsigned char) *p) || *p == ':'))
+						++p;
+					if (end - p < 2 || p[0] != '[' || p[1] != '[')
+						return begin;
+
+					const char* target = p + 2;
+					const char* close = target;
+					while (close < end && *close != ']' && *close != '|' && *close != '\n')
+						++close;
+					const char* target_end = utils::find_char(target, close, '#');
+					trim(target, target_end);
+					if (target < target_end)
+						meta_->redirect = strings_.intern(target, target_end - target);
+					return close;
+				}
+
+				/**
+				 * skip a comment or the content of the tags whose content is not
+				 * wikitext
+				 *
+				 * @return where the scan goes on from
+				 */
+				const char* skip_tag(const char* p, const char* end) {
+					static const char* const RAW_TAGS[] = { "nowiki", "pre", "math" };
+
+					if (end - p >= 4 && p[1] == '!' && p[2] == '-' && p[3] == '-') {
+						static const char COMMENT_END[] = "-->";
+						const char* close = std::search(p + 4, end, COMMENT_END, COMMENT_END + 3);
+						return close == end ? end : close + 3;
+					}
+
+					for (size_t i = 0; i < sizeof(RAW_TAGS) / sizeof(RAW_TAGS[0]); ++i) {
+						size_t length = strlen(RAW_TAGS[i]);
+						const char* q = p + 1 + length;
+						if (q >= end || !utils::ascii_iequals(p + 1, RAW_TAGS[i], length) || (*q != '>' && *q != ' ' && *q != '/'))
+							continue;
+						const char* gt = utils::find_char(q, end, '>');
+						if (gt == end || gt[-1] == '/')
+							return gt == end ? end : gt + 1;
+						gt = utils::find_char(utils::find_end_tag(gt + 1, end, RAW_TAGS[i], length), end, '>');
+						return gt == end ? end : gt + 1;
+					}
+					return p + 1;
+				}
+
+				wiki_string_id intern_trimmed(const char* begin, const char* end) {
+					trim(begin, end);
+					return strings_.intern(begin, end - begin);
+				}
+
+				static void trim(const char*& begin, const char*& end) {
+					while (begin < end && isspace((unsigned char) *begin))
+						++begin;
+					while (end > begin && isspace((unsigned char) end[-1]))
+						--end;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_META_H_ */
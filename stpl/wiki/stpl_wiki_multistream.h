@@ -0,0 +1,457 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_WIKI_MULTISTREAM_H_
+#define STPL_WIKI_MULTISTREAM_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include <stdio.h>
+#include <bzlib.h>
+
+#include "stpl_wiki_dump.h"
+
+namespace stpl {
+
+	namespace WIKI {
+
+		/**
+		 * @brief title -> (stream offset, page id) index of a pages-articles-multistream dump
+		 *
+		 * The index file has the layout of the one published with the dump, one
+		 * "offset:page id:title" line per page, plain or bzip2 compressed.
+		 */
+		class MultistreamIndex {
+			public:
+				enum { INDEX_OK = 0, INDEX_ERROR = -1 };
+
+				struct Location {
+					long long	offset;		/// offset of the bz2 stream holding the page
+					long long	id;
+
+					Location() : offset(0), id(0) {}
+					Location(long long o, long long i) : offset(o), id(i) {}
+				};
+
+				typedef std::unordered_map<std::string, Location>	map_type;
+
+			private:
+				map_type					titles_;
+				std::vector<long long>		offsets_;	/// the distinct stream offsets, sorted
+				std::string					error_;
+
+			public:
+				MultistreamIndex() {}
+				virtual ~MultistreamIndex() {}
+
+				size_t size() const { return titles_.size(); }
+				const std::string& error() const { return error_; }
+
+				void clear() {
+					titles_.clear();
+					offsets_.clear();
+				}
+
+				void add(const std::string& title, long long offset, long long id) {
+					titles_[title] = Location(offset, id);
+					offsets_.push_back(offset);
+				}
+
+				/**
+				 * @brief sort the stream offsets, needs to be called after add()
+				 */
+				void finish() {
+					std::sort(offsets_.begin(), offsets_.end());
+					offsets_.erase(std::unique(offsets_.begin(), offsets_.end()), offsets_.end());
+				}
+
+				bool find(const std::string& title, Location& location) const {
+					map_type::const_iterator it = titles_.find(title);
+					if (it == titles_.end()) {
+						// titles in links may use underscores for spaces
+						std::string spaced(title);
+						std::replace(spaced.begin(), spaced.end(), '_', ' ');
+						if (spaced == title || (it = titles_.find(spaced)) == titles_.end())
+							return false;
+					}
+					location = it->second;
+					return true;
+				}
+
+				/**
+				 * @brief the offset the stream starting at offset ends at, -1 for the last one
+				 */
+				long long stream_end(long long offset) const {
+					std::vector<long long>::const_iterator it = std::upper_bound(offsets_.begin(), offsets_.end(), offset);
+					return it == offsets_.end() ? -1 : *it;
+				}
+
+				/**
+				 * @brief load an index file, compressed with bzip2 if the name ends with .bz2
+				 */
+				int load(const std::string& filename) {
+					clear();
+					FILE* fp = fopen(filename.c_str(), "rb");
+					if (!fp) {
+						error_ = "unable to open index file: " + filename;
+						return INDEX_ERROR;
+					}
+
+					bool compressed = filename.length() > 4 && filename.compare(filename.length() - 4, 4, ".bz2") == 0;
+					int bzerror = BZ_OK;
+					BZFILE* bzf = compressed ? BZ2_bzReadOpen(&bzerror, fp, 0, 0, NULL, 0) : NULL;
+					if (compressed && bzerror != BZ_OK) {
+						fclose(fp);
+						error_ = "unable to read compressed index file: " + filename;
+						return INDEX_ERROR;
+					}
+
+					char buffer[65536];
+					std::string line;
+					for (;;) {
+						int n;
+						if (compressed) {
+							n = BZ2_bzRead(&bzerror, bzf, buffer, sizeof(buffer));
+							if (bzerror != BZ_OK && bzerror != BZ_STREAM_END)
+								break;
+						}
+						else
+							n = fread(buffer, 1, sizeof(buffer), fp);
+						if (n <= 0)
+							break;
+
+						const char* p = buffer;
+						const char* end = buffer + n;
+						while (p < end) {
+							const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+							if (!eol) {
+								line.append(p, end);
+								break;
+							}
+							line.append(p, eol);
+							add_line(line);
+							line.clear();
+							p = eol + 1;
+						}
+						// the index of a multistream dump is itself a multistream bz2 file
+						if (compressed && bzerror == BZ_STREAM_END && !next_bz_stream(bzf, fp, bzerror))
+							break;
+					}
+					if (!line.empty())
+						add_line(line);
+
+					bool failed = compressed && bzerror != BZ_OK && bzerror != BZ_STREAM_END;
+					if (compressed)
+						BZ2_bzReadClose(&bzerror, bzf);
+					fclose(fp);
+					finish();
+
+					if (failed) {
+						error_ = "damaged compressed index file: " + filename;
+						return INDEX_ERROR;
+					}
+					return INDEX_OK;
+				}
+
+				int save(const std::string& filename) const {
+					FILE* fp = fopen(filename.c_str(), "wb");
+					if (!fp)
+						return INDEX_ERROR;
+
+					std::vector<std::pair<Location, const std::string*> > entries;
+					entries.reserve(titles_.size());
+					for (map_type::const_iterator it = titles_.begin(); it != titles_.end(); ++it)
+						entries.push_back(std::make_pair(it->second, &it->first));
+					std::sort(entries.begin(), entries.end(), by_offset);
+
+					for (size_t i = 0; i < entries.size(); ++i)
+						fprintf(fp, "%lld:%lld:%s\n", entries[i].first.offset, entries[i].first.id, entries[i].second->c_str());
+					return fclose(fp) == 0 ? INDEX_OK : INDEX_ERROR;
+				}
+
+				/**
+				 * @brief build the index by decompressing the whole dump once, for a
+				 * dump that comes without its index file
+				 */
+				int build(const std::string& dump_filename) {
+					clear();
+					FILE* fp = fopen(dump_filename.c_str(), "rb");
+					if (!fp) {
+						error_ = "unable to open dump file: " + dump_filename;
+						return INDEX_ERROR;
+					}
+
+					std::vector<char> in(1 << 20);
+					std::vector<char> out(1 << 20);
+					std::string stream;
+					long long consumed = 0;		// compressed bytes before the current stream
+					long long stream_offset = 0;
+					int ret = BZ_OK;
+
+					bz_stream bz;
+					memset(&bz, 0, sizeof(bz));
+					BZ2_bzDecompressInit(&bz, 0, 0);
+
+					size_t n = 0;
+					while (ret == BZ_OK || ret == BZ_STREAM_END) {
+						if (bz.avail_in == 0) {
+							consumed += n;
+							if ((n = fread(&in[0], 1, in.size(), fp)) == 0)
+								break;
+							bz.next_in = &in[0];
+							bz.avail_in = n;
+						}
+						bz.next_out = &out[0];
+						bz.avail_out = out.size();
+						ret = BZ2_bzDecompress(&bz);
+						stream.append(&out[0], out.size() - bz.avail_out);
+
+						if (ret == BZ_STREAM_END) {
+							add_stream(stream, stream_offset);
+							stream.clear();
+							stream_offset = consumed + (n - bz.avail_in);
+
+							// start over for the next stream with the input left
+							char* next_in = bz.next_in;
+							unsigned int avail_in = bz.avail_in;
+							BZ2_bzDecompressEnd(&bz);
+							memset(&bz, 0, sizeof(bz));
+							BZ2_bzDecompressInit(&bz, 0, 0);
+							bz.next_in = next_in;
+							bz.avail_in = avail_in;
+							ret = BZ_OK;
+						}
+					}
+					BZ2_bzDecompressEnd(&bz);
+					fclose(fp);
+					finish();
+
+					if (ret != BZ_OK || !stream.empty()) {
+						error_ = "damaged dump file: " + dump_filename;
+						return INDEX_ERROR;
+					}
+					return INDEX_OK;
+				}
+
+			private:
+				static bool by_offset(const std::pair<Location, const std::string*>& a, const std::pair<Location, const std::string*>& b) {
+					return a.first.offset < b.first.offset || (a.first.offset == b.first.offset && a.first.id < b.first.id);
+				}
+
+				void add_line(const std::string& line) {
+					std::string::size_type first = line.find(':');
+					if (first == std::string::npos)
+						return;
+					std::string::size_type second = line.find(':', first + 1);
+					if (second == std::string::npos)
+						return;
+					std::string::size_type len = line.length();
+					if (len > 0 && line[len - 1] == '\r')
+						--len;
+					add(line.substr(second + 1, len - second - 1), atoll(line.c_str()), atoll(line.c_str() + first + 1));
+				}
+
+				void add_stream(const std::string& stream, long long offset) {
+					const char* p = stream.data();
+					const char* end = p + stream.size();
+					const char* page_begin;
+					const char* page_end;
+					WikiPage page;
+					while (WikiDumpPage::find(p, end, page_begin, page_end)) {
+						if (WikiDumpPage::parse(page_begin, page_end, page, false))
+							add(page.title, offset, page.id);
+						p = page_end;
+					}
+				}
+
+				/**
+				 * @brief reopen the bz2 reader after a stream end, with the unused input
+				 */
+				static bool next_bz_stream(BZFILE*& bzf, FILE* fp, int& bzerror) {
+					void* unused;
+					int nunused;
+					char left[BZ_MAX_UNUSED];
+					BZ2_bzReadGetUnused(&bzerror, bzf, &unused, &nunused);
+					if (bzerror != BZ_OK)
+						return false;
+					memcpy(left, unused, nunused);
+					BZ2_bzReadClose(&bzerror, bzf);
+					if (nunused == 0 && feof(fp))
+						return (bzf = NULL, bzerror = BZ_STREAM_END, false);
+					bzf = BZ2_bzReadOpen(&bzerror, fp, 0, 0, left, nunused);
+					return bzerror == BZ_OK;
+				}
+		};
+
+		/**
+		 * @brief random page access to a pages-articles-multistream dump, only the
+		 * bz2 stream holding the page is read and decompressed
+		 *
+		 * 		MultistreamDump dump;
+		 * 		WikiParser<std::string, std::string::iterator> parser(empty.begin(), empty.end());
+		 * 		if (dump.open(dump_file, index_file) == MultistreamDump::DUMP_OK
+		 * 				&& dump.parse("Albert Einstein", page, parser))
+		 * 			std::cout << parser.doc().to_text();
+		 */
+		class MultistreamDump {
+			public:
+				enum { DUMP_OK = 0, DUMP_ERROR = -1 };
+
+			private:
+				FILE*				fp_;
+				long long			size_;
+				MultistreamIndex	index_;
+				std::vector<char>	compressed_;
+				std::string			stream_;
+				std::string			error_;
+
+			public:
+				MultistreamDump() : fp_(NULL), size_(0) {}
+				virtual ~MultistreamDump() { close(); }
+
+				/**
+				 * @brief open the dump with its index file, the index is built from the
+				 * dump (and saved if a file name is given) when it cannot be loaded
+				 */
+				int open(const std::string& dump_filename, const std::string& index_filename = "") {
+					close();
+					if (!(fp_ = fopen(dump_filename.c_str(), "rb"))) {
+						error_ = "unable to open dump file: " + dump_filename;
+						return DUMP_ERROR;
+					}
+					fseeko(fp_, 0, SEEK_END);
+					size_ = ftello(fp_);
+
+					if (index_filename.empty() || index_.load(index_filename) != MultistreamIndex::INDEX_OK) {
+						if (index_.build(dump_filename) != MultistreamIndex::INDEX_OK) {
+							error_ = index_.error();
+							return DUMP_ERROR;
+						}
+						if (!index_filename.empty())
+							index_.save(index_filename);
+					}
+					return DUMP_OK;
+				}
+
+				void close() {
+					if (fp_)
+						fclose(fp_);
+					fp_ = NULL;
+				}
+
+				MultistreamIndex& index() { return index_; }
+				const std::string& error() const { return error_; }
+
+				/**
+				 * @brief read the page with the given title, false if the title is not
+				 * in the index or the stream can't be read
+				 */
+				bool find(const std::string& title, WikiPage& page) {
+					MultistreamIndex::Location location;
+					if (!index_.find(title, location))
+						return false;
+					return read(location, page);
+				}
+
+				/**
+				 * @brief read the page and parse its wikitext with the given (reused) parser,
+				 * the document refers to page.text so the page has to outlive it
+				 */
+				template <typename ParserT>
+				bool parse(const std::string& title, WikiPage& page, ParserT& parser) {
+					if (!find(title, page))
+						return false;
+					parser.reset(page.text.begin(), page.text.end());
+					parser.parse();
+					return true;
+				}
+
+				bool read(const MultistreamIndex::Location& location, WikiPage& page) {
+					if (!fp_ || !decompress(location.offset))
+						return false;
+
+					const char* p = stream_.data();
+					const char* end = p + stream_.size();
+					const char* page_begin;
+					const char* page_end;
+					while (WikiDumpPage::find(p, end, page_begin, page_end)) {
+						if (WikiDumpPage::parse(page_begin, page_end, page, false) && page.id == location.id)
+							return WikiDumpPage::parse(page_begin, page_end, page);
+						p = page_end;
+					}
+					error_ = "page not found in its stream";
+					return false;
+				}
+
+			private:
+				bool decompress(long long offset) {
+					long long end = index_.stream_end(offset);
+					if (end < 0)
+						end = size_;
+					if (offset < 0 || end <= offset || end > size_) {
+						error_ = "invalid stream offset";
+						return false;
+					}
+
+					compressed_.resize(end - offset);
+					if (fseeko(fp_, offset, SEEK_SET) != 0
+							|| fread(&compressed_[0], 1, compressed_.size(), fp_) != compressed_.size()) {
+						error_ = "unable to read the stream";
+						return false;
+					}
+
+					bz_stream bz;
+					memset(&bz, 0, sizeof(bz));
+					if (BZ2_bzDecompressInit(&bz, 0, 0) != BZ_OK)
+						return false;
+					bz.next_in = &compressed_[0];
+					bz.avail_in = compressed_.size();
+
+					stream_.resize(std::max<size_t>(stream_.capacity(), compressed_.size() * 5));
+					size_t used = 0;
+					int ret = BZ_OK;
+					while (ret == BZ_OK) {
+						if (used == stream_.size())
+							stream_.resize(stream_.size() * 2);
+						bz.next_out = &stream_[used];
+						bz.avail_out = stream_.size() - used;
+						ret = BZ2_bzDecompress(&bz);
+						used = stream_.size() - bz.avail_out;
+						if (ret == BZ_OK && bz.avail_in == 0 && bz.avail_out > 0)
+							break;
+					}
+					BZ2_bzDecompressEnd(&bz);
+					stream_.resize(used);
+
+					if (ret != BZ_STREAM_END) {
+						error_ = "damaged stream";
+						return false;
+					}
+					return true;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_MULTISTREAM_H_ */
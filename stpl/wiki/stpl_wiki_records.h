@@ -0,0 +1,307 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_RECORDS_H_
+#define STPL_WIKI_RECORDS_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../../utils/intern.h"
+
+#include "stpl_wiki_meta.h"
+#include "stpl_wiki_title.h"
+
+/**
+ * The parameters of selected templates, e.g. the infoboxes, as flat records
+ * of (page id, template, parameter, value) from the WikiMeta of the pages
+ *
+ * The template and parameter names are interned once for the whole dump in
+ * a TemplateNames shared by the threads, and written as their ids in the
+ * binary format, with the table of the names saved next to the records:
+ *
+ *   int64_t page, uint32_t template, uint32_t parameter, uint32_t length, char value[length]
+ *
+ * in the byte order of the machine. The TSV format has the names themselves:
+ *
+ *   page	template	parameter	value
+ */
+namespace stpl {
+	namespace WIKI {
+
+		/**
+		 * @brief a field of a TSV line, the tabs, newlines, carriage returns and
+		 * backslashes are escaped
+		 */
+		inline void append_tsv_field(std::string& out, const char* p, size_t length) {
+			const char* end = p + length;
+			for (; p < end; ++p) {
+				switch (*p) {
+					case '\t':
+						out += "\\t";
+						break;
+					case '\n':
+						out += "\\n";
+						break;
+					case '\r':
+						out += "\\r";
+						break;
+					case '\\':
+						out += "\\\\";
+						break;
+					default:
+						out += *p;
+						break;
+				}
+			}
+		}
+
+		/**
+		 * @brief the template and parameter names of a dump with the
+		 * templates selected for export, safe to share between threads
+		 */
+		class TemplateNames {
+			public:
+				enum { NAMES_OK = 0, NAMES_ERROR = -1 };
+
+				typedef utils::StringInterner::id_type		id_type;
+
+			private:
+				enum { UNKNOWN, SELECTED, IGNORED };
+
+				utils::StringInterner			names_;
+				std::vector<unsigned char>		selection_;		/// by id, whether a template is selected
+				std::vector<std::string>		patterns_;		/// normalized, a trailing '*' for a prefix
+				mutable std::mutex				mutex_;
+
+			public:
+				TemplateNames() {}
+				~TemplateNames() {}
+
+				/**
+				 * @brief export the templates with this name, or with a name
+				 * starting with it if it ends with '*', e.g. "Infobox*"; all of
+				 * them are exported if none is selected
+				 */
+				void select(const std::string& pattern) {
+					std::lock_guard<std::mutex> lock(mutex_);
+					bool prefix = !pattern.empty() && pattern[pattern.length() - 1] == '*';
+					std::string name = normalize_title(prefix ? pattern.substr(0, pattern.length() - 1) : pattern);
+					if (prefix)
+						name += '*';
+					patterns_.push_back(name);
+					selection_.assign(selection_.size(), UNKNOWN);
+				}
+
+				/**
+				 * @brief the id of a normalized template name
+				 *
+				 * @return NO_ID if the template is not selected
+				 */
+				id_type template_id(const char* name, size_t length) {
+					std::lock_guard<std::mutex> lock(mutex_);
+					id_type id = intern(name, length);
+					if (selection_[id] == UNKNOWN)
+						selection_[id] = matches(name, length) ? SELECTED : IGNORED;
+					return selection_[id] == SELECTED ? id : (id_type) utils::StringInterner::NO_ID;
+				}
+
+				id_type parameter_id(const char* name, size_t length) {
+					std::lock_guard<std::mutex> lock(mutex_);
+					return intern(name, length);
+				}
+
+				std::string str(id_type id) const {
+					std::lock_guard<std::mutex> lock(mutex_);
+					return names_.str(id);
+				}
+
+				size_t size() const {
+					std::lock_guard<std::mutex> lock(mutex_);
+					return names_.size();
+				}
+
+				/**
+				 * @brief write the names in the order of their ids, one per line
+				 */
+				int save(const std::string& filename) const {
+					std::string out;
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						out.reserve(names_.bytes() + names_.size());
+						for (id_type id = 0; id < names_.size(); ++id) {
+							append_tsv_field(out, names_.data(id), names_.length(id));
+							out += '\n';
+						}
+					}
+					std::string temp = filename + ".tmp";
+					FILE* fp = fopen(temp.c_str(), "wb");
+					if (!fp)
+						return NAMES_ERROR;
+					bool ok = fwrite(out.data(), 1, out.size(), fp) == out.size();
+					if (fclose(fp) != 0 || !ok || rename(temp.c_str(), filename.c_str()) != 0)
+						return NAMES_ERROR;
+					return NAMES_OK;
+				}
+
+				/**
+				 * @brief read back the names saved before, so they keep their ids
+				 */
+				int load(const std::string& filename) {
+					FILE* fp = fopen(filename.c_str(), "rb");
+					if (!fp)
+						return NAMES_ERROR;
+					std::lock_guard<std::mutex> lock(mutex_);
+					std::string name;
+					bool escaped = false;
+					int c;
+					while ((c = fgetc(fp)) != EOF) {
+						if (escaped) {
+							switch (c) {
+								case 't': name += '\t'; break;
+								case 'n': name += '\n'; break;
+								case 'r': name += '\r'; break;
+								default: name += (char) c; break;
+							}
+							escaped = false;
+						}
+						else if (c == '\\')
+							escaped = true;
+						else if (c == '\n') {
+							intern(name.data(), name.length());
+							name.clear();
+						}
+						else
+							name += (char) c;
+					}
+					fclose(fp);
+					return NAMES_OK;
+				}
+
+			private:
+				id_type intern(const char* name, size_t length) {
+					id_type id = names_.intern(name, length);
+					if (id >= selection_.size())
+						selection_.resize(id + 1, UNKNOWN);
+					return id;
+				}
+
+				bool matches(const char* name, size_t length) const {
+					if (patterns_.empty())
+						return true;
+					for (size_t i = 0; i < patterns_.size(); ++i) {
+						const std::string& pattern = patterns_[i];
+						if (!pattern.empty() && pattern[pattern.length() - 1] == '*') {
+							if (length >= pattern.length() - 1 && memcmp(name, pattern.data(), pattern.length() - 1) == 0)
+								return true;
+						}
+						else if (length == pattern.length() && memcmp(name, pattern.data(), length) == 0)
+							return true;
+					}
+					return false;
+				}
+		};
+
+		/**
+		 * @brief writes the records of the selected templates of a page, one
+		 * exporter for each thread
+		 */
+		class TemplateRecordExporter {
+			public:
+				enum Format { RECORDS_TSV, RECORDS_BINARY };
+
+				typedef TemplateNames::id_type		id_type;
+
+			private:
+				TemplateNames&						names_;
+				Format								format_;
+				std::string							name_;			/// the normalized template name, reused
+
+			public:
+				TemplateRecordExporter(TemplateNames& names, Format format = RECORDS_TSV)
+						: names_(names), format_(format) {}
+				~TemplateRecordExporter() {}
+
+				/**
+				 * @brief append the records of the page to out
+				 *
+				 * @param strings where the ids of meta are from
+				 * @return the number of records
+				 */
+				size_t write(long long page, const WikiMeta& meta, const utils::StringInterner& strings, std::string& out) {
+					size_t count = 0;
+					char id[32];
+					int id_length = snprintf(id, sizeof(id), "%lld", page);
+
+					for (size_t i = 0; i < meta.templates.size(); ++i) {
+						const WikiMetaTemplate& tmpl = meta.templates[i];
+						if (tmpl.count == 0 || tmpl.name == utils::StringInterner::NO_ID)
+							continue;
+
+						name_.clear();
+						const char* name = strings.data(tmpl.name);
+						normalize_title(name, name + strings.length(tmpl.name), name_);
+						id_type template_id = names_.template_id(name_.data(), name_.length());
+						if (template_id == utils::StringInterner::NO_ID)
+							continue;
+
+						for (size_t j = tmpl.first; j < tmpl.first + tmpl.count; ++j) {
+							const WikiMetaProperty& property = meta.properties[j];
+							const char* parameter = strings.data(property.name);
+							size_t parameter_length = strings.length(property.name);
+							const char* value = strings.data(property.value);
+							size_t value_length = strings.length(property.value);
+
+							if (format_ == RECORDS_BINARY) {
+								int64_t record_page = page;
+								uint32_t header[3] = {
+										template_id,
+										names_.parameter_id(parameter, parameter_length),
+										(uint32_t) value_length
+								};
+								out.append(reinterpret_cast<const char*>(&record_page), sizeof(record_page));
+								out.append(reinterpret_cast<const char*>(header), sizeof(header));
+								out.append(value, value_length);
+							}
+							else {
+								out.append(id, id_length);
+								out += '\t';
+								append_tsv_field(out, name_.data(), name_.length());
+								out += '\t';
+								append_tsv_field(out, parameter, parameter_length);
+								out += '\t';
+								append_tsv_field(out, value, value_length);
+								out += '\n';
+							}
+							++count;
+						}
+					}
+					return count;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_RECORDS_H_ */
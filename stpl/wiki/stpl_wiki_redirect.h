@@ -0,0 +1,438 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_REDIRECT_H_
+#define STPL_WIKI_REDIRECT_H_
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../../utils/intern.h"
+
+#include "stpl_wiki_title.h"
+
+/**
+ * The redirects of a whole dump, resolved to their final targets
+ *
+ * RedirectTableBuilder collects the redirects of a dump, follows the chains
+ * of them and writes a table that RedirectTable maps into memory as it is,
+ * so a lookup is a hash and a probe or two with nothing to load first.
+ *
+ * The file, in the byte order of the machine that wrote it:
+ *
+ *   RedirectTableHeader
+ *   uint32_t slots[header.slots]         the entry of each slot, NO_ENTRY if empty
+ *   RedirectTableEntry entries[header.count]
+ *   char strings[header.strings]         the titles, each followed by a NUL
+ */
+namespace stpl {
+	namespace WIKI {
+
+		struct RedirectTableHeader {
+			char			magic[8];
+			uint32_t		version;
+			uint32_t		count;			/// the number of redirects
+			uint32_t		slots;			/// a power of two, at least 16, so the entries stay 8 byte aligned
+			uint32_t		reserved;
+			uint64_t		strings;		/// the bytes of the titles
+		};
+
+		struct RedirectTableEntry {
+			uint64_t		title;			/// offsets into the strings
+			uint64_t		target;
+			uint32_t		hash;
+			uint16_t		title_length;
+			uint16_t		target_length;
+		};
+
+		struct RedirectTableFormat {
+			enum { FORMAT_VERSION = 1 };
+			enum { MAX_TITLE = 0xffff };
+			enum { NO_ENTRY = 0xffffffffu };
+
+			static const char* magic() { return "STPLRDR"; }
+
+			/**
+			 * FNV-1a of the normalized title
+			 */
+			static uint32_t hash(const char* s, size_t length) {
+				uint32_t hash = 2166136261u;
+				for (size_t i = 0; i < length; ++i) {
+					hash ^= (unsigned char) s[i];
+					hash *= 16777619u;
+				}
+				return hash;
+			}
+		};
+
+		/**
+		 * @brief collects the redirects of a dump and writes the resolution
+		 * table of them
+		 */
+		class RedirectTableBuilder {
+			public:
+				enum { REDIRECT_OK = 0, REDIRECT_ERROR = -1 };
+				enum { MAX_CHAIN = 32 };
+
+				typedef utils::StringInterner::id_type		id_type;
+
+			private:
+				utils::StringInterner		titles_;
+				std::vector<id_type>		targets_;		/// by title, NO_ID for a title that is not a redirect
+				std::string					title_;
+				std::string					target_;
+				size_t						broken_;
+				std::string					error_;
+
+			public:
+				RedirectTableBuilder() : broken_(0) {}
+				~RedirectTableBuilder() {}
+
+				/**
+				 * @brief a redirect, the titles don't have to be normalized;
+				 * a page redirected twice keeps the last target
+				 */
+				void add(const std::string& title, const std::string& target) {
+					title_.clear();
+					normalize_title(title.data(), title.data() + title.length(), title_);
+					target_.clear();
+					normalize_title(target.data(), target.data() + target.length(), target_);
+					if (title_.empty() || target_.empty() || title_ == target_
+							|| title_.length() > RedirectTableFormat::MAX_TITLE || target_.length() > RedirectTableFormat::MAX_TITLE)
+						return;
+
+					id_type from = intern(title_);
+					id_type to = intern(target_);
+					targets_[from] = to;
+				}
+
+				/**
+				 * @brief add the redirects of a dump, the reader is a
+				 * WikiDumpReader or anything else with next(WikiPage&)
+				 *
+				 * @return the number of redirect pages read
+				 */
+				template <typename ReaderT, typename PageT>
+				size_t load(ReaderT& reader, PageT& page) {
+					size_t count = 0;
+					while (reader.next(page)) {
+						if (page.redirect.empty())
+							continue;
+						add(page.title, page.redirect);
+						++count;
+					}
+					return count;
+				}
+
+				/**
+				 * @brief the redirects in the table after resolve(), the ones
+				 * added before that
+				 */
+				size_t size() const {
+					size_t count = 0;
+					for (size_t i = 0; i < targets_.size(); ++i)
+						if (targets_[i] != utils::StringInterner::NO_ID)
+							++count;
+					return count;
+				}
+
+				/**
+				 * @brief the redirects dropped by resolve() for going round in
+				 * a loop or for a chain longer than MAX_CHAIN
+				 */
+				size_t broken() const { return broken_; }
+
+				const std::string& error() const { return error_; }
+
+				/**
+				 * @brief point every redirect at the end of its chain
+				 */
+				void resolve() {
+					const id_type none = (id_type) utils::StringInterner::NO_ID;
+					enum { UNSEEN, VISITING, DONE, BROKEN };
+					std::vector<unsigned char> state(targets_.size(), UNSEEN);
+					std::vector<id_type> chain;
+
+					for (id_type first = 0; first < targets_.size(); ++first) {
+						if (state[first] != UNSEEN)
+							continue;
+
+						// walk to a title that is not a redirect, or one seen already
+						chain.clear();
+						id_type id = first;
+						while (targets_[id] != none && state[id] == UNSEEN && chain.size() <= MAX_CHAIN) {
+							state[id] = VISITING;
+							chain.push_back(id);
+							id = targets_[id];
+						}
+
+						id_type end = none;
+						if (targets_[id] == none && state[id] != BROKEN)
+							end = id;
+						else if (state[id] == DONE)
+							end = targets_[id];
+
+						for (size_t i = 0; i < chain.size(); ++i) {
+							if (end == none || end == chain[i]) {
+								state[chain[i]] = BROKEN;
+								targets_[chain[i]] = none;
+								++broken_;
+							}
+							else {
+								state[chain[i]] = DONE;
+								targets_[chain[i]] = end;
+							}
+						}
+					}
+				}
+
+				/**
+				 * @brief resolve the redirects and write the table
+				 */
+				int write(const std::string& filename) {
+					resolve();
+
+					const id_type none = (id_type) utils::StringInterner::NO_ID;
+					RedirectTableHeader header;
+					memset(&header, 0, sizeof(header));
+					memcpy(header.magic, RedirectTableFormat::magic(), 8);
+					header.version = RedirectTableFormat::FORMAT_VERSION;
+
+					// only the titles of the table go in the strings, in the order of their ids
+					const uint64_t unused = (uint64_t) -1;
+					std::vector<uint64_t> offsets(titles_.size(), unused);
+					for (id_type id = 0; id < targets_.size(); ++id)
+						if (targets_[id] != none)
+							offsets[id] = offsets[targets_[id]] = 0;
+					uint64_t strings = 0;
+					for (id_type id = 0; id < offsets.size(); ++id)
+						if (offsets[id] != unused) {
+							offsets[id] = strings;
+							strings += titles_.length(id) + 1;
+						}
+
+					std::vector<RedirectTableEntry> entries;
+					for (id_type id = 0; id < targets_.size(); ++id) {
+						if (targets_[id] == none)
+							continue;
+						RedirectTableEntry entry;
+						entry.title = offsets[id];
+						entry.target = offsets[targets_[id]];
+						entry.title_length = (uint16_t) titles_.length(id);
+						entry.target_length = (uint16_t) titles_.length(targets_[id]);
+						entry.hash = RedirectTableFormat::hash(titles_.data(id), entry.title_length);
+						entries.push_back(entry);
+					}
+					header.count = (uint32_t) entries.size();
+					header.strings = strings;
+
+					// at most half full
+					header.slots = 16;
+					while (header.slots < 2 * entries.size())
+						header.slots *= 2;
+					std::vector<uint32_t> slots(header.slots, RedirectTableFormat::NO_ENTRY);
+					uint32_t mask = header.slots - 1;
+					for (uint32_t i = 0; i < entries.size(); ++i) {
+						uint32_t slot = entries[i].hash & mask;
+						while (slots[slot] != RedirectTableFormat::NO_ENTRY)
+							slot = (slot + 1) & mask;
+						slots[slot] = i;
+					}
+
+					FILE* fp = fopen(filename.c_str(), "wb");
+					if (!fp) {
+						error_ = "unable to open file: " + filename;
+						return REDIRECT_ERROR;
+					}
+					bool ok = fwrite(&header, sizeof(header), 1, fp) == 1
+							&& fwrite(&slots[0], sizeof(uint32_t), slots.size(), fp) == slots.size()
+							&& (entries.empty() || fwrite(&entries[0], sizeof(RedirectTableEntry), entries.size(), fp) == entries.size());
+					for (id_type id = 0; ok && id < offsets.size(); ++id)
+						if (offsets[id] != unused)
+							ok = fwrite(titles_.data(id), 1, titles_.length(id) + 1, fp) == titles_.length(id) + 1;
+					if (fclose(fp) != 0 || !ok) {
+						error_ = "unable to write file: " + filename;
+						return REDIRECT_ERROR;
+					}
+					return REDIRECT_OK;
+				}
+
+			private:
+				id_type intern(const std::string& title) {
+					id_type id = titles_.intern(title);
+					if (id >= targets_.size())
+						targets_.resize(id + 1, (id_type) utils::StringInterner::NO_ID);
+					return id;
+				}
+
+		};
+
+		/**
+		 * @brief the redirect table written by RedirectTableBuilder, memory
+		 * mapped from a file or over a buffer that outlives it
+		 */
+		class RedirectTable {
+			public:
+				enum { REDIRECT_OK = 0, REDIRECT_ERROR = -1 };
+
+			private:
+				int								fd_;
+				const char*						map_;
+				size_t							map_size_;
+
+				const RedirectTableHeader*		header_;
+				const uint32_t*					slots_;
+				const RedirectTableEntry*		entries_;
+				const char*						strings_;
+				std::string						error_;
+
+			public:
+				RedirectTable() : fd_(-1), map_(NULL), map_size_(0) { reset(); }
+				~RedirectTable() { close(); }
+
+				int open(const std::string& filename) {
+					close();
+					fd_ = ::open(filename.c_str(), O_RDONLY);
+					if (fd_ < 0) {
+						error_ = "unable to open file: " + filename;
+						return REDIRECT_ERROR;
+					}
+					struct stat st;
+					if (fstat(fd_, &st) != 0 || st.st_size == 0) {
+						error_ = "unable to stat file: " + filename;
+						close();
+						return REDIRECT_ERROR;
+					}
+					map_size_ = st.st_size;
+					void* addr = mmap(NULL, map_size_, PROT_READ, MAP_SHARED, fd_, 0);
+					if (addr == MAP_FAILED) {
+						map_size_ = 0;
+						error_ = "unable to map file: " + filename;
+						close();
+						return REDIRECT_ERROR;
+					}
+					map_ = static_cast<const char*>(addr);
+					// the lookups go all over the table
+					madvise(addr, map_size_, MADV_RANDOM);
+
+					if (attach(map_, map_size_) != REDIRECT_OK) {
+						close();
+						error_ = "invalid redirect table: " + filename;
+						return REDIRECT_ERROR;
+					}
+					return REDIRECT_OK;
+				}
+
+				/**
+				 * @brief use a table that is already in memory, aligned to 8 bytes
+				 */
+				int attach(const char* data, size_t size) {
+					reset();
+					const RedirectTableHeader* header = reinterpret_cast<const RedirectTableHeader*>(data);
+					if (size < sizeof(RedirectTableHeader)
+							|| memcmp(header->magic, RedirectTableFormat::magic(), 8) != 0
+							|| header->version != RedirectTableFormat::FORMAT_VERSION
+							|| header->slots == 0 || (header->slots & (header->slots - 1)) != 0
+							|| header->count >= header->slots) {
+						error_ = "invalid redirect table";
+						return REDIRECT_ERROR;
+					}
+					size_t slots = sizeof(RedirectTableHeader);
+					size_t entries = slots + (size_t) header->slots * sizeof(uint32_t);
+					size_t strings = entries + (size_t) header->count * sizeof(RedirectTableEntry);
+					if (strings > size || header->strings > size - strings) {
+						error_ = "invalid redirect table";
+						return REDIRECT_ERROR;
+					}
+					header_ = header;
+					slots_ = reinterpret_cast<const uint32_t*>(data + slots);
+					entries_ = reinterpret_cast<const RedirectTableEntry*>(data + entries);
+					strings_ = data + strings;
+					return REDIRECT_OK;
+				}
+
+				void close() {
+					if (map_)
+						munmap(const_cast<char*>(map_), map_size_);
+					if (fd_ >= 0)
+						::close(fd_);
+					fd_ = -1;
+					map_ = NULL;
+					map_size_ = 0;
+					reset();
+				}
+
+				size_t size() const { return header_ ? header_->count : 0; }
+				const std::string& error() const { return error_; }
+
+				/**
+				 * @brief the final target of a normalized title
+				 *
+				 * @return the NUL terminated target in the table, NULL if the
+				 * title is not a redirect
+				 */
+				const char* find(const char* title, size_t length, size_t* target_length = NULL) const {
+					if (!header_)
+						return NULL;
+					uint32_t hash = RedirectTableFormat::hash(title, length);
+					uint32_t mask = header_->slots - 1;
+					for (uint32_t slot = hash & mask; slots_[slot] != RedirectTableFormat::NO_ENTRY; slot = (slot + 1) & mask) {
+						const RedirectTableEntry& entry = entries_[slots_[slot]];
+						if (entry.hash == hash && entry.title_length == length
+								&& memcmp(strings_ + entry.title, title, length) == 0) {
+							if (target_length)
+								*target_length = entry.target_length;
+							return strings_ + entry.target;
+						}
+					}
+					return NULL;
+				}
+
+				/**
+				 * @brief the page a title ends up at, the normalized title itself
+				 * if it is not a redirect
+				 */
+				std::string resolve(const std::string& title) const {
+					std::string normalized = normalize_title(title);
+					size_t length;
+					const char* target = find(normalized.data(), normalized.length(), &length);
+					return target ? std::string(target, length) : normalized;
+				}
+
+			private:
+				void reset() {
+					header_ = NULL;
+					slots_ = NULL;
+					entries_ = NULL;
+					strings_ = NULL;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_REDIRECT_H_ */
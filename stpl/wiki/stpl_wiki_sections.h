@@ -0,0 +1,203 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_SECTIONS_H_
+#define STPL_WIKI_SECTIONS_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+#include "../../utils/simd.h"
+
+#include "stpl_wiki_parser.h"
+
+namespace stpl {
+	namespace WIKI {
+
+		/**
+		 * @brief the offsets of the top level headings of [begin, end), the
+		 * lines starting and ending with '=' that are not inside a template,
+		 * a table, a comment or a nowiki, pre or math block
+		 */
+		template <typename IteratorT>
+		void find_headings(IteratorT begin, IteratorT end, std::vector<size_t>& headings) {
+			static const char* const blocks[][2] = {
+					{ "<!--", "-->" },
+					{ "<nowiki>", "</nowiki>" },
+					{ "<pre>", "</pre>" },
+					{ "<math>", "</math>" }
+			};
+			const char* const first = &*begin;
+			const char* const last = first + (end - begin);
+			const char* p = first;
+			int templates = 0;
+			int tables = 0;
+			bool line_start = true;
+
+			while (p < last) {
+				if (line_start) {
+					line_start = false;
+					if (*p == '=' && templates == 0 && tables == 0) {
+						const char* eol = utils::find_char(p, last, '\n');
+						const char* q = eol;
+						while (q > p && (q[-1] == ' ' || q[-1] == '\t' || q[-1] == '\r'))
+							--q;
+						if (q - p >= 3 && q[-1] == '=')
+							headings.push_back(p - first);
+						p = eol;
+						continue;
+					}
+					if (*p == '{' && p + 1 < last && p[1] == '|')
+						++tables;
+					else if (*p == '|' && p + 1 < last && p[1] == '}' && tables > 0)
+						--tables;
+				}
+
+				char c = *p;
+				if (c == '\n') {
+					line_start = true;
+					++p;
+				}
+				else if (c == '{' && p + 1 < last && p[1] == '{') {
+					++templates;
+					p += 2;
+				}
+				else if (c == '}' && p + 1 < last && p[1] == '}' && templates > 0) {
+					--templates;
+					p += 2;
+				}
+				else if (c == '<') {
+					size_t i = 0;
+					for (; i < sizeof(blocks) / sizeof(blocks[0]); ++i) {
+						size_t length = strlen(blocks[i][0]);
+						if ((size_t) (last - p) >= length && utils::ascii_iequals(p, blocks[i][0], length))
+							break;
+					}
+					if (i == sizeof(blocks) / sizeof(blocks[0])) {
+						++p;
+						continue;
+					}
+					// skip to the end of the block, an open one runs to the end
+					size_t length = strlen(blocks[i][1]);
+					const char* q = p + strlen(blocks[i][0]);
+					while ((q = utils::find_char(q, last, blocks[i][1][0])) < last
+							&& !((size_t) (last - q) >= length && utils::ascii_iequals(q, blocks[i][1], length)))
+						++q;
+					p = q < last ? q + length : last;
+				}
+				else
+					++p;
+			}
+		}
+
+		/**
+		 * @brief parses a page a few sections at a time
+		 *
+		 * The text is cut at the top level headings into parts of at least
+		 * part_size bytes. The parts can be parsed on their own, lazily with
+		 * part(), or all of them with parse(), in parallel if threads are given,
+		 * and appended into one document whose sections are those of the page
+		 * parsed as a whole.
+		 */
+		template <typename ParserT = WikiParser<std::string, std::string::iterator> >
+		class WikiSectionParser {
+			public:
+				typedef typename ParserT::document_type				document_type;
+				typedef typename ParserT::iterator					iterator;
+
+				enum { DEFAULT_PART_SIZE = 256 * 1024 };
+
+			private:
+				iterator											begin_;
+				iterator											end_;
+				std::vector<iterator>								bounds_;		/// the parts, bounds_[i] to bounds_[i + 1]
+				std::vector<std::unique_ptr<ParserT> >				parsers_;
+				std::unique_ptr<document_type>						doc_;
+
+			public:
+				WikiSectionParser(iterator begin, iterator end, size_t part_size = DEFAULT_PART_SIZE)
+						: begin_(begin), end_(end) {
+					doc_.reset(new document_type(begin, end));
+
+					std::vector<size_t> headings;
+					find_headings(begin, end, headings);
+					bounds_.push_back(begin);
+					size_t last = 0;
+					for (size_t i = 0; i < headings.size(); ++i)
+						if (headings[i] - last >= part_size) {
+							bounds_.push_back(begin + headings[i]);
+							last = headings[i];
+						}
+					bounds_.push_back(end);
+					parsers_.resize(parts());
+				}
+
+				~WikiSectionParser() {}
+
+				size_t parts() const {
+					return bounds_.size() - 1;
+				}
+
+				/**
+				 * @brief the document of a part on its own, parsed when it is
+				 * first asked for
+				 */
+				document_type& part(size_t i) {
+					if (!parsers_[i]) {
+						parsers_[i].reset(new ParserT(bounds_[i], bounds_[i + 1]));
+						parsers_[i]->parse();
+					}
+					return parsers_[i]->doc();
+				}
+
+				/**
+				 * @brief parse the parts not parsed yet and put them together
+				 * into the document of the page
+				 *
+				 * @param threads the number of threads the parts are shared by
+				 */
+				document_type& parse(unsigned threads = 1) {
+					if (threads > parts())
+						threads = (unsigned) parts();
+					if (threads > 1) {
+						std::atomic<size_t> next(0);
+						std::vector<std::thread> workers;
+						for (unsigned i = 0; i < threads; ++i)
+							workers.push_back(std::thread([&]() {
+								size_t j;
+								while ((j = next++) < parts())
+									part(j);
+							}));
+						for (size_t i = 0; i < workers.size(); ++i)
+							workers[i].join();
+					}
+
+					for (size_t i = 0; i < parts(); ++i)
+						doc_->append(part(i));
+					return *doc_;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_SECTIONS_H_ */
@@ -0,0 +1,805 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_TEMPLATE_H_
+#define STPL_WIKI_TEMPLATE_H_
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../../utils/simd.h"
+
+#include "stpl_wiki_title.h"
+
+/**
+ * Template expansion, an opt-in pass over the wikitext before it is parsed
+ *
+ * {{name|..}} is replaced with the body of Template:name from a TemplateStore
+ * with its {{{parameters}}} substituted, and a core set of parser functions
+ * (#if, #ifeq, #iferror, #ifexist, #switch, lc, uc, lcfirst, ucfirst) is
+ * evaluated. The bodies are parsed once into a ParsedTemplate and kept in an
+ * LRU cache, the nesting of the templates is limited in depth and a template
+ * that includes itself is reported instead of being expanded. The other parser
+ * functions and magic words ({{#invoke:..}}, {{DEFAULTSORT:..}}) are left out,
+ * and so is what the templates would add beyond the size limit of a page.
+ */
+namespace stpl {
+	namespace WIKI {
+
+		/**
+		 * @brief the templates of a wiki by their titles, Template:Name, with
+		 * the redirects between them
+		 */
+		class TemplateStore {
+			public:
+				enum { MAX_REDIRECTS = 5 };
+				enum { TEMPLATE_NAMESPACE = 10 };
+
+			private:
+				std::unordered_map<std::string, std::string>	bodies_;
+				std::unordered_map<std::string, std::string>	redirects_;
+
+			public:
+				TemplateStore() {}
+				~TemplateStore() {}
+
+				void add(const std::string& title, const std::string& body) {
+					bodies_[normalize(title)] = body;
+				}
+
+				void add_redirect(const std::string& title, const std::string& target) {
+					redirects_[normalize(title)] = normalize(target);
+				}
+
+				/**
+				 * @brief the body of a template, the redirects are followed
+				 *
+				 * @return NULL if there is no such template
+				 */
+				const std::string* find(const std::string& title) const {
+					std::string name = normalize(title);
+					for (int i = 0; i <= MAX_REDIRECTS; ++i) {
+						std::unordered_map<std::string, std::string>::const_iterator body = bodies_.find(name);
+						if (body != bodies_.end())
+							return &body->second;
+						std::unordered_map<std::string, std::string>::const_iterator target = redirects_.find(name);
+						if (target == redirects_.end())
+							break;
+						name = target->second;
+					}
+					return NULL;
+				}
+
+				bool exists(const std::string& title) const {
+					return find(title) != NULL;
+				}
+
+				size_t size() const {
+					return bodies_.size();
+				}
+
+				void clear() {
+					bodies_.clear();
+					redirects_.clear();
+				}
+
+				/**
+				 * @brief keep the templates of a dump, the reader is a
+				 * WikiDumpReader or anything else with next(WikiPage&)
+				 *
+				 * @return the number of templates and template redirects read
+				 */
+				template <typename ReaderT, typename PageT>
+				size_t load(ReaderT& reader, PageT& page) {
+					size_t count = 0;
+					while (reader.next(page)) {
+						if (page.ns != TEMPLATE_NAMESPACE)
+							continue;
+						if (!page.redirect.empty())
+							add_redirect(page.title, page.redirect);
+						else
+							add(page.title, page.text);
+						++count;
+					}
+					return count;
+				}
+
+				/**
+				 * @brief the title as it is stored, see normalize_title()
+				 */
+				static std::string normalize(const std::string& title) {
+					return normalize_title(title);
+				}
+		};
+
+		/**
+		 * @brief a template body parsed into text, {{{parameters}}} and
+		 * {{calls}}, each with its parts between the pipes
+		 */
+		class ParsedTemplate {
+			public:
+				enum NodeKind { NODE_TEXT, NODE_PARAMETER, NODE_CALL };
+
+				static const size_t NO_PART = (size_t) -1;
+
+				struct Node {
+					NodeKind		kind;
+					size_t			begin;			/// the text of a text node
+					size_t			end;
+					size_t			first_child;	/// the parts of a parameter or a call in children_
+					size_t			children;
+				};
+
+				/**
+				 * the nodes of a part are contiguous, name=value arguments are
+				 * split at the '=' into a name part and its value part
+				 */
+				struct Part {
+					size_t			first_node;
+					size_t			nodes;
+					size_t			value;
+				};
+
+				enum { MAX_NESTING = 100 };
+
+			private:
+				enum Closer { CLOSE_NONE, CLOSE_CALL, CLOSE_PARAMETER };
+
+				std::string					text_;
+				std::vector<Node>			nodes_;
+				std::vector<Part>			parts_;
+				std::vector<size_t>			children_;
+				size_t						root_;
+
+			public:
+				/**
+				 * @param transcluded for a template body, <noinclude> is dropped
+				 * and <onlyinclude> kept alone; for a page it is <includeonly>
+				 * that is dropped
+				 */
+				ParsedTemplate(const std::string& body, bool transcluded = true) {
+					preprocess(body, transcluded);
+					const char* p = text_.data();
+					root_ = parse_part(p, text_.data() + text_.length(), CLOSE_NONE, false, 0);
+				}
+
+				const std::string& text() const { return text_; }
+				const Node& node(size_t i) const { return nodes_[i]; }
+				const Part& part(size_t i) const { return parts_[i]; }
+				size_t child(const Node& node, size_t i) const { return children_[node.first_child + i]; }
+				size_t root() const { return root_; }
+
+				/**
+				 * @brief the memory taken, for the cache
+				 */
+				size_t bytes() const {
+					return text_.capacity() + nodes_.capacity() * sizeof(Node) + parts_.capacity() * sizeof(Part)
+							+ children_.capacity() * sizeof(size_t);
+				}
+
+			private:
+				/**
+				 * drop the comments and apply the inclusion tags
+				 */
+				void preprocess(const std::string& body, bool transcluded) {
+					const char* begin = body.data();
+					const char* end = begin + body.length();
+					text_.reserve(body.length());
+
+					if (transcluded && find_tag(begin, end, "<onlyinclude>") < end) {
+						const char* p = begin;
+						while ((p = find_tag(p, end, "<onlyinclude>")) < end) {
+							p += 13;
+							const char* close = find_tag(p, end, "</onlyinclude>");
+							append_text(p, close);
+							p = close < end ? close + 14 : end;
+						}
+						return;
+					}
+
+					const char* p = begin;
+					while (p < end) {
+						const char* lt = utils::find_char(p, end, '<');
+						text_.append(p, lt);
+						p = lt;
+						if (p == end)
+							break;
+
+						if (is_tag(p + 1, end, "!--", 3)) {
+							const char* close = find_tag(p + 4, end, "-->");
+							p = close < end ? close + 3 : end;
+							continue;
+						}
+
+						const char* block = transcluded ? "noinclude>" : "includeonly>";
+						const char* tag = transcluded ? "includeonly>" : "noinclude>";
+						size_t block_length = strlen(block), tag_length = strlen(tag);
+						if (is_tag(p + 1, end, block, block_length)) {
+							const char* close = find_tag(p, end, transcluded ? "</noinclude>" : "</includeonly>");
+							p = close < end ? close + block_length + 2 : end;
+						}
+						else if (is_tag(p + 1, end, tag, tag_length))
+							p += tag_length + 1;
+						else if (end - p > 1 && p[1] == '/' && is_tag(p + 2, end, tag, tag_length))
+							p += tag_length + 2;
+						else if (!transcluded && end - p > 1 && is_tag(p + 1, end, "onlyinclude>", 12))
+							p += 13;
+						else if (!transcluded && end - p > 2 && p[1] == '/' && is_tag(p + 2, end, "onlyinclude>", 12))
+							p += 14;
+						else
+							text_ += *p++;
+					}
+				}
+
+				/**
+				 * [begin, end) without the comments
+				 */
+				void append_text(const char* begin, const char* end) {
+					const char* p = begin;
+					while (p < end) {
+						const char* open = find_tag(p, end, "<!--");
+						text_.append(p, open);
+						if (open == end)
+							break;
+						const char* close = find_tag(open + 4, end, "-->");
+						p = close < end ? close + 3 : end;
+					}
+				}
+
+				static bool is_tag(const char* p, const char* end, const char* tag, size_t length) {
+					return (size_t) (end - p) >= length && utils::ascii_iequals(p, tag, length);
+				}
+
+				/**
+				 * the first occurrence of tag in [begin, end), ignoring the case
+				 */
+				static const char* find_tag(const char* begin, const char* end, const char* tag) {
+					size_t length = strlen(tag);
+					const char* p = begin;
+					while ((p = utils::find_char(p, end, tag[0])) < end) {
+						if (is_tag(p, end, tag, length))
+							return p;
+						++p;
+					}
+					return end;
+				}
+
+				/**
+				 * the nodes up to the pipe or the braces that end the part
+				 *
+				 * @return the index of the part, p is left on what ended it
+				 */
+				size_t parse_part(const char*& p, const char* end, Closer closer, bool split, int depth) {
+					std::vector<Node> nodes;
+					const char* text = p;
+					size_t name = NO_PART;
+					int links = 0;
+
+					while (p < end) {
+						char c = *p;
+						if (c == '{' && end - p > 1 && p[1] == '{' && depth < MAX_NESTING) {
+							add_text(nodes, text, p);
+							Node node;
+							const char* from = p;
+							if (!(end - p > 2 && p[2] == '{' && parse_braces(p, end, NODE_PARAMETER, node, depth + 1))) {
+								p = from;
+								if (!parse_braces(p, end, NODE_CALL, node, depth + 1)) {
+									// not closed, it is only text
+									p = from + 2;
+									text = from;
+									continue;
+								}
+							}
+							nodes.push_back(node);
+							text = p;
+							continue;
+						}
+
+						if (closer != CLOSE_NONE && links == 0) {
+							if (c == '|')
+								break;
+							if (c == '}' && end - p > 1 && p[1] == '}'
+									&& (closer == CLOSE_CALL || (end - p > 2 && p[2] == '}')))
+								break;
+							if (c == '=' && split && name == NO_PART) {
+								// name=value
+								add_text(nodes, text, p);
+								name = add_part(nodes);
+								nodes.clear();
+								text = ++p;
+								continue;
+							}
+						}
+
+						if (c == '[' && end - p > 1 && p[1] == '[') {
+							++links;
+							p += 2;
+						}
+						else if (c == ']' && end - p > 1 && p[1] == ']' && links > 0) {
+							--links;
+							p += 2;
+						}
+						else if (c == '<' && is_tag(p + 1, end, "nowiki>", 7)) {
+							// nothing is expanded inside
+							const char* close = find_tag(p, end, "</nowiki>");
+							p = close < end ? close + 9 : end;
+						}
+						else
+							++p;
+					}
+					add_text(nodes, text, p);
+
+					size_t part = add_part(nodes);
+					if (name == NO_PART)
+						return part;
+					parts_[name].value = part;
+					return name;
+				}
+
+				/**
+				 * {{name|..}} or {{{name|default}}}, p is at the braces
+				 *
+				 * @return false if they are not closed, the nodes parsed so far
+				 * are dropped
+				 */
+				bool parse_braces(const char*& p, const char* end, NodeKind kind, Node& node, int depth) {
+					size_t nodes = nodes_.size(), parts = parts_.size(), children = children_.size();
+					size_t braces = kind == NODE_PARAMETER ? 3 : 2;
+					Closer closer = kind == NODE_PARAMETER ? CLOSE_PARAMETER : CLOSE_CALL;
+					std::vector<size_t> args;
+
+					node.kind = kind;
+					node.begin = p - text_.data();
+					p += braces;
+					while (true) {
+						// the name can't be split, nor the default of a parameter
+						args.push_back(parse_part(p, end, closer, kind == NODE_CALL && !args.empty(), depth));
+						if (p >= end) {
+							nodes_.resize(nodes);
+							parts_.resize(parts);
+							children_.resize(children);
+							return false;
+						}
+						if (*p == '|')
+							++p;
+						else {
+							p += braces;
+							break;
+						}
+					}
+					node.end = p - text_.data();
+					node.first_child = children_.size();
+					node.children = args.size();
+					children_.insert(children_.end(), args.begin(), args.end());
+					return true;
+				}
+
+				void add_text(std::vector<Node>& nodes, const char* begin, const char* end) {
+					if (begin >= end)
+						return;
+					Node node;
+					node.kind = NODE_TEXT;
+					node.begin = begin - text_.data();
+					node.end = end - text_.data();
+					node.first_child = 0;
+					node.children = 0;
+					nodes.push_back(node);
+				}
+
+				size_t add_part(const std::vector<Node>& nodes) {
+					Part part;
+					part.first_node = nodes_.size();
+					part.nodes = nodes.size();
+					part.value = NO_PART;
+					nodes_.insert(nodes_.end(), nodes.begin(), nodes.end());
+					parts_.push_back(part);
+					return parts_.size() - 1;
+				}
+		};
+
+		/**
+		 * @brief expands the templates of a page with the bodies of a
+		 * TemplateStore
+		 *
+		 * An expander keeps its own cache, so there should be one for each
+		 * thread; the store can be shared.
+		 */
+		class TemplateExpander {
+			public:
+				enum { DEFAULT_MAX_DEPTH = 40 };
+				enum { DEFAULT_CACHE_SIZE = 4096 };
+				enum { DEFAULT_MAX_OUTPUT = 2 * 1024 * 1024 };		/// as MediaWiki's post-expand include size
+
+				typedef std::shared_ptr<const ParsedTemplate>					parsed_ptr;
+
+			private:
+				typedef std::map<std::string, std::string>						Arguments;
+				typedef std::list<std::pair<std::string, parsed_ptr> >			CacheList;
+
+				/**
+				 * a template being expanded, the chain of them is the call stack
+				 */
+				struct Frame {
+					const std::string*		title;
+					const Arguments*		args;
+					const Frame*			caller;
+				};
+
+				const TemplateStore&										store_;
+				int															max_depth_;
+				size_t														cache_size_;
+				size_t														max_output_;
+				size_t														output_;		/// the bytes the templates of the page added so far
+
+				// the parsed bodies, the most recently used first
+				CacheList													cache_;
+				std::unordered_map<std::string, CacheList::iterator>		cached_;
+				size_t														hits_;
+				size_t														misses_;
+
+				std::string													page_title_;
+
+			public:
+				TemplateExpander(const TemplateStore& store, size_t cache_size = DEFAULT_CACHE_SIZE)
+						: store_(store), max_depth_(DEFAULT_MAX_DEPTH), cache_size_(cache_size), max_output_(DEFAULT_MAX_OUTPUT), output_(0),
+						  hits_(0), misses_(0) {}
+				~TemplateExpander() {}
+
+				void max_depth(int depth) { max_depth_ = depth; }
+				int max_depth() const { return max_depth_; }
+
+				/**
+				 * @brief the bytes the templates may add to a page, the calls
+				 * after that are not expanded
+				 */
+				void max_output(size_t bytes) { max_output_ = bytes; }
+				size_t max_output() const { return max_output_; }
+
+				/**
+				 * @brief the number of parsed bodies kept, at least one
+				 */
+				void cache_size(size_t size) {
+					cache_size_ = size > 0 ? size : 1;
+					evict();
+				}
+
+				size_t cache_hits() const { return hits_; }
+				size_t cache_misses() const { return misses_; }
+
+				/**
+				 * @brief expand the wikitext of a page
+				 *
+				 * @param title the page title, for {{PAGENAME}}
+				 */
+				std::string expand(const std::string& text, const std::string& title = "") {
+					page_title_ = title;
+					output_ = 0;
+					ParsedTemplate page(text, false);
+					Frame frame = { &page_title_, NULL, NULL };
+					std::string output;
+					output.reserve(text.length() + text.length() / 2);
+					expand_part(page, page.root(), frame, output, 0);
+					return output;
+				}
+
+				/**
+				 * @brief the parsed body of a template, from the cache if it is
+				 * there, NULL if the store doesn't have it
+				 */
+				parsed_ptr parsed(const std::string& title) {
+					std::unordered_map<std::string, CacheList::iterator>::iterator it = cached_.find(title);
+					if (it != cached_.end()) {
+						++hits_;
+						cache_.splice(cache_.begin(), cache_, it->second);
+						return it->second->second;
+					}
+
+					++misses_;
+					const std::string* body = store_.find(title);
+					if (!body)
+						return parsed_ptr();
+					parsed_ptr parsed = std::make_shared<ParsedTemplate>(*body);
+					cache_.push_front(std::make_pair(title, parsed));
+					cached_[title] = cache_.begin();
+					evict();
+					return parsed;
+				}
+
+			private:
+				void evict() {
+					while (cache_.size() > cache_size_) {
+						cached_.erase(cache_.back().first);
+						cache_.pop_back();
+					}
+				}
+
+				void expand_part(const ParsedTemplate& tmpl, size_t index, const Frame& frame, std::string& out, int depth) {
+					const ParsedTemplate::Part& part = tmpl.part(index);
+					for (size_t i = part.first_node; i < part.first_node + part.nodes; ++i) {
+						const ParsedTemplate::Node& node = tmpl.node(i);
+						switch (node.kind) {
+							case ParsedTemplate::NODE_TEXT:
+								out.append(tmpl.text(), node.begin, node.end - node.begin);
+								if (depth > 0)
+									output_ += node.end - node.begin;
+								break;
+							case ParsedTemplate::NODE_PARAMETER:
+								parameter(tmpl, node, frame, out, depth);
+								break;
+							case ParsedTemplate::NODE_CALL:
+								call(tmpl, node, frame, out, depth);
+								break;
+						}
+					}
+				}
+
+				std::string expand_part(const ParsedTemplate& tmpl, size_t index, const Frame& frame, int depth) {
+					std::string out;
+					expand_part(tmpl, index, frame, out, depth);
+					return out;
+				}
+
+				/**
+				 * an argument as it is, with the name and the '=' of a name=value one
+				 */
+				std::string expand_whole(const ParsedTemplate& tmpl, size_t index, const Frame& frame, int depth) {
+					std::string out;
+					expand_part(tmpl, index, frame, out, depth);
+					size_t value = tmpl.part(index).value;
+					if (value != ParsedTemplate::NO_PART) {
+						out += '=';
+						expand_part(tmpl, value, frame, out, depth);
+					}
+					return out;
+				}
+
+				void parameter(const ParsedTemplate& tmpl, const ParsedTemplate::Node& node, const Frame& frame, std::string& out, int depth) {
+					std::string name = trim(expand_part(tmpl, tmpl.child(node, 0), frame, depth));
+					if (frame.args) {
+						Arguments::const_iterator arg = frame.args->find(name);
+						if (arg != frame.args->end()) {
+							if (output_ <= max_output_)
+								out += arg->second;
+							output_ += arg->second.length();
+							return;
+						}
+					}
+					if (node.children > 1)
+						expand_part(tmpl, tmpl.child(node, 1), frame, out, depth);
+					else
+						// a parameter without a value stays as it is
+						out.append(tmpl.text(), node.begin, node.end - node.begin);
+				}
+
+				void call(const ParsedTemplate& tmpl, const ParsedTemplate::Node& node, const Frame& frame, std::string& out, int depth) {
+					std::string name = trim(expand_part(tmpl, tmpl.child(node, 0), frame, depth));
+
+					if (name == "!") {
+						out += '|';
+						return;
+					}
+					if (name == "=") {
+						out += '=';
+						return;
+					}
+					if (name == "PAGENAME" || name == "FULLPAGENAME") {
+						out += page_title_;
+						return;
+					}
+					if (name.compare(0, 6, "subst:") == 0)
+						name.erase(0, 6);
+					else if (name.compare(0, 10, "safesubst:") == 0)
+						name.erase(0, 10);
+
+					size_t colon = name.find(':');
+					if (colon != std::string::npos) {
+						if (function(name.substr(0, colon), trim(name.substr(colon + 1)), tmpl, node, frame, out, depth))
+							return;
+						// the parser functions that are not supported
+						if (name[0] == '#')
+							return;
+					}
+
+					transclude(name, tmpl, node, frame, out, depth);
+				}
+
+				/**
+				 * @return false if it is not a parser function
+				 */
+				bool function(std::string function, const std::string& first, const ParsedTemplate& tmpl,
+						const ParsedTemplate::Node& node, const Frame& frame, std::string& out, int depth) {
+					for (size_t i = 0; i < function.length(); ++i)
+						function[i] = tolower((unsigned char) function[i]);
+
+					if (function == "#if")
+						out += argument(!first.empty() ? 1 : 2, tmpl, node, frame, depth);
+					else if (function == "#ifeq")
+						out += argument(equals(first, argument(1, tmpl, node, frame, depth)) ? 2 : 3, tmpl, node, frame, depth);
+					else if (function == "#iferror") {
+						if (first.find("class=\"error\"") != std::string::npos)
+							out += argument(1, tmpl, node, frame, depth);
+						else
+							out += node.children > 2 ? argument(2, tmpl, node, frame, depth) : first;
+					}
+					else if (function == "#ifexist")
+						out += argument(store_.exists(first) ? 1 : 2, tmpl, node, frame, depth);
+					else if (function == "#switch")
+						out += switch_case(first, tmpl, node, frame, depth);
+					else if (function == "lc" || function == "uc") {
+						std::string s = first;
+						for (size_t i = 0; i < s.length(); ++i)
+							s[i] = function == "lc" ? tolower((unsigned char) s[i]) : toupper((unsigned char) s[i]);
+						out += s;
+					}
+					else if (function == "lcfirst" || function == "ucfirst") {
+						std::string s = first;
+						if (!s.empty())
+							s[0] = function == "lcfirst" ? tolower((unsigned char) s[0]) : toupper((unsigned char) s[0]);
+						out += s;
+					}
+					else
+						return false;
+					return true;
+				}
+
+				/**
+				 * the i-th part after the name, trimmed, only expanded when asked for
+				 */
+				std::string argument(size_t i, const ParsedTemplate& tmpl, const ParsedTemplate::Node& node, const Frame& frame, int depth) {
+					if (i >= node.children)
+						return std::string();
+					return trim(expand_whole(tmpl, tmpl.child(node, i), frame, depth));
+				}
+
+				/**
+				 * {{#switch: value | case = result | case1 | case2 = result | #default = result }},
+				 * the cases without a result fall through to the next result
+				 */
+				std::string switch_case(const std::string& value, const ParsedTemplate& tmpl, const ParsedTemplate::Node& node, const Frame& frame, int depth) {
+					bool found = false;
+					std::string fallback;
+					for (size_t i = 1; i < node.children; ++i) {
+						size_t index = tmpl.child(node, i);
+						const ParsedTemplate::Part& part = tmpl.part(index);
+						std::string key = trim(expand_part(tmpl, index, frame, depth));
+						if (part.value == ParsedTemplate::NO_PART) {
+							if (i + 1 == node.children)
+								// a last case without a result is the default
+								return found ? std::string() : key;
+							if (equals(key, value))
+								found = true;
+							continue;
+						}
+						if (found || equals(key, value))
+							return trim(expand_part(tmpl, part.value, frame, depth));
+						if (key == "#default")
+							fallback = trim(expand_part(tmpl, part.value, frame, depth));
+					}
+					return fallback;
+				}
+
+				/**
+				 * {{:Page}} and {{Namespace:Page}} are the pages themselves, the
+				 * other names are of the Template namespace; a missing template is
+				 * shown as a link to it unless the name is the one of a magic word,
+				 * e.g. {{CURRENTYEAR}} or {{formatnum:1234}}
+				 */
+				void transclude(const std::string& name, const ParsedTemplate& tmpl, const ParsedTemplate::Node& node, const Frame& frame, std::string& out, int depth) {
+					std::string title;
+					bool magic = false;
+					if (!name.empty() && name[0] == ':')
+						title = TemplateStore::normalize(name.substr(1));
+					else {
+						title = TemplateStore::normalize(name);
+						size_t colon = title.find(':');
+						if (colon == std::string::npos || !WikiNamespaceTable::defaults().find(title.begin(), title.begin() + colon)) {
+							magic = colon != std::string::npos || is_variable(name);
+							title = TemplateStore::normalize("Template:" + name);
+						}
+					}
+
+					for (const Frame* caller = &frame; caller; caller = caller->caller)
+						if (caller->args && *caller->title == title) {
+							out += "<span class=\"error\">Template loop detected: [[" + title + "]]</span>";
+							return;
+						}
+					if (depth >= max_depth_) {
+						out += "<span class=\"error\">Template depth limit exceeded: [[" + title + "]]</span>";
+						return;
+					}
+					if (output_ > max_output_) {
+						out += "<!-- WARNING: template omitted, post-expand include size too large -->";
+						return;
+					}
+
+					parsed_ptr body = parsed(title);
+					if (!body) {
+						// as MediaWiki shows a missing template
+						if (!magic && title.compare(0, 9, "Template:") == 0)
+							out += "[[" + title + "]]";
+						return;
+					}
+
+					Arguments args;
+					int position = 0;
+					for (size_t i = 1; i < node.children; ++i) {
+						size_t index = tmpl.child(node, i);
+						const ParsedTemplate::Part& part = tmpl.part(index);
+						if (part.value == ParsedTemplate::NO_PART) {
+							char number[16];
+							snprintf(number, sizeof(number), "%d", ++position);
+							args[number] = expand_part(tmpl, index, frame, depth);
+						}
+						else
+							args[trim(expand_part(tmpl, index, frame, depth))] = trim(expand_part(tmpl, part.value, frame, depth));
+					}
+
+					Frame callee = { &title, &args, &frame };
+					expand_part(*body, body->root(), callee, out, depth + 1);
+				}
+
+				/**
+				 * the names of the variables are in upper case, e.g. CURRENTYEAR
+				 */
+				static bool is_variable(const std::string& name) {
+					bool letter = false;
+					for (size_t i = 0; i < name.length(); ++i) {
+						if (isupper((unsigned char) name[i]))
+							letter = true;
+						else if (!isdigit((unsigned char) name[i]))
+							return false;
+					}
+					return letter;
+				}
+
+				/**
+				 * numbers compare as numbers, the rest as strings
+				 */
+				static bool equals(const std::string& a, const std::string& b) {
+					if (a == b)
+						return true;
+					char* a_end;
+					char* b_end;
+					double x = strtod(a.c_str(), &a_end), y = strtod(b.c_str(), &b_end);
+					return !a.empty() && !b.empty() && *a_end == '\0' && *b_end == '\0' && x == y;
+				}
+
+				static std::string trim(const std::string& s) {
+					size_t begin = 0, end = s.length();
+					while (begin < end && isspace((unsigned char) s[begin]))
+						++begin;
+					while (end > begin && isspace((unsigned char) s[end - 1]))
+						--end;
+					return s.substr(begin, end - begin);
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_TEMPLATE_H_ */
@@ -0,0 +1,392 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_TITLE_H_
+#define STPL_WIKI_TITLE_H_
+
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <stdint.h>
+
+#include "stpl_wiki_constants.h"
+#include "../../utils/simd.h"
+#include "../../utils/intern.h"
+
+namespace stpl {
+	namespace WIKI {
+
+		/**
+		 * @brief the numbers of the namespaces MediaWiki has by default
+		 */
+		enum WikiNamespace {
+			NS_MEDIA = -2,
+			NS_SPECIAL = -1,
+			NS_MAIN = 0,
+			NS_TALK = 1,
+			NS_USER = 2,
+			NS_USER_TALK = 3,
+			NS_PROJECT = 4,
+			NS_PROJECT_TALK = 5,
+			NS_FILE = 6,
+			NS_FILE_TALK = 7,
+			NS_MEDIAWIKI = 8,
+			NS_MEDIAWIKI_TALK = 9,
+			NS_TEMPLATE = 10,
+			NS_TEMPLATE_TALK = 11,
+			NS_HELP = 12,
+			NS_HELP_TALK = 13,
+			NS_CATEGORY = 14,
+			NS_CATEGORY_TALK = 15,
+			NS_PORTAL = 100,
+			NS_PORTAL_TALK = 101
+		};
+
+		struct WikiNamespaceName {
+			std::string											name;
+			int													id;
+			std::string											canonical;		/// the first name added for the namespace
+		};
+
+		/**
+		 * @brief the namespace names, looked up with a perfect hash
+		 *
+		 * Once the names are added, build() searches for a seed that gives each
+		 * of them a slot of its own, so a lookup is one hash and at most one
+		 * comparison. The names compare ignoring ASCII case, with '_' the same
+		 * as a space.
+		 */
+		class WikiNamespaceTable {
+			public:
+				enum { MAX_SEEDS = 1 << 16 };
+
+			private:
+				std::vector<WikiNamespaceName>						names_;
+				std::vector<int>									slots_;		/// index in names_, -1 if empty
+				uint32_t											seed_;
+				size_t												max_length_;
+
+			public:
+				WikiNamespaceTable() : seed_(0), max_length_(0) {}
+				~WikiNamespaceTable() {}
+
+				/**
+				 * @brief the table of the default namespaces with their aliases,
+				 * and the names in WikiEntityVariables::link_category and
+				 * link_file at the time it is first used
+				 */
+				static const WikiNamespaceTable& defaults() {
+					static const WikiNamespaceTable table = make_defaults();
+					return table;
+				}
+
+				/**
+				 * @brief a name of a namespace, build() has to be called after
+				 * the last one; the names already in the table are ignored
+				 */
+				void add(const std::string& name, int id) {
+					std::string key = name;
+					for (size_t i = 0; i < key.length(); ++i)
+						if (key[i] == '_')
+							key[i] = ' ';
+					if (key.empty())
+						return;
+					for (size_t i = 0; i < names_.size(); ++i)
+						if (names_[i].name.length() == key.length() && utils::ascii_iequals(names_[i].name.data(), key.data(), key.length()))
+							return;
+
+					WikiNamespaceName entry;
+					entry.name = key;
+					entry.id = id;
+					entry.canonical = key;
+					for (size_t i = 0; i < names_.size(); ++i)
+						if (names_[i].id == id) {
+							entry.canonical = names_[i].canonical;
+							break;
+						}
+					names_.push_back(entry);
+					if (key.length() > max_length_)
+						max_length_ = key.length();
+				}
+
+				void build() {
+					size_t size = 2;
+					while (size < 2 * names_.size())
+						size *= 2;
+					for (;; size *= 2)
+						for (uint32_t seed = 0; seed < MAX_SEEDS; ++seed)
+							if (try_seed(seed, size))
+								return;
+				}
+
+				/**
+				 * @return the namespace of the name in [begin, end), NULL if it is
+				 * not the name of one
+				 */
+				template <typename IteratorT>
+				const WikiNamespaceName* find(IteratorT begin, IteratorT end) const {
+					size_t length = end - begin;
+					if (slots_.empty() || length == 0 || length > max_length_)
+						return NULL;
+					int index = slots_[hash_of(begin, end, seed_) & (slots_.size() - 1)];
+					if (index < 0)
+						return NULL;
+					const std::string& name = names_[index].name;
+					if (name.length() != length)
+						return NULL;
+					IteratorT p = begin;
+					for (size_t i = 0; i < length; ++i, ++p)
+						if (fold(*p) != fold(name[i]))
+							return NULL;
+					return &names_[index];
+				}
+
+				size_t size() const {
+					return names_.size();
+				}
+
+			private:
+				static char fold(char c) {
+					return c == '_' ? ' ' : utils::ascii_lower(c);
+				}
+
+				template <typename IteratorT>
+				static uint32_t hash_of(IteratorT begin, IteratorT end, uint32_t seed) {
+					uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+					for (IteratorT p = begin; p != end; ++p) {
+						hash ^= (unsigned char) fold(*p);
+						hash *= 16777619u;
+					}
+					return hash ^ (hash >> 16);
+				}
+
+				bool try_seed(uint32_t seed, size_t size) {
+					slots_.assign(size, -1);
+					for (size_t i = 0; i < names_.size(); ++i) {
+						const std::string& name = names_[i].name;
+						int& slot = slots_[hash_of(name.begin(), name.end(), seed) & (size - 1)];
+						if (slot >= 0)
+							return false;
+						slot = (int) i;
+					}
+					seed_ = seed;
+					return true;
+				}
+
+				static WikiNamespaceTable make_defaults() {
+					static const struct { const char* name; int id; } NAMES[] = {
+						{ "Media", NS_MEDIA }, { "Special", NS_SPECIAL },
+						{ "Talk", NS_TALK },
+						{ "User", NS_USER }, { "User talk", NS_USER_TALK },
+						{ "Wikipedia", NS_PROJECT }, { "Project", NS_PROJECT },
+						{ "Wikipedia talk", NS_PROJECT_TALK }, { "Project talk", NS_PROJECT_TALK },
+						{ "File", NS_FILE }, { "Image", NS_FILE },
+						{ "File talk", NS_FILE_TALK }, { "Image talk", NS_FILE_TALK },
+						{ "MediaWiki", NS_MEDIAWIKI }, { "MediaWiki talk", NS_MEDIAWIKI_TALK },
+						{ "Template", NS_TEMPLATE }, { "Template talk", NS_TEMPLATE_TALK },
+						{ "Help", NS_HELP }, { "Help talk", NS_HELP_TALK },
+						{ "Category", NS_CATEGORY }, { "Category talk", NS_CATEGORY_TALK },
+						{ "Portal", NS_PORTAL }, { "Portal talk", NS_PORTAL_TALK }
+					};
+
+					WikiNamespaceTable table;
+					for (size_t i = 0; i < sizeof(NAMES) / sizeof(NAMES[0]); ++i)
+						table.add(NAMES[i].name, NAMES[i].id);
+					table.add(WikiEntityVariables::link_category, NS_CATEGORY);
+					table.add(WikiEntityVariables::link_file, NS_FILE);
+					table.build();
+					return table;
+				}
+		};
+
+		/**
+		 * @brief the canonical form of a page title, appended to out
+		 *
+		 * The leading colon and the fragment are dropped, the spaces and
+		 * underscores are trimmed and collapsed into one space and the first
+		 * letter is put in upper case. When the title begins with a namespace
+		 * the prefix is replaced by the canonical name of the namespace, the
+		 * spaces around its colon are dropped and the first letter of the name
+		 * is put in upper case: " category: foo__bar#x" is "Category:Foo bar"
+		 * and "image:a.jpg" is "File:A.jpg", while "Star Wars: episode I" stays
+		 * as it is.
+		 */
+		template <typename IteratorT>
+		void normalize_title(IteratorT begin, IteratorT end, std::string& out,
+				const WikiNamespaceTable& namespaces = WikiNamespaceTable::defaults()) {
+			size_t start = out.length();
+			IteratorT p = begin;
+			while (p < end && (*p == ' ' || *p == '_' || *p == '\t'))
+				++p;
+			if (p < end && *p == ':')
+				++p;
+
+			bool space = false;
+			size_t colon = std::string::npos;
+			for (; p < end && *p != '#'; ++p) {
+				char c = *p;
+				if (c == ' ' || c == '_' || c == '\t') {
+					space = out.length() > start;
+					continue;
+				}
+				if (space)
+					out += ' ';
+				space = false;
+				if (c == ':' && colon == std::string::npos)
+					colon = out.length();
+				out += c;
+			}
+			if (start < out.length())
+				out[start] = toupper((unsigned char) out[start]);
+			if (colon == std::string::npos)
+				return;
+
+			size_t prefix_end = colon;
+			if (prefix_end > start && out[prefix_end - 1] == ' ')
+				--prefix_end;
+			const WikiNamespaceName* ns = namespaces.find(out.begin() + start, out.begin() + prefix_end);
+			if (!ns)
+				return;
+			size_t name = colon + 1;
+			if (name < out.length() && out[name] == ' ')
+				++name;
+			out.replace(start, name - start, ns->canonical);
+			name = start + ns->canonical.length();
+			out.insert(name++, 1, ':');
+			if (name < out.length())
+				out[name] = toupper((unsigned char) out[name]);
+		}
+
+		inline std::string normalize_title(const std::string& title) {
+			std::string out;
+			out.reserve(title.length());
+			normalize_title(title.data(), title.data() + title.length(), out);
+			return out;
+		}
+
+		/**
+		 * @brief the canonical titles of a document, each kept once
+		 *
+		 * A title is normalized into a buffer that is reused from one title to
+		 * the next and then interned, so looking up the targets of a page full
+		 * of links doesn't make a string for each.
+		 */
+		class WikiTitleArena {
+			public:
+				typedef utils::StringInterner::id_type				id_type;
+
+				static const id_type								NO_ID = utils::StringInterner::NO_ID;
+
+			private:
+				const WikiNamespaceTable*							namespaces_;
+				utils::StringInterner								strings_;
+				std::vector<int>									spaces_;	/// the namespace of each title
+				std::vector<uint32_t>								names_;		/// where the name begins after the prefix
+				std::string											buffer_;
+
+			public:
+				WikiTitleArena(const WikiNamespaceTable& namespaces = WikiNamespaceTable::defaults())
+						: namespaces_(&namespaces) {}
+				~WikiTitleArena() {}
+
+				/**
+				 * @return the id of the canonical form of the title in [begin, end),
+				 * NO_ID if there is nothing left of it, e.g. "#section"
+				 */
+				template <typename IteratorT>
+				id_type intern(IteratorT begin, IteratorT end) {
+					buffer_.clear();
+					normalize_title(begin, end, buffer_, *namespaces_);
+					if (buffer_.empty())
+						return NO_ID;
+
+					int space = NS_MAIN;
+					size_t name = 0;
+					size_t colon = buffer_.find(':');
+					if (colon != std::string::npos) {
+						const WikiNamespaceName* ns = namespaces_->find(buffer_.begin(), buffer_.begin() + colon);
+						if (ns) {
+							space = ns->id;
+							name = colon + 1;
+						}
+					}
+
+					id_type id = strings_.intern(buffer_);
+					if (id == spaces_.size()) {
+						spaces_.push_back(space);
+						names_.push_back((uint32_t) name);
+					}
+					return id;
+				}
+
+				id_type intern(const std::string& title) {
+					return intern(title.begin(), title.end());
+				}
+
+				/**
+				 * @brief the NUL terminated title, only valid until the next one
+				 * is interned
+				 */
+				const char* data(id_type id) const {
+					return strings_.data(id);
+				}
+
+				size_t length(id_type id) const {
+					return strings_.length(id);
+				}
+
+				std::string str(id_type id) const {
+					return strings_.str(id);
+				}
+
+				int name_space(id_type id) const {
+					return spaces_[id];
+				}
+
+				/**
+				 * @brief the title without its namespace prefix
+				 */
+				const char* name(id_type id) const {
+					return data(id) + names_[id];
+				}
+
+				size_t name_length(id_type id) const {
+					return length(id) - names_[id];
+				}
+
+				size_t size() const {
+					return strings_.size();
+				}
+
+				size_t bytes() const {
+					return strings_.bytes();
+				}
+
+				void clear() {
+					strings_.clear();
+					spaces_.clear();
+					names_.clear();
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_TITLE_H_ */
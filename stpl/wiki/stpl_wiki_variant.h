@@ -0,0 +1,311 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_VARIANT_H_
+#define STPL_WIKI_VARIANT_H_
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <ctype.h>
+
+#include "../lang/stpl_chinese_convert.h"
+#include "../../utils/simd.h"
+
+/**
+ * The conversion of the wikitext of a Chinese page into one variant, an
+ * opt-in pass before the page is parsed
+ *
+ * The text is converted with the tables of the variant. The language
+ * variant markup -{ }- is resolved on the way:
+ *
+ *   -{text}-, -{R|text}-                 the text as it is
+ *   -{zh-hans:..;zh-hant:..;}-           the text of the variant
+ *   -{A|zh-hans:..;zh-hant:..;}-         the same, and a rule for the page
+ *   -{H|zh-hans:..;zh-hant:..;}-         only the rule
+ *   -{T|..}-, -{-|..}-                   nothing
+ *
+ * A rule converts the text of the other variants into the one of the
+ * variant anywhere in the page, before or after it, and wins over the
+ * tables. Comments, tags, <math> and the targets of the links are not
+ * converted.
+ */
+namespace stpl {
+	namespace WIKI {
+
+		class WikiVariantConverter {
+			private:
+				/**
+				 * a -{ }- block, the flags and the content between them
+				 */
+				struct Block {
+					const char*		begin;
+					const char*		end;
+					const char*		content;
+					const char*		content_end;
+					std::string		flags;
+				};
+
+				struct Choice {
+					UNICODE::ChineseVariant		variant;
+					const char*					begin;
+					const char*					end;
+				};
+
+				const UNICODE::ChineseConverter&		converter_;
+				UNICODE::ChineseVariant					variant_;
+				UNICODE::ChineseConversionTable			rules_;
+				std::vector<Block>						blocks_;
+				std::vector<Choice>						choices_;
+
+			public:
+				WikiVariantConverter(const UNICODE::ChineseConverter& converter, UNICODE::ChineseVariant variant)
+						: converter_(converter), variant_(variant) {}
+				~WikiVariantConverter() {}
+
+				UNICODE::ChineseVariant variant() const { return variant_; }
+
+				std::string convert(const std::string& text) {
+					std::string out;
+					out.reserve(text.length() + text.length() / 8);
+					convert(text.data(), text.data() + text.length(), out);
+					return out;
+				}
+
+				/**
+				 * @brief append the wikitext of [begin, end) converted to out
+				 */
+				void convert(const char* begin, const char* end, std::string& out) {
+					// the rules of the page first, they apply to all of it
+					blocks_.clear();
+					rules_.clear();
+					find_blocks(begin, end);
+					for (size_t i = 0; i < blocks_.size(); ++i)
+						if (blocks_[i].flags.find_first_of("AH") != std::string::npos)
+							add_rules(blocks_[i]);
+					rules_.build();
+
+					const char* p = begin;
+					for (size_t i = 0; i < blocks_.size(); ++i) {
+						convert_text(p, blocks_[i].begin, out);
+						write_block(blocks_[i], out);
+						p = blocks_[i].end;
+					}
+					convert_text(p, end, out);
+				}
+
+			private:
+				void find_blocks(const char* begin, const char* end) {
+					const char* p = begin;
+					while ((p = utils::find_char(p, end, '-')) < end) {
+						if (end - p < 2 || p[1] != '{') {
+							++p;
+							continue;
+						}
+						// the blocks can be nested, the outer one is taken
+						int depth = 1;
+						const char* q = p + 2;
+						while (q + 1 < end && depth > 0) {
+							if (q[0] == '-' && q[1] == '{') {
+								++depth;
+								q += 2;
+							}
+							else if (q[0] == '}' && q[1] == '-') {
+								--depth;
+								q += 2;
+							}
+							else
+								++q;
+						}
+						if (depth > 0)
+							break;
+
+						Block block;
+						block.begin = p;
+						block.end = q;
+						block.content = p + 2;
+						block.content_end = q - 2;
+						parse_flags(block);
+						blocks_.push_back(block);
+						p = q;
+					}
+				}
+
+				/**
+				 * the flags before a '|', a few letters; -{zh-hans:..|..}- has none
+				 */
+				static void parse_flags(Block& block) {
+					const char* bar = utils::find_char(block.content, block.content_end, '|');
+					if (bar == block.content_end || bar - block.content > 16)
+						return;
+					for (const char* p = block.content; p < bar; ++p)
+						if (!isalpha((unsigned char) *p) && *p != '-' && *p != ';' && *p != ' ')
+							return;
+					for (const char* p = block.content; p < bar; ++p)
+						if (*p != ';' && *p != ' ')
+							block.flags += toupper((unsigned char) *p);
+					block.content = bar + 1;
+				}
+
+				/**
+				 * zh-hans:..;zh-hant:..; into choices_, empty if the content is
+				 * not in that form
+				 */
+				void parse_choices(const Block& block) {
+					choices_.clear();
+					const char* p = block.content;
+					const char* end = block.content_end;
+					while (p < end) {
+						while (p < end && isspace((unsigned char) *p))
+							++p;
+						const char* colon = utils::find_char(p, end, ':');
+						UNICODE::ChineseVariant variant = colon < end ? UNICODE::chinese_variant(p, colon - p) : UNICODE::ZH_VARIANTS;
+						if (variant == UNICODE::ZH_VARIANTS) {
+							// a ';' in the text of the previous variant
+							if (choices_.empty())
+								return;
+							const char* semicolon = utils::find_char(p, end, ';');
+							choices_.back().end = semicolon;
+							p = semicolon < end ? semicolon + 1 : end;
+							continue;
+						}
+						Choice choice;
+						choice.variant = variant;
+						choice.begin = colon + 1;
+						choice.end = utils::find_char(choice.begin, end, ';');
+						choices_.push_back(choice);
+						p = choice.end < end ? choice.end + 1 : end;
+					}
+				}
+
+				/**
+				 * the text for the variant: its own, the one of a close variant,
+				 * or the first one given
+				 */
+				const Choice* choose() const {
+					static const UNICODE::ChineseVariant FALLBACKS[UNICODE::ZH_VARIANTS][4] = {
+							{ UNICODE::ZH_HANS, UNICODE::ZH_VARIANTS },
+							{ UNICODE::ZH_HANT, UNICODE::ZH_TW, UNICODE::ZH_HK, UNICODE::ZH_VARIANTS },
+							{ UNICODE::ZH_TW, UNICODE::ZH_HANT, UNICODE::ZH_HK, UNICODE::ZH_VARIANTS },
+							{ UNICODE::ZH_HK, UNICODE::ZH_HANT, UNICODE::ZH_TW, UNICODE::ZH_VARIANTS }
+					};
+					if (choices_.empty())
+						return NULL;
+					for (const UNICODE::ChineseVariant* fallback = FALLBACKS[variant_]; *fallback != UNICODE::ZH_VARIANTS; ++fallback)
+						for (size_t i = 0; i < choices_.size(); ++i)
+							if (choices_[i].variant == *fallback)
+								return &choices_[i];
+					return &choices_[0];
+				}
+
+				void add_rules(const Block& block) {
+					parse_choices(block);
+					const Choice* chosen = choose();
+					if (!chosen)
+						return;
+					for (size_t i = 0; i < choices_.size(); ++i) {
+						const Choice& choice = choices_[i];
+						const char* from = choice.begin;
+						const char* from_end = choice.end;
+						trim(from, from_end);
+						if (&choice != chosen && from < from_end)
+							rules_.add(from, from_end - from, chosen->begin, chosen->end - chosen->begin);
+					}
+				}
+
+				void write_block(const Block& block, std::string& out) {
+					if (block.flags.find_first_of("HT-") != std::string::npos)
+						return;
+					if (block.flags.find('R') == std::string::npos) {
+						parse_choices(block);
+						const Choice* chosen = choose();
+						if (chosen) {
+							out.append(chosen->begin, chosen->end);
+							return;
+						}
+					}
+					out.append(block.content, block.content_end);
+				}
+
+				/**
+				 * the text between the blocks, the bits that are not text are
+				 * copied as they are
+				 */
+				void convert_text(const char* begin, const char* end, std::string& out) {
+					static const utils::ByteSet protected_bytes("<[");
+
+					const char* p = begin;
+					while (p < end) {
+						const char* q = protected_bytes.find(p, end);
+						converter_.convert(p, q, variant_, out, &rules_);
+						if (q == end)
+							break;
+						const char* skip = skip_protected(q, end);
+						out.append(q, skip);
+						p = skip;
+					}
+				}
+
+				/**
+				 * @return the end of the comment, tag, <math> block or link
+				 * target at p, p + 1 if there is none
+				 */
+				static const char* skip_protected(const char* p, const char* end) {
+					if (*p == '[') {
+						if (end - p < 2 || p[1] != '[')
+							return p + 1;
+						// the target, up to the '|' or the end of the link
+						const char* q = p + 2;
+						while (q < end && *q != '|' && *q != ']' && *q != '\n' && *q != '[')
+							++q;
+						return q;
+					}
+
+					if (end - p >= 4 && p[1] == '!' && p[2] == '-' && p[3] == '-') {
+						static const char COMMENT_END[] = "-->";
+						const char* close = std::search(p + 4, end, COMMENT_END, COMMENT_END + 3);
+						return close == end ? end : close + 3;
+					}
+					if (end - p >= 6 && utils::ascii_iequals(p + 1, "math", 4) && (p[5] == '>' || p[5] == ' ')) {
+						const char* close = utils::find_end_tag(p + 5, end, "math", 4);
+						return utils::find_char(close, end, '>') < end ? utils::find_char(close, end, '>') + 1 : end;
+					}
+					// a tag with its attributes, not the text after it
+					if (end - p >= 2 && (isalpha((unsigned char) p[1]) || p[1] == '/')) {
+						const char* gt = utils::find_char(p, end, '>');
+						const char* lt = utils::find_char(p + 1, gt, '<');
+						if (gt < end && lt == gt)
+							return gt + 1;
+					}
+					return p + 1;
+				}
+
+				static void trim(const char*& begin, const char*& end) {
+					while (begin < end && isspace((unsigned char) *begin))
+						++begin;
+					while (end > begin && isspace((unsigned char) end[-1]))
+						--end;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_VARIANT_H_ */
@@ -0,0 +1,320 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ * @twitter				https://twitter.com/_e_tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_WIKI_WRITER_H_
+#define STPL_WIKI_WRITER_H_
+
+#include <string>
+#include <cstdio>
+#include <cstring>
+
+#include "../../utils/simd.h"
+
+namespace stpl {
+	namespace WIKI {
+
+		/**
+		 * @brief where the rendered links point to and what goes into the head
+		 * of a page, given to the writer so the pages rendered at the same time
+		 * can each have their own
+		 */
+		struct WikiRenderContext {
+			std::string												protocol;
+			std::string												host;
+			std::string												path;
+			std::string												html_head;
+
+			WikiRenderContext() : protocol("http"), host("localhost"), path("/") {}
+
+			static const WikiRenderContext& defaults() {
+				static const WikiRenderContext context;
+				return context;
+			}
+		};
+
+		/**
+		 * @brief the sink the wiki renderers append to, so a whole page is written
+		 * into one buffer instead of every entity returning its own string
+		 *
+		 * While an EscapeQuotes or StripNewlines scope is open, everything written
+		 * is filtered on the way through, which is how the content that goes into
+		 * a JSON string gets escaped without being rendered into a string first.
+		 *
+		 * The writer also keeps the state of the render itself, so a page can be
+		 * rendered on any thread without touching anything shared.
+		 */
+		class WikiWriter {
+			private:
+				int													escape_quotes_;
+				int													strip_newlines_;
+				char												last_;
+
+				const WikiRenderContext*							context_;
+				bool												paragraph_open_;	/// a <p> is written but not closed yet
+
+			public:
+				/**
+				 * @brief escape the quotes written in the scope with a backslash,
+				 * the ones that are escaped already are left alone
+				 */
+				class EscapeQuotes {
+					private:
+						WikiWriter&									out_;
+
+					public:
+						EscapeQuotes(WikiWriter& out) : out_(out) {
+							if (out_.escape_quotes_++ == 0)
+								out_.last_ = '\0';
+						}
+						~EscapeQuotes() { --out_.escape_quotes_; }
+				};
+
+				class StripNewlines {
+					private:
+						WikiWriter&									out_;
+
+					public:
+						StripNewlines(WikiWriter& out) : out_(out) { ++out_.strip_newlines_; }
+						~StripNewlines() { --out_.strip_newlines_; }
+				};
+
+				WikiWriter(const WikiRenderContext& context = WikiRenderContext::defaults())
+						: escape_quotes_(0), strip_newlines_(0), last_('\0'), context_(&context), paragraph_open_(false) {}
+				virtual ~WikiWriter() {}
+
+				/**
+				 * @brief the context has to outlive the render
+				 */
+				const WikiRenderContext& context() const {
+					return *context_;
+				}
+
+				void context(const WikiRenderContext& context) {
+					context_ = &context;
+				}
+
+				bool paragraph_open() const {
+					return paragraph_open_;
+				}
+
+				void paragraph_open(bool open) {
+					paragraph_open_ = open;
+				}
+
+				void write(const char* s, size_t n) {
+					if (escape_quotes_ == 0 && strip_newlines_ == 0)
+						put(s, n);
+					else
+						filter(s, n);
+				}
+
+				WikiWriter& operator<< (const std::string& s) {
+					write(s.data(), s.length());
+					return *this;
+				}
+
+				WikiWriter& operator<< (const char* s) {
+					write(s, strlen(s));
+					return *this;
+				}
+
+				WikiWriter& operator<< (char c) {
+					write(&c, 1);
+					return *this;
+				}
+
+				WikiWriter& operator<< (long n) {
+					char buf[24];
+					char* p = buf + sizeof(buf);
+					unsigned long u = n < 0 ? 0UL - (unsigned long) n : (unsigned long) n;
+					do {
+						*--p = '0' + u % 10;
+						u /= 10;
+					} while (u > 0);
+					if (n < 0)
+						*--p = '-';
+					write(p, buf + sizeof(buf) - p);
+					return *this;
+				}
+
+				WikiWriter& operator<< (int n) {
+					return *this << (long) n;
+				}
+
+				/**
+				 * @brief write s as the content of a JSON string
+				 */
+				void escape_json(const char* s, size_t n) {
+					const char* end = s + n;
+					while (s < end) {
+						const char* p = utils::find_json_special(s, end);
+						if (p > s)
+							write(s, p - s);
+						if (p == end)
+							break;
+
+						switch (*p) {
+						case '"': write("\\\"", 2); break;
+						case '\\': write("\\\\", 2); break;
+						case '\n': write("\\n", 2); break;
+						case '\r': write("\\r", 2); break;
+						case '\t': write("\\t", 2); break;
+						default: {
+							static const char hex[] = "0123456789abcdef";
+							char buf[6] = {'\\', 'u', '0', '0', hex[(*p >> 4) & 0xf], hex[*p & 0xf]};
+							write(buf, sizeof(buf));
+						}
+						}
+						s = p + 1;
+					}
+				}
+
+				void escape_json(const std::string& s) {
+					escape_json(s.data(), s.length());
+				}
+
+				/**
+				 * @brief write s as HTML text or attribute value, or with only the
+				 * quotes replaced if quotes_only is set
+				 */
+				void escape_html(const char* s, size_t n, bool quotes_only = false) {
+					const char* end = s + n;
+					const char* specials = quotes_only ? "\"'" : "&<>\"'";
+					size_t count = quotes_only ? 2 : 5;
+					while (s < end) {
+						const char* p = utils::find_any(s, end, specials, count);
+						if (p > s)
+							write(s, p - s);
+						if (p == end)
+							break;
+
+						switch (*p) {
+						case '&': *this << "&amp;"; break;
+						case '<': *this << "&lt;"; break;
+						case '>': *this << "&gt;"; break;
+						case '"': *this << "&quot;"; break;
+						default: *this << "&apos;"; break;
+						}
+						s = p + 1;
+					}
+				}
+
+				void escape_html(const std::string& s, bool quotes_only = false) {
+					escape_html(s.data(), s.length(), quotes_only);
+				}
+
+				virtual void flush() {}
+
+			protected:
+				/**
+				 * @brief append the bytes to the output as they are
+				 */
+				virtual void put(const char* s, size_t n) = 0;
+
+			private:
+				void filter(const char* s, size_t n) {
+					char specials[2];
+					size_t count = 0;
+					if (escape_quotes_ > 0)
+						specials[count++] = '"';
+					if (strip_newlines_ > 0)
+						specials[count++] = '\n';
+
+					const char* end = s + n;
+					while (s < end) {
+						const char* p = utils::find_any(s, end, specials, count);
+						if (p > s) {
+							put(s, p - s);
+							last_ = p[-1];
+						}
+						if (p == end)
+							break;
+
+						if (*p == '"') {
+							if (last_ == '\\')
+								put(p, 1);
+							else
+								put("\\\"", 2);
+							last_ = '"';
+						}
+						s = p + 1;
+					}
+				}
+		};
+
+		/**
+		 * @brief appends to a string of the caller, which can be reserved and
+		 * reused across pages
+		 */
+		class StringWikiWriter : public WikiWriter {
+			private:
+				std::string&										out_;
+
+			public:
+				StringWikiWriter(std::string& out, const WikiRenderContext& context = WikiRenderContext::defaults())
+						: WikiWriter(context), out_(out) {}
+				virtual ~StringWikiWriter() {}
+
+			protected:
+				virtual void put(const char* s, size_t n) {
+					out_.append(s, n);
+				}
+		};
+
+		/**
+		 * @brief writes to a FILE through a buffer of its own
+		 */
+		class FileWikiWriter : public WikiWriter {
+			public:
+				enum { BUFFER_SIZE = 64 * 1024 };
+
+			private:
+				FILE*												file_;
+				char												buffer_[BUFFER_SIZE];
+				size_t												used_;
+
+			public:
+				FileWikiWriter(FILE* file, const WikiRenderContext& context = WikiRenderContext::defaults())
+						: WikiWriter(context), file_(file), used_(0) {}
+				virtual ~FileWikiWriter() { flush(); }
+
+				virtual void flush() {
+					if (used_ > 0)
+						fwrite(buffer_, 1, used_, file_);
+					used_ = 0;
+				}
+
+			protected:
+				virtual void put(const char* s, size_t n) {
+					if (used_ + n > BUFFER_SIZE) {
+						flush();
+						if (n >= BUFFER_SIZE) {
+							fwrite(s, 1, n, file_);
+							return;
+						}
+					}
+					memcpy(buffer_ + used_, s, n);
+					used_ += n;
+				}
+		};
+	}
+}
+
+#endif /* STPL_WIKI_WRITER_H_ */
@@ -96,6 +96,7 @@ namespace stpl {
 
 			private:
 				void init() {
+					root_ = NULL;
 					//debug
 					// this->ref().append("<?xml version=\"1.0\" encoding=\"utf-8\"?>");
 				}
@@ -181,9 +182,11 @@ namespace stpl {
 				typedef DocumentT							document_type;
 				typedef typename EntityT::string_type	 	string_type;
 				typedef typename EntityT::iterator		 	iterator;
+				typedef typename element_type::context_type	context_type;
 
 			protected:
-				tree_type	tree_;
+				tree_type		tree_;
+				context_type	context_;
 
 
 			public:
@@ -199,10 +202,35 @@ namespace stpl {
 				}
 
 				tree_type& parse_tree(IteratorT begin, IteratorT end) {
-					init(begin, end);
+					reset(begin, end);
 					return this->parse_tree();
 				}
 
+				void reset(IteratorT begin, IteratorT end) {
+					Parser<GrammarT
+							, DocumentT
+							, EntityT
+							, ScannerT
+							>::reset(begin, end);
+					tree_.clear();
+					this->doc().root(NULL);
+				}
+
+				/**
+				 * @brief bound the nodes, depth, attributes and bytes of the trees
+				 * built by this parser, a parse that hits a limit stops with the
+				 * partial tree and tripped() says which limit it was
+				 */
+				void limits(const ParseLimits& limits) { context_.limits(limits); }
+				const ParseLimits& limits() const { return context_.limits(); }
+
+				/**
+				 * @return the limit that stopped the last parse, LIMIT_NONE if
+				 * the document was parsed completely
+				 */
+				ParseLimit tripped() const { return context_.tripped(); }
+				const context_type& context() const { return context_; }
+
 				tree_type& parse_tree() {
 					parse();
 					root()->traverse(tree_);
@@ -210,6 +238,8 @@ namespace stpl {
 				}
 
 				virtual DocumentT& parse() {
+					context_.reset();
+					typename context_type::Scope scope(&context_);
 					Parser<GrammarT
 							, DocumentT
 							, EntityT
@@ -22,6 +22,7 @@
 
 #include "../stpl_entity.h"
 #include "../stpl_property.h"
+#include "../../utils/xml.h"
 #include <map>
 
 namespace stpl {
@@ -115,11 +116,46 @@ namespace stpl {
 				    Property<StringT, IteratorT>::Property(begin, end) { init(); }
 				XmlAttribute(StringT content) : 
 					Property<StringT, IteratorT>::Property(content) {
+					clear_decoded();
 				}
 				virtual ~XmlAttribute() {}		
+
+				/**
+				 * @brief the value with the predefined entities and the character
+				 * references decoded on the first call, a value without any is
+				 * returned as it is
+				 */
+				StringT decoded_value() {
+					if (!decoded_checked_) {
+						decoded_checked_ = true;
+						if (this->value_.begin() != this->value_.end()) {
+							const char* begin = &*this->value_.begin();
+							const char* end = begin + (this->value_.end() - this->value_.begin());
+							if ((needs_decoding_ = utils::needs_xml_decoding(begin, end))) {
+								decoded_.clear();
+								utils::decode_xml(begin, end, decoded_);
+							}
+						}
+					}
+					if (needs_decoding_)
+						return StringT(decoded_.begin(), decoded_.end());
+					return StringT(this->value_.begin(), this->value_.end());
+				}
 				
 			private:
-				void init() { this->force_end_quote_ = true; }
+				std::string		decoded_;
+				bool			decoded_checked_;
+				bool			needs_decoding_;
+
+				void init() {
+					this->force_end_quote_ = true;
+					clear_decoded();
+				}
+
+				void clear_decoded() {
+					decoded_checked_ = false;
+					needs_decoding_ = false;
+				}
 				
 			protected:
 				virtual bool is_end_char(IteratorT& it) {
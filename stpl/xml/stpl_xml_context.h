@@ -0,0 +1,275 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang 
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_XML_CONTEXT_H_
+#define STPL_XML_CONTEXT_H_
+
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+namespace stpl {
+	namespace XML {
+
+		/**
+		 * @brief the limit that stopped a parse
+		 */
+		enum ParseLimit {
+			LIMIT_NONE = 0,
+			LIMIT_NODES,
+			LIMIT_DEPTH,
+			LIMIT_ATTRIBUTES,
+			LIMIT_BYTES
+		};
+
+		/**
+		 * @brief per parse limits to bound the work and memory spent on one
+		 * document, 0 means unlimited
+		 *
+		 * The bytes are an estimate of what the tree holds: the node objects
+		 * plus the strings copied out of the input, the text itself stays in
+		 * the input.
+		 */
+		struct ParseLimits {
+			size_t		max_nodes;
+			size_t		max_depth;
+			size_t		max_attributes;	/// per element
+			size_t		max_bytes;
+
+			ParseLimits() : max_nodes(0), max_depth(0), max_attributes(0), max_bytes(0) {}
+		};
+
+		/**
+		 * @brief the state shared by all the elements of one parse
+		 *
+		 * Tag names are interned to small ids, and the ids of the elements that
+		 * are still open are kept on a stack with the depth of the innermost open
+		 * element per id, so whether an end tag closes any open element, and
+		 * which one, is answered with one lookup instead of comparing names up
+		 * the tree an ancestor at a time.
+		 *
+		 * A parser with its own table of names, like the HTML tag table, reserves
+		 * the ids of that table and opens elements by them; the names outside it
+		 * are interned after the reserved ids.
+		 *
+		 * It also counts the nodes and bytes of the tree against the limits,
+		 * once a limit trips the elements stop matching and the parse unwinds
+		 * with the tree built so far.
+		 */
+		template <typename StringT>
+		class ParseContext {
+			public:
+				enum { NO_ID = -1 };
+
+			private:
+				typedef std::map<StringT, int>				id_map;
+
+				/**
+				 * an open element, and the depth of the previous open element
+				 * with the same id
+				 */
+				struct OpenElement {
+					int										id;
+					size_t									previous;
+				};
+
+				id_map										ids_;
+				int											reserved_;
+				int											next_id_;
+				std::vector<size_t>							innermost_;	/// per id, 0 if none is open
+				std::vector<OpenElement>					stack_;
+
+				ParseLimits									limits_;
+				ParseLimit									tripped_;
+				size_t										nodes_;
+				size_t										bytes_;
+
+			public:
+				ParseContext() : reserved_(0), next_id_(0), tripped_(LIMIT_NONE), nodes_(0), bytes_(0) {}
+				~ParseContext() {}
+
+				/**
+				 * @brief the context that the root element of a parse picks up,
+				 * set by the parser for the duration of the parse on this thread
+				 */
+				static ParseContext*& active() {
+					static thread_local ParseContext* context = NULL;
+					return context;
+				}
+
+				class Scope {
+					private:
+						ParseContext*						previous_;
+
+					public:
+						Scope(ParseContext* context) : previous_(active()) { active() = context; }
+						~Scope() { active() = previous_; }
+				};
+
+				/**
+				 * @brief forget the previous document, the limits are kept
+				 */
+				void reset() {
+					ids_.clear();
+					next_id_ = reserved_;
+					innermost_.assign(reserved_, 0);
+					stack_.clear();
+					tripped_ = LIMIT_NONE;
+					nodes_ = 0;
+					bytes_ = 0;
+				}
+
+				void limits(const ParseLimits& limits) { limits_ = limits; }
+				const ParseLimits& limits() const { return limits_; }
+
+				/**
+				 * @return the limit that stopped the parse, LIMIT_NONE if the
+				 * document was parsed completely
+				 */
+				ParseLimit tripped() const { return tripped_; }
+				bool stopped() const { return tripped_ != LIMIT_NONE; }
+
+				void trip(ParseLimit limit) {
+					if (tripped_ == LIMIT_NONE)
+						tripped_ = limit;
+				}
+
+				/**
+				 * @brief count a new node of the given size
+				 *
+				 * @return false if the node would go over a limit, it shouldn't
+				 * be added to the tree then
+				 */
+				bool add_node(size_t bytes) {
+					if (stopped())
+						return false;
+					if (limits_.max_nodes > 0 && nodes_ >= limits_.max_nodes)
+						trip(LIMIT_NODES);
+					else
+						add_bytes(bytes);
+					if (stopped())
+						return false;
+					++nodes_;
+					return true;
+				}
+
+				bool add_bytes(size_t bytes) {
+					bytes_ += bytes;
+					if (limits_.max_bytes > 0 && bytes_ > limits_.max_bytes)
+						trip(LIMIT_BYTES);
+					return !stopped();
+				}
+
+				bool check_attributes(size_t count) {
+					if (limits_.max_attributes > 0 && count > limits_.max_attributes)
+						trip(LIMIT_ATTRIBUTES);
+					return !stopped();
+				}
+
+				size_t nodes() const { return nodes_; }
+				size_t bytes() const { return bytes_; }
+
+				/**
+				 * @brief keep the ids below count for the caller's own names, it
+				 * has to be called before any name is interned
+				 */
+				void reserve(int count) {
+					if (count <= reserved_)
+						return;
+					assert(ids_.empty());
+					reserved_ = next_id_ = count;
+					if (innermost_.size() < (size_t) count)
+						innermost_.resize(count, 0);
+				}
+
+				/**
+				 * @return the id of the name, a new one if it hasn't been seen
+				 */
+				int intern(const StringT& name) {
+					typename id_map::iterator it = ids_.find(name);
+					if (it != ids_.end())
+						return it->second;
+
+					int id = next_id_++;
+					ids_.insert(std::make_pair(name, id));
+					return id;
+				}
+
+				/**
+				 * @return the id of the name, or NO_ID if no element of that
+				 * name has been opened
+				 */
+				int find(const StringT& name) const {
+					typename id_map::const_iterator it = ids_.find(name);
+					return it != ids_.end() ? it->second : (int) NO_ID;
+				}
+
+				/**
+				 * @return the id of the opened element, or NO_ID if it would be
+				 * nested too deep
+				 */
+				int open(int id) {
+					if (id < 0)
+						return NO_ID;
+					if (limits_.max_depth > 0 && stack_.size() >= limits_.max_depth) {
+						trip(LIMIT_DEPTH);
+						return NO_ID;
+					}
+
+					if (innermost_.size() <= (size_t) id)
+						innermost_.resize(id + 1, 0);
+					OpenElement element = { id, innermost_[id] };
+					stack_.push_back(element);
+					innermost_[id] = stack_.size();
+					return id;
+				}
+
+				void close(int id) {
+					assert(!stack_.empty() && stack_.back().id == id);
+					innermost_[id] = stack_.back().previous;
+					stack_.pop_back();
+				}
+
+				/**
+				 * @return the depth of the innermost open element with the id, 1
+				 * for the outermost element, or 0 if none is open
+				 */
+				size_t innermost(int id) const {
+					return (id >= 0 && (size_t) id < innermost_.size()) ? innermost_[id] : 0;
+				}
+
+				bool is_open(int id) const {
+					return innermost(id) > 0;
+				}
+
+				/**
+				 * @return the id of the innermost open element, or NO_ID
+				 */
+				int current() const {
+					return stack_.empty() ? (int) NO_ID : stack_.back().id;
+				}
+
+				size_t depth() const { return stack_.size(); }
+		};
+	}
+}
+
+#endif /* STPL_XML_CONTEXT_H_ */
@@ -27,8 +27,10 @@
 #include <list>
 
 #include "stpl_xml_basic.h"
+#include "stpl_xml_context.h"
 #include "../stpl_property.h"
 #include "../lang/stpl_character.h"
+#include "../../utils/xml.h"
 
 
 namespace stpl {
@@ -42,7 +44,19 @@ namespace stpl {
 				typedef IteratorT	iterator;
 
 			private:
-				void init() { this->type_ = TEXT; }
+				/**
+				 * set while lexing when the text has an '&', only such a text
+				 * gets a decoded copy
+				 */
+				bool			needs_decoding_;
+				bool			decoded_ready_;
+				std::string		decoded_;
+
+				void init() {
+					this->type_ = TEXT;
+					needs_decoding_ = false;
+					decoded_ready_ = false;
+				}
 
 			public:
 				Text() : BasicXmlEntity<StringT, IteratorT>::BasicXmlEntity() { init(); }
@@ -57,15 +71,42 @@ namespace stpl {
 				}
 				virtual ~Text() {}
 
+				bool needs_decoding() const { return needs_decoding_; }
+
+				/**
+				 * @brief the text with the predefined entities and the character
+				 * references decoded, on the first call; a text without any is
+				 * returned as it is
+				 */
+				StringT decoded() {
+					if (!needs_decoding_ || this->begin() == this->end())
+						return this->to_string();
+					if (!decoded_ready_) {
+						const char* begin = &*this->begin();
+						const char* end = begin + (this->end() - this->begin());
+						decoded_.clear();
+						decoded_.reserve(end - begin);
+						utils::decode_xml(begin, end, decoded_);
+						decoded_ready_ = true;
+					}
+					return StringT(decoded_.begin(), decoded_.end());
+				}
+
 			protected:
 				virtual bool is_start(IteratorT& it) {
 					this->skip_whitespace(it);
 					this->begin(it);
+					needs_decoding_ = false;
+					decoded_ready_ = false;
 					return true;
 				}
 
 				virtual bool is_end(IteratorT& it) {
-					return this->eow(it) || text_stop(it);
+					if (this->eow(it) || text_stop(it))
+						return true;
+					if (*it == '&')
+						needs_decoding_ = true;
+					return false;
 				}
 
 				virtual bool text_stop(IteratorT next) {
@@ -95,27 +136,44 @@ namespace stpl {
 				attributes_type attributes_;
 
 			private:
+				enum { ID_UNSET = -2 };
+
 				StringBound<StringT, IteratorT> name_;
+				int								id_;	/// the id of the name in the parse context
 
 			public:
-				ElemTag() : XmlKeyword<StringT, IteratorT>::XmlKeyword() {}
-				ElemTag(IteratorT it) : XmlKeyword<StringT, IteratorT>::XmlKeyword(it), name_(it, it)  {
+				ElemTag() : XmlKeyword<StringT, IteratorT>::XmlKeyword(), id_(ID_UNSET) {}
+				ElemTag(IteratorT it) : XmlKeyword<StringT, IteratorT>::XmlKeyword(it), name_(it, it), id_(ID_UNSET)  {
 					init();
 				}
 				ElemTag(IteratorT begin, IteratorT end) :
-					 XmlKeyword<StringT, IteratorT>::XmlKeyword(begin, end), name_(begin, begin) { init(); }
+					 XmlKeyword<StringT, IteratorT>::XmlKeyword(begin, end), name_(begin, begin), id_(ID_UNSET) { init(); }
 				//ElemTag(StringT content) {
 				//	XmlKeyword<StringT, IteratorT>::XmlKeyword(content);
 				//	init();
 				//}
 				ElemTag(StringT content) :
-					XmlKeyword<StringT, IteratorT>::XmlKeyword(content) {
+					XmlKeyword<StringT, IteratorT>::XmlKeyword(content), id_(ID_UNSET) {
 					init();
 				}
 				virtual ~ElemTag() {
 					clear();
 				};
 
+				/**
+				 * @brief the id of the tag name in the parse context, looked up
+				 * once per tag; a start tag interns its name, an end tag only
+				 * finds it, so a stray one gets NO_ID
+				 */
+				template <typename ContextT>
+				int id(ContextT& context) {
+					if (id_ == ID_UNSET) {
+						StringT name(this->name().begin(), this->name().end());
+						id_ = this->is_end_xml_keyword() ? context.find(name) : context.intern(name);
+					}
+					return id_;
+				}
+
 				ElemTag& operator= (ElemTag& elem_k) {
 					this->clone(reinterpret_cast<XmlKeyword<StringT, IteratorT>*>(&elem_k));
 					return *this;
@@ -131,6 +189,22 @@ namespace stpl {
 					return *this;
 				}
 
+				size_t attribute_count() const {
+					return attributes_.size();
+				}
+
+				/**
+				 * @brief an estimate of the memory held by the attributes, the
+				 * names are copied out of the input as the map keys
+				 */
+				size_t attribute_bytes() const {
+					size_t bytes = 0;
+					typename attributes_type::const_iterator it = attributes_.begin();
+					for (; it != attributes_.end(); ++it)
+						bytes += sizeof(AttributeT) + sizeof(*it) + it->first.length();
+					return bytes;
+				}
+
 				bool has_attribute(const StringT attr) const {
 					return this->attributes_.find(attr) != this->attributes_.end();
 				}
@@ -522,6 +596,7 @@ namespace stpl {
 					typename container_type::container_entity_type
 							>													tree_type;
 				typedef typename std::map<StringT, bool>						ie_map; /// include or exclude map
+				typedef ParseContext<StringT>									context_type;
 
 			protected:
 				typedef StringBound<StringT, IteratorT> 						StringB;
@@ -534,11 +609,22 @@ namespace stpl {
 				//Element* parent_;
 				StringT															xpath_;
 
+				context_type*													context_;
+				bool															owns_context_;
+				bool															opened_;
+				int																open_id_;
+				size_t															open_depth_;	/// 1 for the outermost open element
+
 			private:
 				void init() {
 					last_tag_ptr_ = NULL;
 					start_k_ = NULL;
 					end_k_ = NULL;
+					context_ = NULL;
+					owns_context_ = false;
+					opened_ = false;
+					open_id_ = context_type::NO_ID;
+					open_depth_ = 0;
 					body_.begin(this->begin());
 					body_.end(this->begin());
 					this->type(TAG);
@@ -550,6 +636,8 @@ namespace stpl {
 					if (end_k_)
 						delete end_k_;
 					cleanup_last_tag();
+					if (owns_context_)
+						delete context_;
 				}
 
 				void cleanup_last_tag() {
@@ -594,6 +682,34 @@ namespace stpl {
 					last_tag_ptr_ = last_tag_ptr;
 				}
 
+				/**
+				 * @brief share the parse context of the parent, the root element
+				 * creates its own one when it is first needed
+				 */
+				void set_context(context_type* context) {
+					context_ = context;
+				}
+
+				context_type* context() {
+					if (!context_ && (context_ = context_type::active()) == NULL) {
+						context_ = new context_type();
+						owns_context_ = true;
+					}
+					return context_;
+				}
+
+				/**
+				 * @brief take the element off the open element stack, it is
+				 * called by the parent as soon as the child has been matched
+				 */
+				void pop_open() {
+					if (open_id_ != context_type::NO_ID) {
+						context()->close(open_id_);
+						open_id_ = context_type::NO_ID;
+						open_depth_ = 0;
+					}
+				}
+
 				std::pair<bool, StringT> attribute(const StringT attr) const {
 					if (start_k_)
 						return start_k_->attribute(attr);
@@ -661,13 +777,62 @@ namespace stpl {
 				}
 
 			protected:
+				/**
+				 * @brief put the element on the open element stack once its
+				 * start tag is known, unless it is closed by the start tag itself
+				 */
+				void push_open() {
+					opened_ = true;
+					if (!start_k_)
+						return;
+
+					context_type* context = this->context();
+					if (!context->check_attributes(start_k_->attribute_count())
+							|| !context->add_bytes(start_k_->attribute_bytes()))
+						return;
+
+					if (!start_k_->is_ended_xml_keyword() && !start_k_->is_end_xml_keyword()) {
+						open_id_ = context->open(start_k_->id(*context));
+						if (open_id_ != context_type::NO_ID)
+							open_depth_ = context->depth();
+					}
+				}
+
+				/**
+				 * @brief end the element where the parse is when a limit trips,
+				 * the root takes the rest of the input so nothing more is scanned
+				 */
+				bool stop(IteratorT& it) {
+					cleanup_last_tag();
+					if (!this->parent() || !this->parent()->is_element())
+						it = this->end();
+					body_.end(it);
+					this->end(it);
+					return true;
+				}
+
+				int tag_id(ElemTagT* tag) {
+					return tag->id(*context());
+				}
+
+				/**
+				 * @brief an end tag that matches none of the open elements
+				 *
+				 * It is dropped where it is found, rather than being handed up to
+				 * the root and back which is quadratic on a page full of them.
+				 */
+				bool is_stray_end_tag() {
+					return last_tag_ptr_->is_end_xml_keyword() && start_k_
+							&& !context()->is_open(tag_id(last_tag_ptr_));
+				}
+
 				virtual bool is_last_tag_end_tag() {
 					if (last_tag_ptr_/*&& last_tag_ptr_->length() > 0*/) {
 						if (last_tag_ptr_->is_end_xml_keyword()) {
 							if (start_k_) {
-								StringT	last_tag_name(last_tag_ptr_->name().begin(), last_tag_ptr_->name().end());
-								StringT start_k_name(start_k_->name().begin(), start_k_->name().end());
-								if (last_tag_name == start_k_name) {
+								// the depth of the innermost open element the end tag closes
+								size_t depth = context()->innermost(tag_id(last_tag_ptr_));
+								if (open_id_ != context_type::NO_ID && depth == open_depth_) {
 									// TODO assert elem_k is closed elem
 									end_k_ = last_tag_ptr_;
 									last_tag_ptr_ = NULL;
@@ -678,6 +843,9 @@ namespace stpl {
 								} else {
 									// TODO error message here for XML
 									// but could be alright for html
+									// the end tag closes an ancestor, which is known to be open;
+									// every element up to its depth ends where the end tag starts,
+									// each with one lookup of the cached id
 									if (this->parent() && this->parent()->is_element()) {
 										reinterpret_cast<Element*>(this->parent())->set_last_tag(last_tag_ptr_);
 										IteratorT end = last_tag_ptr_->begin();
@@ -758,6 +926,12 @@ namespace stpl {
 
 				virtual bool is_end(IteratorT& it) {
 					bool ret = false;
+					if (!opened_)
+						push_open();
+
+					if (context()->stopped())
+						return stop(it);
+
 					if (start_k_) {
 						if (start_k_->is_ended_xml_keyword())
 							ret = true;
@@ -776,6 +950,8 @@ namespace stpl {
 
 					if (!last_tag_ptr_) {
 						match_text(it);
+						if (context()->stopped())
+							return stop(it);
 						//IteratorT end = this->end();
 
 						// if it is the end of character stream
@@ -790,6 +966,15 @@ namespace stpl {
 						// cleanup_last_tag();
 						// skip non valid char or get next tag
 						skip_invalid_chars(it);
+						if (context()->stopped())
+							return stop(it);
+					}
+
+					if (last_tag_ptr_ && is_stray_end_tag()) {
+						it = last_tag_ptr_->end();
+						cleanup_last_tag();
+						--it;
+						return false;
 					}
 
 					if (!last_tag_ptr_ || is_last_tag_end_tag()) {
@@ -799,16 +984,22 @@ namespace stpl {
 
  					assert(last_tag_ptr_);
 
+					if (!context()->add_node(sizeof(Element)))
+						return stop(it);
+
 					IteratorT end = this->end();
 					IteratorT begin = last_tag_ptr_->begin();
 					IteratorT new_begin = last_tag_ptr_->end();
  					Element* child = new Element(begin, end);
 					child->set_parent(reinterpret_cast<basic_entity* >(this));
+					child->set_context(context());
 					child->set_start_keyword(last_tag_ptr_);
 					child->content().begin(last_tag_ptr_->end());
 					last_tag_ptr_ = NULL;
 
-					if (child->resume_match(new_begin, end) && child->length() > 0) {
+					IteratorT matched = child->resume_match(new_begin, end);
+					child->pop_open();
+					if (matched && child->length() > 0) {
 						this->add(child);
 
 						//if (last_tag_ptr_ && is_last_tag_end_tag()) {
@@ -900,6 +1091,11 @@ namespace stpl {
 					if (keyword_ptr->detect(begin)) {
 						//begin = keyword_ptr->end();
 						IteratorT new_begin = keyword_ptr->content().begin();
+						if (keyword_ptr->type() != TEXT && !this->context()->add_node(sizeof(comment_type))) {
+							delete keyword_ptr;
+							return false;
+						}
+
 						if (keyword_ptr->type() == COMMENT) {
 							comment_type* node_ptr = new comment_type(orig_begin, end);
 							node_ptr->set_parent(reinterpret_cast<basic_entity* >(this));
@@ -942,7 +1138,7 @@ namespace stpl {
 					IteratorT end = this->end();
 					TextT* text = new TextT(next, end);
 					text->set_parent(reinterpret_cast<basic_entity* >(this));
-					if (text->match(next, end))	{
+					if (text->match(next, end) && context()->add_node(sizeof(TextT)))	{
 						this->add(reinterpret_cast<basic_entity*>(text));
 						next = text->end();
 					}
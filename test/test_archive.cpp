@@ -0,0 +1,187 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../utils/archive.h"
+
+using namespace std;
+using namespace ARCHIVE;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void check(long long got, long long expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": " << got << " instead of " << expected << endl;
+		++failures;
+	}
+}
+
+struct File {
+	string		name;
+	string		content;
+	bool		directory;
+};
+
+/**
+ * write the files into a tar.gz
+ */
+static bool write_archive(const string& filename, const vector<File>& files) {
+	struct archive* a = archive_write_new();
+	archive_write_add_filter_gzip(a);
+	archive_write_set_format_pax_restricted(a);
+	if (archive_write_open_filename(a, filename.c_str()) != ARCHIVE_OK) {
+		archive_write_free(a);
+		return false;
+	}
+
+	for (size_t i = 0; i < files.size(); ++i) {
+		struct archive_entry* entry = archive_entry_new();
+		archive_entry_set_pathname(entry, files[i].name.c_str());
+		archive_entry_set_filetype(entry, files[i].directory ? AE_IFDIR : AE_IFREG);
+		archive_entry_set_perm(entry, 0644);
+		archive_entry_set_size(entry, files[i].content.length());
+		archive_write_header(a, entry);
+		if (!files[i].content.empty())
+			archive_write_data(a, files[i].content.data(), files[i].content.length());
+		archive_entry_free(entry);
+	}
+	archive_write_close(a);
+	archive_write_free(a);
+	return true;
+}
+
+/**
+ * the names of the entries from the current one on
+ */
+static string names(TgzArchive& ar) {
+	string out;
+	for (Archive::iterator it = ar.begin(); it != ar.end(); ++it)
+		out += (out.empty() ? "" : " ") + it->pathname;
+	return out;
+}
+
+int main(int argc, char* argv[])
+{
+	// a file of several blocks, so it takes more than one read_block()
+	string large;
+	for (int i = 0; large.length() < 100000; ++i)
+		large += to_string(i) + "\n";
+
+	vector<File> files;
+	files.push_back(File { "shard", "", true });
+	files.push_back(File { "shard/a.txt", "first", false });
+	files.push_back(File { "shard/empty.txt", "", false });
+	files.push_back(File { "shard/large.txt", large, false });
+	files.push_back(File { "shard/b.txt", "second", false });
+
+	char dir_template[] = "/tmp/test_archive.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	string filename = dir + "/shard.tar.gz";
+	if (!write_archive(filename, files)) {
+		cerr << "unable to write " << filename << endl;
+		return 1;
+	}
+
+	const string ALL = "shard/ shard/a.txt shard/empty.txt shard/large.txt shard/b.txt";
+	TgzArchive ar;
+	check(ar.open(dir + "/missing.tar.gz") == ARCHIVE_OK ? "opened" : "failed", "failed", "opening a missing file");
+	check(ar.open(filename), ARCHIVE_OK, "opening the archive after a failure");
+
+	// the headers, and the content read block by block, with a temporary consumer and into a string
+	check(ar.next(), ARCHIVE_OK, "the first header");
+	check(ar.entry().pathname, "shard/", "the directory entry");
+	check(ar.entry().regular ? "regular" : "not regular", "not regular", "the type of a directory");
+
+	check(ar.next(), ARCHIVE_OK, "the second header");
+	check(ar.entry().size, 5, "the size of an entry");
+	string content;
+	check(ar.read([&content](const char* data, size_t size) { content.append(data, size); }), ARCHIVE_OK, "reading with a lambda");
+	check(content, "first", "the content read with a lambda");
+
+	ar.next();
+	check(ar.read(content), ARCHIVE_OK, "reading an empty entry");
+	check(content, "", "the content of an empty entry");
+
+	ar.next();
+	check(ar.entry().basename(), "large.txt", "the base name of an entry");
+	const char* data;
+	size_t size;
+	int64_t offset;
+	int blocks = 0;
+	content.clear();
+	while (ar.read_block(data, size, offset) == ARCHIVE_OK) {
+		check(offset, content.length(), "the offset of a block");
+		content.append(data, size);
+		++blocks;
+	}
+	check(ar.status(), ARCHIVE_EOF, "the status after the last block");
+	check(content == large ? "same" : "different", "same", "the content read block by block");
+	check(blocks > 1 ? "several" : "one", "several", "the number of blocks of a large entry");
+
+	// a loop after next() starts at the current entry instead of skipping it
+	check(names(ar), "shard/large.txt shard/b.txt", "the entries from the current one on");
+	check(names(ar), "", "a loop over a consumed archive");
+
+	// the archive opened again starts over, after a close too
+	check(ar.open(filename), ARCHIVE_OK, "opening the archive again");
+	check(names(ar), ALL, "the entries after opening again");
+	ar.close();
+	check(ar.open(filename), ARCHIVE_OK, "opening the archive after a close");
+	ar.next();
+	check(names(ar), ALL, "the entries after next()");
+
+	// skipping an entry, then finding one
+	ar.open(filename);
+	ar.next();
+	ar.next();
+	check(ar.skip(), ARCHIVE_OK, "skipping an entry");
+	check(ar.next(), ARCHIVE_OK, "the header after a skipped entry");
+	check(ar.entry().basename(), "empty.txt", "the entry after a skipped one");
+	Archive::result_type found = ar.find("b.txt");
+	check(found.first ? found.second : "not found", "second", "finding an entry");
+	ar.open(filename);
+	found = ar.find("missing.txt");
+	check(found.first ? "found" : "not found", "not found", "finding a missing entry");
+	check(ar.status(), ARCHIVE_EOF, "the status after a missing entry");
+
+	ar.close();
+	unlink(filename.c_str());
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "archive entries read" << endl;
+	return failures == 0 ? 0 : 1;
+}
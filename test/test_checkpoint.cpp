@@ -0,0 +1,198 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+#include <iostream>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <bzlib.h>
+
+#include "../utils/checkpoint.h"
+#include "../stpl/wiki/stpl_wiki_dump.h"
+
+using namespace std;
+using namespace stpl::WIKI;
+
+static int failures = 0;
+
+static void check(bool ok, const string& what) {
+	if (!ok) {
+		cerr << what << endl;
+		++failures;
+	}
+}
+
+static string read_file(const string& filename) {
+	string content;
+	FILE* fp = fopen(filename.c_str(), "r");
+	if (!fp)
+		return content;
+	char buffer[4096];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+		content.append(buffer, n);
+	fclose(fp);
+	return content;
+}
+
+static void write_file(const string& filename, const string& content) {
+	FILE* fp = fopen(filename.c_str(), "w");
+	fwrite(content.data(), 1, content.length(), fp);
+	fclose(fp);
+}
+
+/**
+ * the content compressed as one bz2 stream
+ */
+static string compress(const string& content) {
+	unsigned int length = content.length() + content.length() / 100 + 600;
+	string out(length, '\0');
+	if (BZ2_bzBuffToBuffCompress(&out[0], &length, const_cast<char*>(content.data()), content.length(), 9, 0, 0) != BZ_OK)
+		return "";
+	out.resize(length);
+	return out;
+}
+
+/**
+ * a conversion of the pages of the dump into one line each, a checkpoint is
+ * saved after every interval pages and the run stops after stop pages as if
+ * it was killed
+ */
+static void convert(const string& dump, const string& output, const string& checkpoint_file, int interval, int stop) {
+	utils::Checkpoint checkpoint(checkpoint_file);
+	WikiDumpReader reader;
+	check(reader.open(dump) == WikiDumpReader::DUMP_OK, "unable to open the dump");
+
+	int ret = checkpoint.load();
+	check(ret != utils::Checkpoint::CHECKPOINT_ERROR, "invalid checkpoint");
+	if (ret == utils::Checkpoint::CHECKPOINT_OK) {
+		check(reader.seek(checkpoint.input(dump), checkpoint.stream(dump)) == WikiDumpReader::DUMP_OK, "unable to seek the dump");
+		check(reader.stream() == checkpoint.stream(dump) && reader.stream_offset() == checkpoint.input(dump),
+				"the reader is not at the position of the checkpoint");
+		check(checkpoint.restore_outputs() == utils::Checkpoint::CHECKPOINT_OK, "unable to restore the output");
+	}
+	else
+		unlink(output.c_str());
+
+	FILE* fp = fopen(output.c_str(), "a");
+	WikiPage page;
+	long long records = checkpoint.records();
+	while (reader.next(page)) {
+		fprintf(fp, "%lld\t%s\n", page.id, page.title.c_str());
+		if (++records == stop)
+			break;
+		if (records % interval == 0) {
+			fflush(fp);
+			checkpoint.records(records);
+			checkpoint.input(dump, reader.stream_offset());
+			checkpoint.stream(dump, reader.stream());
+			checkpoint.clear_outputs();
+			checkpoint.output(output, ftell(fp));
+			check(checkpoint.save() == utils::Checkpoint::CHECKPOINT_OK, "unable to save the checkpoint");
+		}
+	}
+	fclose(fp);
+}
+
+int main(int argc, char* argv[])
+{
+	char dir_template[] = "/tmp/test_checkpoint.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	string dump = dir + "/dump.xml", output = dir + "/out.tsv", checkpoint_file = dir + "/ck";
+	string multistream = dir + "/dump.xml.bz2";
+
+	// the multistream dump has the header in a stream and two pages in each of the others
+	string xml = "<mediawiki>\n";
+	string streams = compress(xml), pages;
+	for (int i = 1; i <= 7; ++i) {
+		char page[256];
+		snprintf(page, sizeof(page), "  <page>\n    <title>Page %d</title>\n    <ns>0</ns>\n    <id>%d</id>\n"
+				"    <revision><text>text of page %d</text></revision>\n  </page>\n", i, i, i);
+		xml += page;
+		pages += page;
+		if (i % 2 == 0 || i == 7) {
+			streams += compress(pages);
+			pages.clear();
+		}
+	}
+	xml += "</mediawiki>\n";
+	streams += compress("</mediawiki>\n");
+	write_file(dump, xml);
+	write_file(multistream, streams);
+
+	// save and load
+	utils::Checkpoint saved(checkpoint_file);
+	check(saved.load() == utils::Checkpoint::CHECKPOINT_NONE, "a missing checkpoint is not CHECKPOINT_NONE");
+	saved.records(42);
+	saved.input("in put", 1234567890123LL);
+	saved.output(output, 17);
+	check(saved.save() == utils::Checkpoint::CHECKPOINT_OK, "unable to save the checkpoint");
+	utils::Checkpoint loaded(checkpoint_file);
+	check(loaded.load() == utils::Checkpoint::CHECKPOINT_OK, "unable to load the checkpoint");
+	check(loaded.records() == 42 && loaded.input("in put") == 1234567890123LL && loaded.output(output) == 17,
+			"the checkpoint loaded is not the one saved");
+	check(access((checkpoint_file + ".tmp").c_str(), F_OK) != 0, "the temporary file is left behind");
+
+	// restore_outputs() cuts the output back
+	write_file(output, string(40, 'x'));
+	check(loaded.restore_outputs() == utils::Checkpoint::CHECKPOINT_OK && read_file(output) == string(17, 'x'),
+			"the output is not cut back to its checkpoint size");
+
+	write_file(checkpoint_file, "records 1\n");
+	check(loaded.load() == utils::Checkpoint::CHECKPOINT_ERROR, "a damaged checkpoint is not CHECKPOINT_ERROR");
+
+	// a conversion killed after five pages resumes from the second checkpoint
+	unlink(checkpoint_file.c_str());
+	convert(dump, output, checkpoint_file, 7, -1);
+	string expected = read_file(output);
+	check(expected.find("7\tPage 7\n") != string::npos, "the pages are not all converted");
+
+	unlink(checkpoint_file.c_str());
+	convert(dump, output, checkpoint_file, 2, 5);
+	check(read_file(output).find("5\tPage 5\n") != string::npos, "the run is not stopped after five pages");
+	convert(dump, output, checkpoint_file, 2, -1);
+	check(read_file(output) == expected, "the resumed conversion differs from one straight run:\n" + read_file(output));
+
+	// the same with the multistream dump, resumed from the stream of the checkpoint
+	unlink(checkpoint_file.c_str());
+	convert(multistream, output, checkpoint_file, 7, -1);
+	check(read_file(output) == expected, "the multistream dump differs from the plain one:\n" + read_file(output));
+
+	unlink(checkpoint_file.c_str());
+	convert(multistream, output, checkpoint_file, 2, 5);
+	check(loaded.load() == utils::Checkpoint::CHECKPOINT_OK && loaded.stream(multistream) > 0,
+			"the checkpoint of the multistream dump is not in a later stream");
+	convert(multistream, output, checkpoint_file, 2, -1);
+	check(read_file(output) == expected, "the resumed multistream conversion differs from one straight run:\n" + read_file(output));
+
+	unlink(dump.c_str());
+	unlink(multistream.c_str());
+	unlink(output.c_str());
+	unlink(checkpoint_file.c_str());
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "checkpoints saved, loaded and resumed from" << endl;
+	return failures == 0 ? 0 : 1;
+}
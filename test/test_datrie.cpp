@@ -0,0 +1,169 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../utils/datrie.h"
+#include "../stpl/lang/stpl_chinese_convert.h"
+#include "../stpl/wiki/stpl_wiki_variant.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void write_file(const string& filename, const string& content) {
+	FILE* fp = fopen(filename.c_str(), "w");
+	fwrite(content.data(), 1, content.length(), fp);
+	fclose(fp);
+}
+
+/**
+ * a few bytes only, so the keys share their prefixes; the last one is the
+ * first byte of a two byte character
+ */
+static string random_string(size_t max_length) {
+	static const char BYTES[] = { 'a', 'b', 'c', '\xe4', '\xb8' };
+	string s;
+	size_t length = rand() % max_length + 1;
+	for (size_t i = 0; i < length; ++i)
+		s += BYTES[rand() % sizeof(BYTES)];
+	return s;
+}
+
+/**
+ * the longest key [begin, end) starts with, the slow way
+ */
+static int32_t naive_longest_match(const map<string, int32_t>& keys, const char* begin, const char* end, size_t& length) {
+	int32_t found = utils::DoubleArrayTrie::NO_VALUE;
+	for (size_t n = 1; n <= (size_t) (end - begin); ++n) {
+		map<string, int32_t>::const_iterator it = keys.find(string(begin, n));
+		if (it != keys.end()) {
+			found = it->second;
+			length = n;
+		}
+	}
+	return found;
+}
+
+static void test_longest_match() {
+	srand(20211);
+	for (int round = 0; round < 50; ++round) {
+		vector<utils::DoubleArrayTrie::entry_type> entries;
+		map<string, int32_t> keys;
+		size_t count = rand() % 300 + 1;
+		for (size_t i = 0; i < count; ++i) {
+			// a key given again now and then, the last value is kept
+			string key = (!entries.empty() && rand() % 8 == 0) ? entries[rand() % entries.size()].first : random_string(6);
+			int32_t value = (int32_t) i;
+			entries.push_back(utils::DoubleArrayTrie::entry_type(key, value));
+			keys[key] = value;
+		}
+
+		utils::DoubleArrayTrie trie;
+		trie.build(entries);
+		if (trie.size() != keys.size()) {
+			cerr << "the trie has " << trie.size() << " keys instead of " << keys.size() << endl;
+			++failures;
+		}
+
+		for (int i = 0; i < 500; ++i) {
+			string text = random_string(10);
+			const char* begin = text.data();
+			const char* end = begin + text.length();
+			size_t length = 0, expected_length = 0;
+			int32_t value = trie.longest_match(begin, end, length);
+			int32_t expected = naive_longest_match(keys, begin, end, expected_length);
+			if (value != expected || length != expected_length) {
+				cerr << "the longest match of \"" << text << "\" is " << value << " of " << length
+						<< " bytes instead of " << expected << " of " << expected_length << endl;
+				++failures;
+				return;
+			}
+		}
+	}
+
+	utils::DoubleArrayTrie empty;
+	empty.build(vector<utils::DoubleArrayTrie::entry_type>());
+	size_t length = 0;
+	if (empty.longest_match("abc", "abc" + 3, length) != utils::DoubleArrayTrie::NO_VALUE) {
+		cerr << "an empty trie matches" << endl;
+		++failures;
+	}
+}
+
+static void test_tables(const string& dir) {
+	// the second table of a variant overrides the first one
+	string first = dir + "/zh2Hant.txt";
+	string second = dir + "/zh2TW.txt";
+	write_file(first, "# a comment\n软件\t軟件\n网络\t網絡 網路\n");
+	write_file(second, "软件\t軟體\n");
+
+	UNICODE::ChineseConverter converter;
+	if (converter.load(UNICODE::ZH_TW, first) != UNICODE::ChineseConverter::CONVERTER_OK
+			|| converter.load(UNICODE::ZH_TW, second) != UNICODE::ChineseConverter::CONVERTER_OK) {
+		cerr << "the tables are not loaded" << endl;
+		++failures;
+		return;
+	}
+	check(converter.convert("软件和网络", UNICODE::ZH_TW), "軟體和網絡", "the later table taking precedence");
+	check(converter.convert("软件", UNICODE::ZH_HANS), "软件", "a variant without a table");
+
+	// the rules of the page win over a table match as long, not a longer one
+	converter.table(UNICODE::ZH_TW).add("软件包", "套件");
+	converter.table(UNICODE::ZH_TW).build();
+	WIKI::WikiVariantConverter page(converter, UNICODE::ZH_TW);
+	check(page.convert("软件-{H|zh-hans:软件;zh-tw:软体;}-和软件"), "软体和软体", "a rule winning over a table");
+	check(page.convert("-{H|zh-hans:软件;zh-tw:软体;}-软件包"), "套件", "a longer table match winning over a rule");
+	check(page.convert("软件"), "軟體", "the rules of the previous page dropped");
+	check(page.convert("-{软件}-和-{zh-hans:网络;zh-tw:网路;}-"), "软件和网路", "the text of the blocks");
+
+	unlink(first.c_str());
+	unlink(second.c_str());
+}
+
+int main(int argc, char* argv[])
+{
+	test_longest_match();
+
+	char dir_template[] = "/tmp/test_datrie.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	test_tables(dir);
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "longest matches and conversion precedence checked" << endl;
+	return failures == 0 ? 0 : 1;
+}
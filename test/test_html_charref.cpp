@@ -0,0 +1,62 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#include <iostream>
+#include <string>
+
+#include "../stpl/html/stpl_html_charref.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& input, const string& expected, bool in_attribute = false) {
+	string output = HTML::CharRef::decode(input, in_attribute);
+	if (output != expected) {
+		cerr << "decoding \"" << input << "\" gave \"" << output
+				<< "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	check("no references here", "no references here");
+	check("fish &amp; chips", "fish & chips");
+	check("&lt;p&gt;", "<p>");
+	check("a&nbsp;b", "a\xC2\xA0" "b");
+	check("&AMP &amp", "& &");
+	check("&notin; &notit;", "\xE2\x88\x89 \xC2\xACit;");
+	check("&NotNestedGreaterGreater;", "\xE2\xAA\xA2\xCC\xB8");
+	check("&bogus; &", "&bogus; &");
+
+	check("&#x2014;&#8212;&#X2014", "\xE2\x80\x94\xE2\x80\x94\xE2\x80\x94");
+	check("&#128;", "\xE2\x82\xAC");
+	check("&#0; &#xD800; &#x110000;", "\xEF\xBF\xBD \xEF\xBF\xBD \xEF\xBF\xBD");
+	check("&#; &#x;", "&#; &#x;");
+
+	check("?a=1&copy=2&amp;b", "?a=1&copy=2&b", true);
+	check("?a=1&copy=2", "?a=1\xC2\xA9=2");
+
+	if (failures == 0)
+		cout << "all character references decoded" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../stpl/html/stpl_html_links.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+struct Links {
+	vector<HTML::Link>	links;
+
+	void operator() (const HTML::Link& link) {
+		links.push_back(link);
+	}
+};
+
+/**
+ * the examples of RFC 3986 section 5.4
+ */
+static void test_resolution() {
+	static const char* EXAMPLES[][2] = {
+		// normal examples, 5.4.1
+		{ "g:h", "g:h" },
+		{ "g", "http://a/b/c/g" },
+		{ "./g", "http://a/b/c/g" },
+		{ "g/", "http://a/b/c/g/" },
+		{ "/g", "http://a/g" },
+		{ "//g", "http://g" },
+		{ "?y", "http://a/b/c/d;p?y" },
+		{ "g?y", "http://a/b/c/g?y" },
+		{ "#s", "http://a/b/c/d;p?q#s" },
+		{ "g#s", "http://a/b/c/g#s" },
+		{ "g?y#s", "http://a/b/c/g?y#s" },
+		{ ";x", "http://a/b/c/;x" },
+		{ "g;x", "http://a/b/c/g;x" },
+		{ "g;x?y#s", "http://a/b/c/g;x?y#s" },
+		{ "", "http://a/b/c/d;p?q" },
+		{ ".", "http://a/b/c/" },
+		{ "./", "http://a/b/c/" },
+		{ "..", "http://a/b/" },
+		{ "../", "http://a/b/" },
+		{ "../g", "http://a/b/g" },
+		{ "../..", "http://a/" },
+		{ "../../", "http://a/" },
+		{ "../../g", "http://a/g" },
+		// abnormal examples, 5.4.2
+		{ "../../../g", "http://a/g" },
+		{ "../../../../g", "http://a/g" },
+		{ "/./g", "http://a/g" },
+		{ "/../g", "http://a/g" },
+		{ "g.", "http://a/b/c/g." },
+		{ ".g", "http://a/b/c/.g" },
+		{ "g..", "http://a/b/c/g.." },
+		{ "..g", "http://a/b/c/..g" },
+		{ "./../g", "http://a/b/g" },
+		{ "./g/.", "http://a/b/c/g/" },
+		{ "g/./h", "http://a/b/c/g/h" },
+		{ "g/../h", "http://a/b/c/h" },
+		{ "g;x=1/./y", "http://a/b/c/g;x=1/y" },
+		{ "g;x=1/../y", "http://a/b/c/y" },
+		{ "g?y/./x", "http://a/b/c/g?y/./x" },
+		{ "g?y/../x", "http://a/b/c/g?y/../x" },
+		{ "g#s/./x", "http://a/b/c/g#s/./x" },
+		{ "g#s/../x", "http://a/b/c/g#s/../x" },
+		{ "http:g", "http:g" }
+	};
+
+	utils::Url base("http://a/b/c/d;p?q");
+	for (size_t i = 0; i < sizeof(EXAMPLES) / sizeof(EXAMPLES[0]); ++i)
+		check(base.resolve(EXAMPLES[i][0]), EXAMPLES[i][1], string("resolving \"") + EXAMPLES[i][0] + "\"");
+
+	utils::Url url("HTTP://example.org:80/p?q#f");
+	check(url.scheme, "http", "the scheme of a URL");
+	check(url.authority, "example.org:80", "the authority of a URL");
+	check(url.to_string(false), "http://example.org:80/p?q", "a URL without its fragment");
+	check(utils::Url("http://example.org").resolve("a"), "http://example.org/a", "a reference against an empty path");
+}
+
+static string links_of(const string& page, const string& url, bool with_fragment = false) {
+	Links links;
+	HTML::LinkExtractor<Links> extractor(links);
+	extractor.with_fragment(with_fragment);
+	size_t count = extractor.extract(page, url);
+	if (count != links.links.size()) {
+		cerr << count << " links counted but " << links.links.size() << " handed over" << endl;
+		++failures;
+	}
+
+	string out;
+	for (size_t i = 0; i < links.links.size(); ++i)
+		out += (i > 0 ? " " : "") + links.links[i].url;
+	return out;
+}
+
+static void test_links() {
+	const string url = "http://example.org/dir/page.html";
+
+	check(links_of("<a href=a.html>a</a> <A HREF='/b'>b</A> <link rel=stylesheet href=\"c.css\">"
+			"<img src=d.png> <frame src=e.html> <iframe src=f.html><a href=no>not a link</a></iframe>"
+			"<map><area shape=rect href=g.html></map>", url),
+			"http://example.org/dir/a.html http://example.org/b http://example.org/dir/c.css http://example.org/dir/d.png"
+			" http://example.org/dir/e.html http://example.org/dir/f.html http://example.org/dir/g.html",
+			"the links of the tags");
+
+	check(links_of("<script>document.write('<a href=x>')</script><style>a { }</style><!-- <a href=y> --><a href=z>", url),
+			"http://example.org/dir/z", "the markup in scripts and comments");
+	check(links_of("<a href=\" /a?x=1&amp;y=2#top \"><a href=''><a name=n><a href=#s>", url),
+			"http://example.org/a?x=1&y=2 http://example.org/dir/page.html", "the decoded and trimmed links");
+	check(links_of("<a href=a#top>", url, true), "http://example.org/dir/a#top", "a link with its fragment");
+
+	// only the first base counts, the links before it keep the page URL
+	check(links_of("<link href=s.css><base href=\"http://other.org/x/\"><base href=/ignored/><a href=../a>", url),
+			"http://example.org/dir/s.css http://other.org/a", "the links around a base");
+	check(links_of("<base href=sub/><a href=a>", url), "http://example.org/dir/sub/a", "a relative base");
+
+	Links links;
+	HTML::LinkExtractor<Links> extractor(links);
+	extractor.extract("<base href=//cdn.example.org/>", url);
+	check(extractor.base().to_string(), "http://cdn.example.org/", "the base of the page");
+
+	// the refresh URL in its forms
+	check(links_of("<meta http-equiv=refresh content=\"5; url=/next\">", url), "http://example.org/next", "a meta refresh");
+	check(links_of("<meta content=\"0;URL='later.html'\" http-equiv=\"Refresh\">", url),
+			"http://example.org/dir/later.html", "a quoted meta refresh");
+	check(links_of("<meta http-equiv=refresh content=\"3, http://example.com/\">", url), "http://example.com/",
+			"a meta refresh without url=");
+	check(links_of("<meta http-equiv=refresh content=\"10\"><meta name=refresh content=\"0; url=x\">", url), "",
+			"a meta without a refresh URL");
+
+	// the tag and the raw value come with the link
+	extractor.extract("<area href='m&amp;p.html'><iframe src=f.html></iframe>", url);
+	if (links.links.size() != 2 || links.links[0].tag != HTML::TAG_AREA || links.links[1].tag != HTML::TAG_IFRAME) {
+		cerr << "the tags of the area and iframe links" << endl;
+		++failures;
+	}
+	else
+		check(links.links[0].raw, "m&amp;p.html", "the raw value of a link");
+}
+
+int main(int argc, char* argv[])
+{
+	test_resolution();
+	test_links();
+
+	if (failures == 0)
+		cout << "links extracted and resolved" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "../stpl/html/stpl_html_text.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& page, const string& expected, bool prune = false) {
+	string output;
+	HTML::StringTextSink sink(output);
+	HTML::TextExtractorOptions options;
+	options.prune_boilerplate = prune;
+	HTML::TextExtractor<> extractor(sink, options);
+	extractor.extract(page);
+	if (output != expected) {
+		cerr << "extracting \"" << page << "\" gave \"" << output
+				<< "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// the head, scripts, styles, noscript, templates and comments
+	check("<html><head><title>t</title><meta charset=utf-8></head><body>text</body></html>", "text\n");
+	check("<head><title>t</title><p>body without a body tag", "body without a body tag\n");
+	check("a<script>var s = '<p>x</p>';</script>b<style>p { }</style>c", "abc\n");
+	check("a<noscript><p>enable scripts</p></noscript>b<template><p>t</p></template>c", "abc\n");
+	check("a<!-- <p>comment</p> -->b", "ab\n");
+
+	// title and textarea are text up to their end tag
+	check("<textarea>x<y</textarea> z", "x<y z\n");
+	check("<textarea><b>&lt;bold&gt;</b></textarea>", "<b><bold></b>\n");
+	check("<body><title>a<b</title></body>", "a<b\n");
+	check("<textarea>unclosed <p>", "unclosed <p>\n");
+
+	// blocks, references and whitespace
+	check("<p>one\n  two</p><p>three</p>", "one two\nthree\n");
+	check("<h1>Title</h1>a <b>bold</b> word<br><div>cell&nbsp;&amp;</div>", "Title\na bold word\ncell\xC2\xA0&\n");
+	check("<ul><li>x</li><li>y</li></ul>", "x\ny\n");
+
+	// link-dense and short blocks are boilerplate, headings are kept
+	check("<div><a href=a>Home</a> <a href=b>News</a> <a href=c>Contact</a></div>"
+			"<p>the article has enough words to be kept <a href=d>here</a></p>"
+			"<p>too short</p><h2>Heading</h2>",
+			"the article has enough words to be kept here\nHeading\n", true);
+	check("<div><a href=a>Home</a> <a href=b>News</a></div><p>short</p>",
+			"Home News\nshort\n");
+
+	HTML::TextExtractorOptions options;
+	options.prune_boilerplate = true;
+	string output;
+	HTML::StringTextSink sink(output);
+	HTML::TextExtractor<> extractor(sink, options);
+	extractor.extract("<p><a href=a>one two three four five six</a></p><p>one two three four five six</p>");
+	if (extractor.blocks() != 2 || extractor.blocks_dropped() != 1) {
+		cerr << extractor.blocks() << " blocks with " << extractor.blocks_dropped() << " dropped instead of 2 with 1" << endl;
+		++failures;
+	}
+
+	if (failures == 0)
+		cout << "the text of the pages extracted" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <map>
+
+#include "../utils/icstring.h"
+
+using namespace std;
+
+static int failures = 0;
+
+static void check(bool ok, const string& what) {
+	if (!ok) {
+		cerr << "failed: " << what << endl;
+		++failures;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// a view points into the text, longer than 16 bytes to go through the wide compare
+	char text[] = "<DIV CLASS=\"Navigation-Bar\">";
+	icstring_view tag(text + 1, text + 4);
+	icstring_view value(text + 12, text + 26);
+	check(tag.data() == text + 1, "a view not copying the text");
+	check(tag == "div" && tag != "dir" && icstring_view("Navigation-Bar-Left-Side") == "NAVIGATION-BAR-LEFT-SIDE",
+			"case-insensitive equality");
+	check(icstring_view("abc") < "ABD" && !(icstring_view("ABC") < "abc") && icstring_view("ab") < "ABC",
+			"case-insensitive ordering");
+	check(value.find("bar") == 11 && value.find('N') == 0 && value.find("x") == icstring_view::npos, "find");
+	check(value.substr(11) == "BAR" && value.substr(11).data() == value.data() + 11, "a substring of a view");
+
+	// a modified view owns a copy, the text is left alone
+	icstring_view copy = tag;
+	copy.append("-x");
+	check(copy == "DIV-X" && copy.data() != text + 1 && string(text, 5) == "<DIV ", "appending to a view");
+	copy.erase(0, 1);
+	copy.insert(0, "d");
+	check(copy == "dIV-x" && copy.str() == "dIV-x", "erase and insert");
+	icstring_view assigned;
+	assigned = copy;
+	copy.clear();
+	check(assigned == "div-x" && copy.empty(), "a copy of an owning view");
+	check(string(tag.c_str()) == "DIV" && tag.c_str()[3] == '\0', "a null terminated copy");
+
+	// the maps keyed by names, and the hash agreeing with the equality
+	map<icstring_view, int> ids;
+	ids[icstring_view("Href")] = 1;
+	ids[icstring_view("SRC")] = 2;
+	check(ids.size() == 2 && ids[icstring_view("HREF")] == 1 && ids.find(icstring_view("src")) != ids.end(),
+			"a map keyed by views");
+	map<string, int, ignorcase_string_compare> names;
+	names["Content-Type"] = 1;
+	check(names.count("content-type") == 1 && names.count("content-length") == 0, "a map with the case-insensitive compare");
+	icstring_view_hash hash;
+	check(hash(icstring_view("Navigation-Bar-Left-Side")) == hash(icstring_view("NAVIGATION-BAR-LEFT-SIDE")),
+			"the hash of equal views");
+
+	if (failures == 0)
+		cout << "case-insensitive views compared" << endl;
+	return failures == 0 ? 0 : 1;
+}
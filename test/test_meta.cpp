@@ -0,0 +1,108 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+
+#include <iostream>
+#include <string>
+
+#include "../stpl/wiki/stpl_wiki_meta.h"
+
+using namespace std;
+using namespace stpl::WIKI;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static string join(const utils::StringInterner& strings, const vector<wiki_string_id>& ids) {
+	string out;
+	for (size_t i = 0; i < ids.size(); ++i)
+		out += (i > 0 ? "|" : "") + strings.str(ids[i]);
+	return out;
+}
+
+/**
+ * the templates as name(key=value,key=value) separated by spaces
+ */
+static string templates(const utils::StringInterner& strings, const WikiMeta& meta) {
+	string out;
+	for (size_t i = 0; i < meta.templates.size(); ++i) {
+		const WikiMetaTemplate& tmpl = meta.templates[i];
+		out += (i > 0 ? " " : "") + strings.str(tmpl.name) + "(";
+		for (size_t j = tmpl.first; j < tmpl.first + tmpl.count; ++j)
+			out += (j > tmpl.first ? "," : "") + strings.str(meta.properties[j].name) + "=" + strings.str(meta.properties[j].value);
+		out += ")";
+	}
+	return out;
+}
+
+static string redirect(const utils::StringInterner& strings, const WikiMeta& meta) {
+	return meta.is_redirect() ? strings.str(meta.redirect) : "";
+}
+
+int main(int argc, char* argv[])
+{
+	utils::StringInterner strings;
+	WikiMetaExtractor extractor(strings);
+	WikiMeta meta;
+
+	// the links, with their fragments and labels left out
+	extractor.extract("See [[Foo bar|the foo]], [[ Baz#History ]], [[#Local]] and [[:Category:Cats]].\n"
+			"[[not a\nlink]] [single] [[Category:Dogs|sort key]] [[category : Big cats]]", meta);
+	check(join(strings, meta.links), "Foo bar|Baz|Category:Cats", "the links");
+	check(join(strings, meta.categories), "Dogs|Big cats", "the categories");
+	check(redirect(strings, meta), "", "a page that is not a redirect");
+	check(templates(strings, meta), "", "a page without templates");
+
+	// the redirect
+	extractor.extract("  #redirect: [[Target page#Section|label]]\n[[Category:Redirects]]", meta);
+	check(redirect(strings, meta), "Target page", "the redirect");
+	check(join(strings, meta.categories), "Redirects", "the categories of a redirect");
+	check(join(strings, meta.links), "", "the redirect is not a link");
+
+	// the templates with their parameters, the nested ones too
+	extractor.extract("{{Infobox person\n| name = Ada [[Lovelace]]\n| born = {{birth date|1815|12|10}}\n"
+			"| note = {{{1|none}}}\n| plain \n}} text {{stub}}", meta);
+	check(templates(strings, meta),
+			"Infobox person(name=Ada [[Lovelace]],born={{birth date|1815|12|10}},note={{{1|none}}},1= plain \n) "
+			"birth date(1=1815,2=12,3=10) stub()", "the templates");
+	check(join(strings, meta.links), "Lovelace", "a link in a template");
+
+	// the markup in comments, <nowiki>, <pre> and <math> is skipped
+	extractor.extract("<!-- [[Hidden]] {{hidden}} -->[[Shown]]<nowiki>[[Raw]] {{raw}}</nowiki>"
+			"<pre>{{pre}}</pre><math>{{x}}</math><nowiki/>{{shown|a=1}}<ref name=\"n\">[[Ref]]</ref>", meta);
+	check(join(strings, meta.links), "Shown|Ref", "the links outside of the raw text");
+	check(templates(strings, meta), "shown(a=1)", "the templates outside of the raw text");
+
+	// a template left open at the end is kept, a link left open is not
+	extractor.extract("{{open|x=1 [[unclosed", meta);
+	check(templates(strings, meta), "open(x=1 [[unclosed)", "a template left open");
+	check(join(strings, meta.links), "", "a link left open");
+
+	if (failures == 0)
+		cout << "wiki metadata extracted" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+
+#include <iostream>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../stpl/wiki/stpl_wiki_records.h"
+
+using namespace std;
+using namespace stpl::WIKI;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void check(size_t got, size_t expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": " << got << " instead of " << expected << endl;
+		++failures;
+	}
+}
+
+/**
+ * the binary records read back into the TSV form
+ */
+static string read_binary(const string& records, const TemplateNames& names) {
+	string out;
+	size_t p = 0;
+	while (p + sizeof(int64_t) + 3 * sizeof(uint32_t) <= records.size()) {
+		int64_t page;
+		uint32_t header[3];
+		memcpy(&page, records.data() + p, sizeof(page));
+		memcpy(header, records.data() + p + sizeof(page), sizeof(header));
+		p += sizeof(page) + sizeof(header);
+		if (p + header[2] > records.size())
+			break;
+		string name = names.str(header[0]);
+		string parameter = names.str(header[1]);
+		out += to_string(page) + "\t";
+		append_tsv_field(out, name.data(), name.length());
+		out += '\t';
+		append_tsv_field(out, parameter.data(), parameter.length());
+		out += '\t';
+		append_tsv_field(out, records.data() + p, header[2]);
+		out += '\n';
+		p += header[2];
+	}
+	if (p != records.size())
+		out += "(truncated)\n";
+	return out;
+}
+
+int main(int argc, char* argv[])
+{
+	static const char TEXT[] =
+			"{{infobox_person\n| name = Ada\tLovelace\n| born = 1815 }}"
+			"{{cite web|url=http://example.org|a\\b=c|positional\n|line=one\r\ntwo}}"
+			"{{Infobox empty}}{{stub|x=1}}{{citation|title=left out}}";
+
+	utils::StringInterner strings;
+	WikiMetaExtractor extractor(strings);
+	WikiMeta meta;
+	extractor.extract(TEXT, meta);
+
+	// the TSV format with the names themselves, only the selected templates
+	TemplateNames names;
+	names.select("infobox*");
+	names.select("Cite_web");
+	names.select("stub");
+	TemplateRecordExporter tsv(names);
+	string out;
+	check(tsv.write(42, meta, strings, out), 7, "the number of records");
+	string expected =
+			"42\tInfobox person\tname\tAda\\tLovelace\n"
+			"42\tInfobox person\tborn\t1815\n"
+			"42\tCite web\turl\thttp://example.org\n"
+			"42\tCite web\ta\\\\b\tc\n"
+			"42\tCite web\t1\tpositional\\n\n"
+			"42\tCite web\tline\tone\\r\\ntwo\n"
+			"42\tStub\tx\t1\n";
+	check(out, expected, "the TSV records");
+
+	if (names.template_id("Citation", 8) != utils::StringInterner::NO_ID) {
+		cerr << "a template that is not selected has an id" << endl;
+		++failures;
+	}
+
+	// the binary format with the ids of the names
+	TemplateRecordExporter binary(names, TemplateRecordExporter::RECORDS_BINARY);
+	string records;
+	check(binary.write(42, meta, strings, records), 7, "the number of binary records");
+	check(read_binary(records, names), expected, "the binary records");
+
+	// all the templates without a selection
+	TemplateNames all;
+	TemplateRecordExporter all_tsv(all);
+	out.clear();
+	check(all_tsv.write(7, meta, strings, out), 8, "the number of records of all the templates");
+
+	// the names saved and loaded back keep their ids
+	char dir_template[] = "/tmp/test_records.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	string filename = dir + "/names.tsv";
+	names.parameter_id("with\r\n\tand\\", 11);
+	if (names.save(filename) != TemplateNames::NAMES_OK) {
+		cerr << "the names are not saved" << endl;
+		++failures;
+	}
+	TemplateNames loaded;
+	if (loaded.load(filename) != TemplateNames::NAMES_OK) {
+		cerr << "the names are not loaded" << endl;
+		++failures;
+	}
+	check(loaded.size(), names.size(), "the number of names loaded");
+	for (TemplateNames::id_type id = 0; id < names.size(); ++id)
+		check(loaded.str(id), names.str(id), "a name loaded back");
+	check(read_binary(records, loaded), expected, "the binary records with the names loaded back");
+	if (loaded.load(dir + "/missing.tsv") != TemplateNames::NAMES_ERROR) {
+		cerr << "a missing file of names is loaded" << endl;
+		++failures;
+	}
+	unlink(filename.c_str());
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "template records written in both formats" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+#include <iostream>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../stpl/wiki/stpl_wiki_dump.h"
+#include "../stpl/wiki/stpl_wiki_redirect.h"
+
+using namespace std;
+using namespace stpl::WIKI;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void write_file(const string& filename, const string& content) {
+	FILE* fp = fopen(filename.c_str(), "w");
+	fwrite(content.data(), 1, content.length(), fp);
+	fclose(fp);
+}
+
+static string page(const string& title, const string& redirect) {
+	string xml = "  <page>\n    <title>" + title + "</title>\n    <ns>0</ns>\n    <id>1</id>\n";
+	if (!redirect.empty())
+		xml += "    <redirect title=\"" + redirect + "\" />\n";
+	return xml + "    <revision><text>text</text></revision>\n  </page>\n";
+}
+
+int main(int argc, char* argv[])
+{
+	// the titles
+	check(normalize_title(" category: foo__bar#x"), "Category:Foo bar", "normalizing a category");
+	check(normalize_title("User_talk : bob"), "User talk:Bob", "normalizing a namespace with a space");
+	check(normalize_title("Star Wars: Episode I"), "Star Wars: Episode I", "normalizing a title with a colon");
+	check(normalize_title("mission: impossible"), "Mission: impossible", "normalizing a title with a colon");
+	check(normalize_title(":Talk:abc"), "Talk:Abc", "normalizing a title with a leading colon");
+	check(normalize_title("image:A.jpg"), "File:A.jpg", "normalizing a namespace alias");
+	check(normalize_title("FILE:x.png"), "File:X.png", "normalizing the case of a namespace");
+	check(normalize_title("project_talk:x"), "Wikipedia talk:X", "normalizing a namespace alias with a space");
+
+	// the arena gives the same titles, so its ids can be used as the keys
+	static const char* const TITLES[] = { "image:A.jpg", "FILE:x.png", "Project:x", " category: foo__bar", "Star Wars: Episode I", "plain" };
+	WikiTitleArena arena;
+	for (size_t i = 0; i < sizeof(TITLES) / sizeof(TITLES[0]); ++i)
+		check(arena.str(arena.intern(TITLES[i])), normalize_title(TITLES[i]), "a title of the arena");
+	check(string(arena.name(arena.intern("image:A.jpg"))), "A.jpg", "the name of a title of the arena");
+	if (arena.name_space(arena.intern("Project:x")) != NS_PROJECT) {
+		cerr << "the namespace of an alias is not the project" << endl;
+		++failures;
+	}
+
+	char dir_template[] = "/tmp/test_redirect.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	string dump = dir + "/dump.xml", table_file = dir + "/redirects.tbl";
+
+	write_file(dump, "<mediawiki>\n" + page("Star Wars: Episode I", "") + page("SW0", "Star Wars: Episode I")
+			+ page("SW1", "SW0") + page("Mission: impossible", "") + "</mediawiki>\n");
+
+	RedirectTableBuilder builder;
+	WikiDumpReader reader;
+	WikiPage wiki_page;
+	if (reader.open(dump) != WikiDumpReader::DUMP_OK || builder.load(reader, wiki_page) != 2) {
+		cerr << "unable to load the redirects of the dump" << endl;
+		++failures;
+	}
+
+	// a chain, a loop, a self redirect and enough redirects to fill a few slots
+	builder.add("a", "B");
+	builder.add("b", "c");
+	builder.add("Loop 1", "Loop 2");
+	builder.add("Loop 2", "Loop_1");
+	builder.add("Self", "self");
+	builder.add("cat", "category : animals#Cats");
+	builder.add("image:Old.jpg", "Project:x");
+	for (int i = 0; i < 100; ++i)
+		builder.add("R" + to_string(i), "Page " + to_string(i));
+
+	if (builder.write(table_file) != RedirectTableBuilder::REDIRECT_OK) {
+		cerr << "unable to write the table: " << builder.error() << endl;
+		return 1;
+	}
+	if (builder.broken() != 2) {
+		cerr << builder.broken() << " broken redirects instead of 2" << endl;
+		++failures;
+	}
+
+	RedirectTable table;
+	if (table.open(table_file) != RedirectTable::REDIRECT_OK) {
+		cerr << "unable to open the table: " << table.error() << endl;
+		return 1;
+	}
+	if (table.size() != 106) {
+		cerr << table.size() << " redirects in the table instead of 106" << endl;
+		++failures;
+	}
+
+	check(table.resolve("SW0"), "Star Wars: Episode I", "a redirect of the dump");
+	check(table.resolve("SW1"), "Star Wars: Episode I", "a chain of the dump");
+	check(table.resolve("A"), "C", "a chain");
+	check(table.resolve("b"), "C", "a redirect");
+	check(table.resolve("C"), "C", "a page");
+	check(table.resolve("Loop 1"), "Loop 1", "a loop");
+	check(table.resolve("Self"), "Self", "a redirect to itself");
+	check(table.resolve("cat"), "Category:Animals", "a redirect to a category");
+	check(table.resolve("FILE:old.jpg"), "Wikipedia:X", "a redirect between namespace aliases");
+	check(table.resolve("Mission: impossible"), "Mission: impossible", "a page with a colon");
+	for (int i = 0; i < 100; ++i)
+		check(table.resolve("R" + to_string(i)), "Page " + to_string(i), "one of many redirects");
+
+	size_t length = 0;
+	const char* target = table.find("SW0", 3, &length);
+	check(target ? string(target, length) : "", "Star Wars: Episode I", "finding a redirect");
+	if (table.find("Nothing", 7)) {
+		cerr << "a title that is not a redirect is found" << endl;
+		++failures;
+	}
+
+	table.close();
+	unlink(dump.c_str());
+	unlink(table_file.c_str());
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "redirect tables written, mapped and resolved" << endl;
+	return failures == 0 ? 0 : 1;
+}
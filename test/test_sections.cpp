@@ -0,0 +1,118 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../stpl/wiki/stpl_wiki_parser.h"
+#include "../stpl/wiki/stpl_wiki_sections.h"
+
+using namespace std;
+using namespace stpl;
+using namespace stpl::WIKI;
+
+typedef WikiParser<string, string::iterator>	wiki_parser;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << " differs from the page parsed as a whole:\n" << got << "\ninstead of\n" << expected << endl;
+		++failures;
+	}
+}
+
+static string render(wiki_parser::document_type& doc) {
+	string output;
+	StringWikiWriter out(output);
+	doc.write_html(out);
+	out << '\n';
+	doc.write_text(out);
+	return output;
+}
+
+/**
+ * sections with the markup that hides a heading: templates, tables,
+ * comments and nowiki blocks across lines
+ */
+static string page() {
+	string text = "Lead paragraph with '''bold''' and a [[link]].\n\n";
+	for (int i = 0; i < 30; ++i) {
+		string n = to_string(i);
+		text += "== Section " + n + " ==\n";
+		text += "Text of section " + n + " with ''italics'' and [[Target " + n + "|a link]].\n";
+		text += "=== Subsection " + n + " ===\n* item one\n* item two\n";
+		if (i % 5 == 1)
+			text += "{{Infobox\n== not a heading in a template ==\n| name = x\n}}\n";
+		if (i % 5 == 2)
+			text += "{| class=\"wikitable\"\n|-\n== not a heading in a table ==\n| cell || cell\n|}\n";
+		if (i % 5 == 3)
+			text += "<!--\n== not a heading in a comment ==\n-->\n<nowiki>\n== nor in nowiki ==\n</nowiki>\n";
+		text += "\n";
+	}
+	return text;
+}
+
+int main(int argc, char* argv[])
+{
+	string text = page();
+
+	wiki_parser whole(text.begin(), text.end());
+	string expected = render(whole.parse());
+	if (expected.find("Section 29") == string::npos || expected.find("Target 29") == string::npos) {
+		cerr << "the last section is missing from the page parsed as a whole" << endl;
+		++failures;
+	}
+
+	// parts of a few sections each, on several threads and on one
+	size_t part_sizes[] = { 1, 200, 1000, text.length() };
+	for (size_t i = 0; i < sizeof(part_sizes) / sizeof(part_sizes[0]); ++i) {
+		WikiSectionParser<wiki_parser> threaded(text.begin(), text.end(), part_sizes[i]);
+		string what = "the page in " + to_string(threaded.parts()) + " parts";
+		check(render(threaded.parse(4)), expected, what + " on 4 threads");
+
+		WikiSectionParser<wiki_parser> sequential(text.begin(), text.end(), part_sizes[i]);
+		check(render(sequential.parse(1)), expected, what + " on 1 thread");
+	}
+
+	// the headings hidden by the markup don't start a part
+	vector<size_t> headings;
+	find_headings(text.begin(), text.end(), headings);
+	for (size_t i = 0; i < headings.size(); ++i)
+		if (text.compare(headings[i], 2, "==") != 0 || text.compare(headings[i], 7, "== not ") == 0
+				|| text.compare(headings[i], 7, "== nor ") == 0) {
+			cerr << "a heading found at " << text.substr(headings[i], 30) << endl;
+			++failures;
+		}
+	if (headings.size() != 60) {
+		cerr << headings.size() << " headings instead of 60" << endl;
+		++failures;
+	}
+
+	WikiSectionParser<wiki_parser> one(text.begin(), text.end(), 1);
+	if (one.parts() != 61) {
+		cerr << one.parts() << " parts instead of 61" << endl;
+		++failures;
+	}
+
+	if (failures == 0)
+		cout << "a page parsed in parts as a whole" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <string>
+
+#include "../stpl/wiki/stpl_wiki_template.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void check(size_t got, size_t expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": " << got << " instead of " << expected << endl;
+		++failures;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	WIKI::TemplateStore store;
+	store.add("Template:Greet", "Hello {{{1}}} and {{{name|nobody}}}{{{missing}}}");
+	store.add_redirect("Template:Hi", "Template:greet");
+	store.add("Template:Either", "{{#if: {{{1|}}} | one is {{{1}}} | no one }}");
+	store.add("Template:Doc", "a<noinclude>documentation</noinclude>b");
+	store.add("Template:Only", "x<onlyinclude>shown</onlyinclude>y");
+	store.add("Template:Loop", "x{{loop}}");
+	store.add("Template:Ping", "{{Pong}}");
+	store.add("Template:Pong", "{{Ping}}");
+	store.add("Template:Big", string(100, 'x'));
+	store.add("Template:A", "a");
+	store.add("Template:B", "b");
+	for (int i = 0; i < 10; ++i)
+		store.add("Template:Deep" + to_string(i), "{{Deep" + to_string(i + 1) + "}}");
+
+	WIKI::TemplateExpander expander(store);
+
+	// parameters, defaults and the redirects between templates
+	check(expander.expand("{{Greet|World|name = Ann }}"), "Hello World and Ann{{{missing}}}", "a positional and a named parameter");
+	check(expander.expand("{{greet| World }}"), "Hello  World  and nobody{{{missing}}}", "a default and an untrimmed positional one");
+	check(expander.expand("{{Hi|you}}"), "Hello you and nobody{{{missing}}}", "a template redirect");
+	check(expander.expand("{{Either|x}}/{{Either}}"), "one is x/no one", "a parameter in a condition");
+	check(expander.expand("{{Doc}}{{Only}}x<includeonly>y</includeonly>"), "abshownx", "the inclusion tags");
+	check(expander.expand("{{Nope}}{{CURRENTYEAR}}{{#invoke:m|f}}"), "[[Template:Nope]]", "a missing template and the magic words");
+	check(expander.expand("{{PAGENAME}}{{!}}", "Page"), "Page|", "the page name and {{!}}");
+
+	// the parser functions
+	check(expander.expand("{{#if: x | yes | no}}{{#if: | yes | no}}{{#if: | yes}}"), "yesno", "#if");
+	check(expander.expand("{{#ifeq: 01 | 1 | same | different}} {{#ifeq: a | b | same | different}}"), "same different", "#ifeq");
+	check(expander.expand("{{#switch: b | a = A | b | c = BC | #default = D}}"), "BC", "a #switch case falling through");
+	check(expander.expand("{{#switch: z | a = A | #default = D}}{{#switch: z | a = A | last}}"), "Dlast", "the #switch defaults");
+	check(expander.expand("{{uc: abc}}{{lcfirst: ABC}}"), "ABCaBC", "the case functions");
+
+	// loops are reported in place, and so is the depth limit
+	check(expander.expand("{{Loop}}"), "x<span class=\"error\">Template loop detected: [[Template:Loop]]</span>", "a template including itself");
+	check(expander.expand("{{Ping}}"), "<span class=\"error\">Template loop detected: [[Template:Ping]]</span>", "two templates including each other");
+	expander.max_depth(5);
+	check(expander.expand("{{Deep0}}"), "<span class=\"error\">Template depth limit exceeded: [[Template:Deep5]]</span>", "the depth limit");
+	expander.max_depth(WIKI::TemplateExpander::DEFAULT_MAX_DEPTH);
+	check(expander.expand("{{Deep0}}"), "[[Template:Deep10]]", "the templates within the depth limit");
+
+	// the calls after the output cap are left out, the cap is per page
+	expander.max_output(250);
+	string warning = "<!-- WARNING: template omitted, post-expand include size too large -->";
+	check(expander.expand("{{Big}}{{Big}}{{Big}}{{Big}}"), string(300, 'x') + warning, "the output cap");
+	check(expander.expand("{{Big}}"), string(100, 'x'), "the output cap of the next page");
+	expander.max_output(WIKI::TemplateExpander::DEFAULT_MAX_OUTPUT);
+
+	// a cache of one body, a hit only when the same template comes again
+	WIKI::TemplateExpander lru(store, 1);
+	check(lru.expand("{{A}}{{A}}{{B}}{{A}}"), "aaba", "the expansion with a small cache");
+	check(lru.cache_hits(), 1, "the cache hits");
+	check(lru.cache_misses(), 3, "the cache misses");
+	lru.cache_size(2);
+	lru.expand("{{A}}{{B}}{{A}}{{B}}");
+	check(lru.cache_hits(), 4, "the cache hits of a larger cache");
+	check(lru.cache_misses(), 4, "the cache misses of a larger cache");
+
+	if (failures == 0)
+		cout << "templates expanded" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../stpl/misc/stpl_warc.h"
+
+using namespace std;
+using namespace stpl;
+
+static int failures = 0;
+
+static void check(const string& got, const string& expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": \"" << got << "\" instead of \"" << expected << "\"" << endl;
+		++failures;
+	}
+}
+
+static void check(size_t got, size_t expected, const string& what) {
+	if (got != expected) {
+		cerr << what << ": " << got << " instead of " << expected << endl;
+		++failures;
+	}
+}
+
+static void write_file(const string& filename, const string& content) {
+	FILE* fp = fopen(filename.c_str(), "wb");
+	fwrite(content.data(), 1, content.length(), fp);
+	fclose(fp);
+}
+
+/**
+ * the data as one gzip member
+ */
+static string gzip(const string& data) {
+	z_stream zs;
+	memset(&zs, 0, sizeof(zs));
+	deflateInit2(&zs, 6, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+	string out(deflateBound(&zs, data.length()) + 32, '\0');
+	zs.next_in = (Bytef*) data.data();
+	zs.avail_in = data.length();
+	zs.next_out = (Bytef*) &out[0];
+	zs.avail_out = out.length();
+	deflate(&zs, Z_FINISH);
+	out.resize(zs.total_out);
+	deflateEnd(&zs);
+	return out;
+}
+
+static string record(const string& type, const string& uri, const string& content_type, const string& block) {
+	return "WARC/1.0\r\nWARC-Type: " + type + "\r\nWARC-Target-URI: " + uri + "\r\nContent-Type: " + content_type
+			+ "\r\nContent-Length: " + to_string(block.length()) + "\r\n\r\n" + block + "\r\n\r\n";
+}
+
+static string response(const string& uri, const string& headers, const string& body) {
+	return record("response", uri, "application/http; msgtype=response", "HTTP/1.1 200 OK\r\n" + headers + "\r\n" + body);
+}
+
+/**
+ * the body in chunks of five bytes, with an extension on the first one
+ */
+static string chunked(const string& body) {
+	string out;
+	for (size_t i = 0; i < body.length(); i += 5) {
+		string chunk = body.substr(i, 5);
+		char size[16];
+		snprintf(size, sizeof(size), "%zx", chunk.length());
+		out += string(size) + (i == 0 ? ";ext=1" : "") + "\r\n" + chunk + "\r\n";
+	}
+	return out + "0\r\n\r\n";
+}
+
+struct Links {
+	vector<string>		urls;
+
+	void operator() (const HTML::Link& link) {
+		urls.push_back(link.url);
+	}
+};
+
+/**
+ * collects the target URIs, called from several threads
+ */
+struct Collector {
+	mutex				lock;
+	vector<string>		uris;
+	string				encoded_body;
+
+	void operator() (WARC::Record& record) {
+		lock_guard<mutex> guard(lock);
+		uris.push_back(record.target_uri);
+		if (record.target_uri == "http://example.org/encoded")
+			encoded_body.assign(record.payload_begin, record.payload_end);
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	const string html = "<html><head><title>x</title></head><body><a href=\"/a\">a</a> <img src=\"b.png\"></body></html>";
+
+	vector<string> records;
+	records.push_back(record("warcinfo", "", "application/warc-fields", "software: test\r\n"));
+	records.push_back(record("request", "http://example.org/", "application/http; msgtype=request", "GET / HTTP/1.1\r\n\r\n"));
+	records.push_back(response("http://example.org/", "Content-Type: text/html\r\n", html));
+	records.push_back(response("http://example.org/encoded",
+			"Content-Type: text/html; charset=utf-8\r\nContent-Encoding: gzip\r\nTransfer-Encoding: chunked\r\n", chunked(gzip(html))));
+	records.push_back(response("http://example.org/chunked", "Content-Type: text/html\r\nTransfer-Encoding: chunked\r\n", chunked(html)));
+	records.push_back(response("http://example.org/b.png", "Content-Type: image/png\r\n", "PNG"));
+	for (int i = 0; i < 50; ++i)
+		records.push_back(response("http://example.org/" + to_string(i), "Content-Type: text/html\r\n", html));
+
+	string plain, compressed;
+	for (size_t i = 0; i < records.size(); ++i) {
+		plain += records[i];
+		compressed += gzip(records[i]);
+	}
+
+	char dir_template[] = "/tmp/test_warc.XXXXXX";
+	string dir = mkdtemp(dir_template);
+	string plain_file = dir + "/test.warc", compressed_file = dir + "/test.warc.gz", damaged_file = dir + "/damaged.warc.gz";
+	write_file(plain_file, plain);
+	write_file(compressed_file, compressed);
+	write_file(damaged_file, compressed.substr(0, compressed.length() - 20));
+
+	// the records of both files, with the payloads decoded
+	WARC::WarcReader reader;
+	const string files[] = { plain_file, compressed_file };
+	for (size_t f = 0; f < 2; ++f) {
+		if (reader.open(files[f]) != WARC::WarcReader::WARC_OK) {
+			cerr << "unable to open " << files[f] << endl;
+			return 1;
+		}
+		check(reader.is_gzip() ? "gzip" : "plain", f == 0 ? "plain" : "gzip", "the compression of the file");
+
+		WARC::Record record;
+		size_t count = 0, html_count = 0;
+		while (reader.next(record)) {
+			++count;
+			html_count += record.is_html() ? 1 : 0;
+			string payload(record.payload_begin, record.payload_end);
+			if (record.target_uri == "http://example.org/encoded") {
+				check(payload, html, "a chunked and gzipped payload");
+				check(record.http_header("Content-Encoding"), "gzip", "a HTTP header of a decoded payload");
+
+				// a copy has the decoded payload of its own
+				WARC::Record copy = record;
+				record.clear();
+				check(string(copy.payload_begin, copy.payload_end), html, "the payload of a copy");
+
+				Links links;
+				WARC::LinkRecordExtractor<Links> extractor(links);
+				check(extractor.extract(copy), 2, "the links of a decoded payload");
+				check(links.urls.empty() ? "" : links.urls[0], "http://example.org/a", "a link of a decoded payload");
+			}
+			else if (record.target_uri == "http://example.org/chunked")
+				check(payload, html, "a chunked payload");
+			else if (record.is_html())
+				check(payload, html, "a plain payload");
+		}
+		check(reader.error(), "", "the error after the last record");
+		check(count, records.size(), "the number of records");
+		check(html_count, 53, "the number of HTML responses");
+	}
+
+	// a pool of threads on the compressed file, and the calling thread only
+	for (unsigned threads = 1; threads <= 4; threads += 3) {
+		Collector all, html_only;
+		reader.open(compressed_file);
+		check(reader.for_each(all, threads), records.size(), "the records of for_each");
+		reader.open(compressed_file);
+		check(reader.for_each_html(html_only, threads), 53, "the records of for_each_html");
+		check(html_only.encoded_body, html, "the decoded payload in for_each_html");
+		sort(html_only.uris.begin(), html_only.uris.end());
+		check(html_only.uris.size() > 0 ? html_only.uris[0] : "", "http://example.org/", "the first HTML response");
+		check(reader.error(), "", "the error after for_each");
+	}
+
+	// a damaged member stops the reader with an error, a good file clears it
+	Collector damaged;
+	reader.open(damaged_file);
+	reader.for_each(damaged, 4);
+	check(damaged.uris.size(), records.size() - 1, "the records before a damaged member");
+	check(reader.error(), "damaged gzip member", "the error of a damaged member");
+	reader.open(plain_file);
+	check(reader.error(), "", "the error after opening another file");
+
+	reader.close();
+	unlink(plain_file.c_str());
+	unlink(compressed_file.c_str());
+	unlink(damaged_file.c_str());
+	rmdir(dir.c_str());
+
+	if (failures == 0)
+		cout << "WARC records read and decoded" << endl;
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,693 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// before the headers, so a build without configure sees the macro it defines
+#ifndef VERSION
+	#define VERSION "1.0.0"
+#endif
+
+#include "../stpl/wiki/stpl_wiki_parser.h"
+#include "../stpl/wiki/stpl_wiki_dump.h"
+#include "../stpl/wiki/stpl_wiki_meta.h"
+#include "../stpl/wiki/stpl_wiki_template.h"
+#include "../stpl/wiki/stpl_wiki_redirect.h"
+#include "../stpl/wiki/stpl_wiki_sections.h"
+#include "../stpl/wiki/stpl_wiki_records.h"
+#include "../stpl/wiki/stpl_wiki_variant.h"
+#include "../utils/bounded_queue.h"
+#include "../utils/checkpoint.h"
+
+using namespace std;
+using namespace stpl;
+using namespace stpl::WIKI;
+
+typedef WikiParser<string, string::iterator>	wiki_parser;
+
+enum Format { FORMAT_TEXT, FORMAT_HTML, FORMAT_TREC, FORMAT_JSON, FORMAT_META, FORMAT_RECORDS, FORMAT_RECORDS_BINARY };
+
+struct Options {
+	Format			format;
+	string			extension;
+	string			prefix;
+	long long		shard_size;
+	unsigned		threads;
+	size_t			queue_size;
+	bool			ordered;
+	bool			all_namespaces;
+	bool			skip_redirects;
+	string			checkpoint;
+	long long		checkpoint_interval;
+	string			templates;		/// the dump the templates are expanded from
+	string			redirects;		/// the redirect table to build instead of converting
+	long long		split_size;		/// pages larger than this are parsed a few sections at a time
+	vector<string>	selected;		/// the templates exported as records, all of them if empty
+	string			variant;		/// the Chinese variant the pages are converted into
+	vector<string>	variant_tables;
+
+	Options() : format(FORMAT_TEXT), extension("txt"), prefix("wiki"), shard_size(256LL << 20),
+			threads(0), queue_size(0), ordered(false), all_namespaces(false), skip_redirects(false),
+			checkpoint_interval(10000), split_size(1LL << 20) {}
+};
+
+struct Job {
+	size_t			seq;
+	long long		end_offset;		/// input offset right after the page, in its bz2 stream
+	long long		end_stream;		/// the compressed offset of that stream
+	WikiPage		page;
+};
+
+struct Result {
+	size_t			seq;
+	long long		end_offset;
+	long long		end_stream;
+	string			output;
+};
+
+/**
+ * the number of pages the reader may get ahead of the writer when the input order
+ * is kept, so the pages waiting for a slow one can't pile up without a limit
+ */
+class Window {
+	private:
+		size_t					size_;
+		size_t					written_;
+		mutex					mutex_;
+		condition_variable		cond_;
+
+	public:
+		Window(size_t size) : size_(size), written_(0) {}
+
+		void wait(size_t seq) {
+			unique_lock<mutex> lock(mutex_);
+			cond_.wait(lock, [&]() { return seq < written_ + size_; });
+		}
+
+		void done(size_t written) {
+			lock_guard<mutex> lock(mutex_);
+			written_ = written;
+			cond_.notify_all();
+		}
+};
+
+/**
+ * the output files, a new shard is started once the current one reaches the size limit
+ */
+class ShardWriter {
+	private:
+		const Options&	options_;
+		FILE*			fp_;
+		int				shard_;
+		long long		written_;
+
+	public:
+		ShardWriter(const Options& options) : options_(options), fp_(NULL), shard_(-1), written_(0) {}
+		~ShardWriter() { close(); }
+
+		bool write(const string& output) {
+			if (!fp_ || (options_.shard_size > 0 && written_ >= options_.shard_size))
+				if (!next_shard())
+					return false;
+			if (fwrite(output.data(), 1, output.size(), fp_) != output.size())
+				return false;
+			written_ += output.size();
+			return true;
+		}
+
+		void close() {
+			if (fp_)
+				fclose(fp_);
+			fp_ = NULL;
+		}
+
+		/**
+		 * make the written data durable, before a checkpoint refers to it
+		 */
+		bool sync() {
+			return !fp_ || (fflush(fp_) == 0 && fsync(fileno(fp_)) == 0);
+		}
+
+		/**
+		 * the current shard and its size, empty if nothing is written yet
+		 */
+		string current() const { return fp_ ? shard_name(shard_) : string(); }
+		long long written() const { return written_; }
+
+		/**
+		 * continue appending to a shard restored from a checkpoint, the shards
+		 * written after it are removed
+		 */
+		bool resume(const string& filename, long long written) {
+			int shard = 0;
+			while (shard_name(shard) != filename)
+				if (access(shard_name(shard++).c_str(), F_OK) != 0)
+					return false;
+
+			for (int later = shard + 1; unlink(shard_name(later).c_str()) == 0; ++later)
+				;
+
+			close();
+			if (!(fp_ = fopen(filename.c_str(), "ab")))
+				return false;
+			shard_ = shard;
+			written_ = written;
+			return true;
+		}
+
+	private:
+		string shard_name(int shard) const {
+			char name[32];
+			snprintf(name, sizeof(name), "-%05d.", shard);
+			return options_.prefix + name + options_.extension;
+		}
+
+		bool next_shard() {
+			close();
+			string filename = shard_name(++shard_);
+			if (!(fp_ = fopen(filename.c_str(), "wb"))) {
+				fprintf(stderr, "unable to write to file: %s\n", filename.c_str());
+				return false;
+			}
+			written_ = 0;
+			return true;
+		}
+};
+
+void usage(const char *program) {
+	fprintf(stderr, "stpl-wiki - a wiki dump conversion tool (version: %s) from STPL (Simple Text Processing Library)\n", VERSION);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "usage: %s [options] /a/path/to/dump.xml[.bz2]|-\n", program);
+	fprintf(stderr, "          -f format    text, html, trec, json, meta, records or records-bin (default: text)\n");
+	fprintf(stderr, "          -o prefix    prefix of the output files, prefix-00000.ext ... (default: wiki)\n");
+	fprintf(stderr, "          -s size      size of a shard in MB, 0 for a single file (default: 256)\n");
+	fprintf(stderr, "          -j threads   number of worker threads (default: number of CPUs)\n");
+	fprintf(stderr, "          -q size      capacity of the work queues (default: 4 x threads)\n");
+	fprintf(stderr, "          -k           keep the input order in the output\n");
+	fprintf(stderr, "          -a           all the namespaces, not only the articles\n");
+	fprintf(stderr, "          -r           skip the redirects\n");
+	fprintf(stderr, "          -c file      checkpoint file, the job resumes from it if it exists (implies -k)\n");
+	fprintf(stderr, "          -n records   number of pages between two checkpoints (default: 10000)\n");
+	fprintf(stderr, "          -t dump      expand the templates with the ones of the dump, e.g. the input itself\n");
+	fprintf(stderr, "          -R file      only build the redirect table of the dump into the file\n");
+	fprintf(stderr, "          -T names     the templates exported as records, comma separated, Infobox* for a prefix\n");
+	fprintf(stderr, "          -z variant   convert the pages into zh-hans, zh-hant, zh-tw or zh-hk\n");
+	fprintf(stderr, "          -Z tables    the conversion tables of the variant, comma separated, the later ones take precedence\n");
+	fprintf(stderr, "          -p size      size in KB above which a page is parsed in parts on the worker threads, 0 for never (default: 1024)\n");
+	exit(-1);
+}
+
+/**
+ * counts a worker in splitting while it parses a page in parts, the count is
+ * given back even if the parse throws
+ */
+struct Splitting {
+	atomic<unsigned>&	workers;
+	unsigned			count;		/// the workers splitting a page, this one included
+
+	Splitting(atomic<unsigned>& splitting) : workers(splitting), count(++splitting) {}
+	~Splitting() { --workers; }
+};
+
+/**
+ * a very large page would hold up its worker, its sections are parsed by
+ * several threads; the workers on such pages at the same time share the -j
+ * threads between them, splitting is the number of them
+ */
+string render(WikiPage& page, const Options& options, atomic<unsigned>& splitting) {
+	unique_ptr<wiki_parser> parser;
+	unique_ptr<WikiSectionParser<wiki_parser> > sections;
+	wiki_parser::document_type* doc_ptr;
+	if (options.split_size > 0 && (long long) page.text.length() > options.split_size && options.threads > 1) {
+		Splitting counted(splitting);
+		unsigned share = max(1u, options.threads / counted.count);
+		sections.reset(new WikiSectionParser<wiki_parser>(page.text.begin(), page.text.end(), options.split_size / options.threads));
+		doc_ptr = &sections->parse(share);
+	}
+	else {
+		parser.reset(new wiki_parser(page.text.begin(), page.text.end()));
+		doc_ptr = &parser->parse();
+	}
+	wiki_parser::document_type& doc = *doc_ptr;
+	Format format = options.format;
+
+	char id[32];
+	snprintf(id, sizeof(id), "%lld", page.id);
+
+	// the whole page is rendered into one buffer
+	string output;
+	output.reserve(2 * page.text.length() + page.title.length() + 64);
+	StringWikiWriter out(output);
+	switch (format) {
+	case FORMAT_HTML:
+		doc.write_html(out);
+		out << '\n';
+		break;
+	case FORMAT_TREC:
+		doc.write_trec(out, page.title.c_str(), (int) page.id);
+		break;
+	case FORMAT_JSON:
+		doc.write_json(out, page.title.c_str(), id);
+		break;
+	default:
+		out << page.title << "\n\n";
+		doc.write_text(out);
+		out << '\n';
+		break;
+	}
+	return output;
+}
+
+/**
+ * a field of a meta line, the tabs, newlines, carriage returns and
+ * backslashes are escaped
+ */
+void append_field(string& output, const utils::StringInterner& strings, wiki_string_id id) {
+	output += '\t';
+	append_tsv_field(output, strings.data(id), strings.length(id));
+}
+
+/**
+ * the links, categories, redirect and templates of a page without parsing it
+ * in full, one line each:
+ *
+ * 		id	R	target
+ * 		id	L	target
+ * 		id	C	category
+ * 		id	T	template
+ * 		id	P	template	name	value
+ */
+string extract_meta(WikiPage& page, WikiMetaExtractor& extractor) {
+	WikiMeta meta;
+	// the ids are only needed until the lines are written
+	extractor.strings().clear();
+	extractor.extract(page.text, meta);
+	const utils::StringInterner& strings = extractor.strings();
+
+	char id[32];
+	snprintf(id, sizeof(id), "%lld", page.id);
+
+	string output;
+	auto line = [&](const char* kind) {
+		output += id;
+		output += '\t';
+		output += kind;
+	};
+	if (meta.is_redirect()) {
+		line("R");
+		append_field(output, strings, meta.redirect);
+		output += '\n';
+	}
+	for (size_t i = 0; i < meta.links.size(); ++i) {
+		line("L");
+		append_field(output, strings, meta.links[i]);
+		output += '\n';
+	}
+	for (size_t i = 0; i < meta.categories.size(); ++i) {
+		line("C");
+		append_field(output, strings, meta.categories[i]);
+		output += '\n';
+	}
+	for (size_t i = 0; i < meta.templates.size(); ++i) {
+		const WikiMetaTemplate& tmpl = meta.templates[i];
+		line("T");
+		append_field(output, strings, tmpl.name);
+		output += '\n';
+		for (size_t j = tmpl.first; j < tmpl.first + tmpl.count; ++j) {
+			line("P");
+			append_field(output, strings, tmpl.name);
+			append_field(output, strings, meta.properties[j].name);
+			append_field(output, strings, meta.properties[j].value);
+			output += '\n';
+		}
+	}
+	return output;
+}
+
+/**
+ * the parameters of the selected templates of a page, see stpl_wiki_records.h
+ */
+string extract_records(WikiPage& page, WikiMetaExtractor& extractor, TemplateRecordExporter& exporter) {
+	WikiMeta meta;
+	extractor.strings().clear();
+	extractor.extract(page.text, meta);
+
+	string output;
+	exporter.write(page.id, meta, extractor.strings(), output);
+	return output;
+}
+
+/**
+ * a comma separated list of an option
+ */
+void split_list(const char* p, vector<string>& list) {
+	while (*p) {
+		const char* comma = strchr(p, ',');
+		size_t length = comma ? comma - p : strlen(p);
+		if (length > 0)
+			list.push_back(string(p, length));
+		p += comma ? length + 1 : length;
+	}
+}
+
+/**
+ * the names the binary records refer to, next to the shards
+ */
+string names_file(const Options& options) {
+	return options.prefix + "-names.tsv";
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	int opt;
+	while ((opt = getopt(argc, argv, "f:o:s:j:q:karc:n:t:R:p:T:z:Z:")) != -1) {
+		switch (opt) {
+		case 'f':
+			if (strcmp(optarg, "text") == 0) {
+				options.format = FORMAT_TEXT;
+				options.extension = "txt";
+			}
+			else if (strcmp(optarg, "html") == 0) {
+				options.format = FORMAT_HTML;
+				options.extension = "html";
+			}
+			else if (strcmp(optarg, "trec") == 0) {
+				options.format = FORMAT_TREC;
+				options.extension = "trec";
+			}
+			else if (strcmp(optarg, "json") == 0) {
+				options.format = FORMAT_JSON;
+				options.extension = "json";
+			}
+			else if (strcmp(optarg, "meta") == 0) {
+				options.format = FORMAT_META;
+				options.extension = "tsv";
+			}
+			else if (strcmp(optarg, "records") == 0) {
+				options.format = FORMAT_RECORDS;
+				options.extension = "tsv";
+			}
+			else if (strcmp(optarg, "records-bin") == 0) {
+				options.format = FORMAT_RECORDS_BINARY;
+				options.extension = "rec";
+			}
+			else
+				usage(argv[0]);
+			break;
+		case 'o':
+			options.prefix = optarg;
+			break;
+		case 's':
+			options.shard_size = atoll(optarg) << 20;
+			break;
+		case 'j':
+			options.threads = atoi(optarg);
+			break;
+		case 'q':
+			options.queue_size = atoi(optarg);
+			break;
+		case 'k':
+			options.ordered = true;
+			break;
+		case 'a':
+			options.all_namespaces = true;
+			break;
+		case 'r':
+			options.skip_redirects = true;
+			break;
+		case 'c':
+			options.checkpoint = optarg;
+			options.ordered = true;
+			break;
+		case 'n':
+			options.checkpoint_interval = atoll(optarg);
+			if (options.checkpoint_interval <= 0)
+				usage(argv[0]);
+			break;
+		case 't':
+			options.templates = optarg;
+			break;
+		case 'R':
+			options.redirects = optarg;
+			break;
+		case 'p':
+			options.split_size = atoll(optarg) << 10;
+			break;
+		case 'T':
+			split_list(optarg, options.selected);
+			break;
+		case 'z':
+			options.variant = optarg;
+			break;
+		case 'Z':
+			split_list(optarg, options.variant_tables);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind >= argc)
+		usage(argv[0]);
+
+	if (options.threads == 0)
+		options.threads = max(1u, thread::hardware_concurrency());
+	if (options.queue_size == 0)
+		options.queue_size = 4 * options.threads;
+
+	string input = argv[optind];
+
+	UNICODE::ChineseVariant variant = UNICODE::ZH_VARIANTS;
+	UNICODE::ChineseConverter converter;
+	if (!options.variant.empty()) {
+		variant = UNICODE::chinese_variant(options.variant.data(), options.variant.length());
+		if (variant == UNICODE::ZH_VARIANTS)
+			usage(argv[0]);
+		for (size_t i = 0; i < options.variant_tables.size(); ++i)
+			if (converter.load(variant, options.variant_tables[i]) != UNICODE::ChineseConverter::CONVERTER_OK) {
+				fprintf(stderr, "unable to load the conversion table: %s\n", options.variant_tables[i].c_str());
+				return -1;
+			}
+	}
+
+	TemplateStore templates;
+	if (!options.templates.empty()) {
+		WikiDumpReader template_reader;
+		WikiPage page;
+		if (template_reader.open(options.templates) != WikiDumpReader::DUMP_OK) {
+			fprintf(stderr, "%s\n", template_reader.error().c_str());
+			return -1;
+		}
+		size_t count = templates.load(template_reader, page);
+		if (!template_reader.error().empty()) {
+			fprintf(stderr, "%s\n", template_reader.error().c_str());
+			return -1;
+		}
+		fprintf(stderr, "%zu templates loaded\n", count);
+	}
+
+	WikiDumpReader reader;
+	if (reader.open(input) != WikiDumpReader::DUMP_OK) {
+		fprintf(stderr, "%s\n", reader.error().c_str());
+		return -1;
+	}
+
+	if (!options.redirects.empty()) {
+		RedirectTableBuilder builder;
+		WikiPage page;
+		size_t count = builder.load(reader, page);
+		if (!reader.error().empty()) {
+			fprintf(stderr, "%s\n", reader.error().c_str());
+			return -1;
+		}
+		if (builder.write(options.redirects) != RedirectTableBuilder::REDIRECT_OK) {
+			fprintf(stderr, "%s\n", builder.error().c_str());
+			return -1;
+		}
+		fprintf(stderr, "%zu redirects read, %zu in the table, %zu broken\n", count, builder.size(), builder.broken());
+		return 0;
+	}
+
+	TemplateNames names;
+	for (size_t i = 0; i < options.selected.size(); ++i)
+		names.select(options.selected[i]);
+
+	ShardWriter shards(options);
+	utils::Checkpoint checkpoint(options.checkpoint);
+	if (!options.checkpoint.empty()) {
+		int ret = checkpoint.load();
+		if (ret == utils::Checkpoint::CHECKPOINT_ERROR) {
+			fprintf(stderr, "invalid checkpoint file: %s\n", options.checkpoint.c_str());
+			return -1;
+		}
+		if (ret == utils::Checkpoint::CHECKPOINT_OK) {
+			if (reader.seek(checkpoint.input(input), checkpoint.stream(input)) != WikiDumpReader::DUMP_OK
+					|| checkpoint.restore_outputs() != utils::Checkpoint::CHECKPOINT_OK
+					|| (!checkpoint.outputs().empty()
+							&& !shards.resume(checkpoint.outputs().begin()->first, checkpoint.outputs().begin()->second))
+					// the records written so far keep the ids of their names
+					|| (options.format == FORMAT_RECORDS_BINARY && names.load(names_file(options)) != TemplateNames::NAMES_OK)) {
+				fprintf(stderr, "unable to resume from checkpoint: %s\n", options.checkpoint.c_str());
+				return -1;
+			}
+			fprintf(stderr, "resuming after %lld pages\n", checkpoint.records());
+		}
+	}
+
+	utils::BoundedQueue<Job> jobs(options.queue_size);
+	utils::BoundedQueue<Result> results(options.queue_size);
+	Window window(options.queue_size + options.threads);
+
+	atomic<unsigned> splitting(0);
+	vector<thread> workers;
+	for (unsigned i = 0; i < options.threads; ++i)
+		workers.push_back(thread([&]() {
+			utils::StringInterner strings;
+			WikiMetaExtractor extractor(strings);
+			TemplateExpander expander(templates);
+			TemplateRecordExporter exporter(names, options.format == FORMAT_RECORDS_BINARY
+					? TemplateRecordExporter::RECORDS_BINARY : TemplateRecordExporter::RECORDS_TSV);
+			WikiVariantConverter variant_converter(converter, variant == UNICODE::ZH_VARIANTS ? UNICODE::ZH_HANS : variant);
+			Job job;
+			while (jobs.pop(job)) {
+				if (!options.templates.empty())
+					job.page.text = expander.expand(job.page.text, job.page.title);
+				if (variant != UNICODE::ZH_VARIANTS) {
+					job.page.text = variant_converter.convert(job.page.text);
+					job.page.title = converter.convert(job.page.title, variant);
+				}
+				Result result;
+				result.seq = job.seq;
+				result.end_offset = job.end_offset;
+				result.end_stream = job.end_stream;
+				if (options.format == FORMAT_META)
+					result.output = extract_meta(job.page, extractor);
+				else if (options.format == FORMAT_RECORDS || options.format == FORMAT_RECORDS_BINARY)
+					result.output = extract_records(job.page, extractor, exporter);
+				else
+					result.output = render(job.page, options, splitting);
+				results.push(std::move(result));
+			}
+		}));
+
+	atomic<bool> failed(false);
+	size_t first = checkpoint.records();
+	window.done(first);
+
+	// the position after the page just written, saved every checkpoint_interval pages
+	auto save_checkpoint = [&](const Result& result) {
+		if (!shards.sync()) {
+			failed = true;
+			return;
+		}
+		checkpoint.records(result.seq + 1);
+		checkpoint.input(input, result.end_offset);
+		checkpoint.stream(input, result.end_stream);
+		checkpoint.clear_outputs();
+		if (!shards.current().empty())
+			checkpoint.output(shards.current(), shards.written());
+		if (options.format == FORMAT_RECORDS_BINARY && names.save(names_file(options)) != TemplateNames::NAMES_OK) {
+			fprintf(stderr, "unable to save the names: %s\n", names_file(options).c_str());
+			failed = true;
+			return;
+		}
+		if (checkpoint.save() != utils::Checkpoint::CHECKPOINT_OK) {
+			fprintf(stderr, "unable to save checkpoint: %s\n", options.checkpoint.c_str());
+			failed = true;
+		}
+	};
+
+	thread writer([&]() {
+		map<size_t, Result> pending;
+		size_t next = first;
+		Result result, last;
+		last.seq = (size_t) -1;
+		while (results.pop(result)) {
+			if (failed)
+				continue;
+			if (!options.ordered) {
+				failed = !shards.write(result.output);
+				continue;
+			}
+			pending[result.seq] = std::move(result);
+			map<size_t, Result>::iterator it;
+			while (!failed && (it = pending.begin()) != pending.end() && it->first == next) {
+				failed = !shards.write(it->second.output);
+				++next;
+				if (!failed && !options.checkpoint.empty()
+						&& (long long) (next - first) % options.checkpoint_interval == 0)
+					save_checkpoint(it->second);
+				last = std::move(it->second);
+				pending.erase(it);
+			}
+			// let the reader go on to the end if the output is broken
+			window.done(failed ? (size_t) -1 / 2 : next);
+		}
+		if (!failed && !options.checkpoint.empty() && last.seq != (size_t) -1)
+			save_checkpoint(last);
+	});
+
+	size_t seq = first;
+	Job job;
+	while (!failed && reader.next(job.page)) {
+		if (!options.all_namespaces && job.page.ns != 0)
+			continue;
+		if (options.skip_redirects && !job.page.redirect.empty())
+			continue;
+		job.seq = seq++;
+		job.end_offset = reader.stream_offset();
+		job.end_stream = reader.stream();
+		if (options.ordered)
+			window.wait(job.seq);
+		jobs.push(std::move(job));
+	}
+	jobs.close();
+	for (size_t i = 0; i < workers.size(); ++i)
+		workers[i].join();
+	results.close();
+	writer.join();
+
+	if (!reader.error().empty()) {
+		fprintf(stderr, "%s\n", reader.error().c_str());
+		return -1;
+	}
+	if (failed)
+		return -1;
+	if (options.format == FORMAT_RECORDS_BINARY && names.save(names_file(options)) != TemplateNames::NAMES_OK) {
+		fprintf(stderr, "unable to save the names: %s\n", names_file(options).c_str());
+		return -1;
+	}
+
+	fprintf(stderr, "%zu pages converted\n", seq - first);
+	return 0;
+}
@@ -22,97 +22,315 @@
 
 #include <iostream>
 #include <string>
+#include <iterator>
 #include <archive.h>
 #include <archive_entry.h>
-#include <libgen.h>
+#include <cstddef>
 
-#include <stdlib.h> // for exit function
+#if ARCHIVE_VERSION_NUMBER < 3000000
+#define archive_read_free archive_read_finish
+#define archive_read_support_filter_gzip archive_read_support_compression_gzip
+#endif
 
 namespace ARCHIVE {
+
+	/**
+	 * @brief the header of the entry the archive is currently positioned at
+	 */
+	struct Entry {
+		std::string		pathname;
+		int64_t			size;		/// -1 if the size is not stored in the header
+		bool			regular;
+
+		Entry() : size(-1), regular(false) {}
+
+		std::string basename() const {
+			std::string::size_type pos = pathname.find_last_of('/');
+			return pos == std::string::npos ? pathname : pathname.substr(pos + 1);
+		}
+	};
+
+	/**
+	 * @brief sequential reader over all the entries of an archive
+	 *
+	 * All the methods return the libarchive status codes (ARCHIVE_OK, ARCHIVE_EOF,
+	 * ARCHIVE_WARN, ARCHIVE_FAILED, ARCHIVE_FATAL), the message of the last error
+	 * is available from error_string(). A warning is not treated as an error.
+	 *
+	 * 		Archive ar;
+	 * 		if (ar.open("shard.tar.gz") == ARCHIVE_OK)
+	 * 			for (Archive::iterator it = ar.begin(); it != ar.end(); ++it)
+	 * 				ar.read(consumer);	// consumer(const char* data, size_t size)
+	 *
+	 * The archive is read once, front to back: the iterators and next() share
+	 * one position. begin() reads the first header only if no header has been
+	 * read since open(), otherwise it starts at the current entry, so a loop
+	 * after next() or a second loop doesn't skip an entry; once the entries are
+	 * consumed begin() is end(), open() the file again to start over.
+	 */
 	class Archive {
 		protected:
 			struct archive *a_;
 			struct archive_entry *entry_;
+			Entry current_;
+			int status_;
+			bool opened_;
+			bool used_;			/// the handle has been handed to an open, even a failed one
+			bool started_;		/// a header has been read since open()
+			bool at_entry_;		/// positioned at an entry, not before the first or past the last
 
 		public:
 			typedef std::pair<bool, std::string> result_type;
 
+			/**
+			 * @brief input iterator over the entry headers, reading the entry content
+			 * is done with the archive itself while the iterator points at it
+			 */
+			class iterator {
+				private:
+					Archive* archive_ptr_;
+
+				public:
+					typedef std::input_iterator_tag	iterator_category;
+					typedef Entry					value_type;
+					typedef std::ptrdiff_t			difference_type;
+					typedef const Entry*			pointer;
+					typedef const Entry&			reference;
+
+					iterator() : archive_ptr_(NULL) {}
+					iterator(Archive* archive_ptr, bool first) : archive_ptr_(archive_ptr) {
+						if (first)
+							advance();
+					}
+
+					const Entry& operator *() const { return archive_ptr_->entry(); }
+					const Entry* operator ->() const { return &archive_ptr_->entry(); }
+
+					iterator& operator ++() {
+						advance();
+						return *this;
+					}
+
+					bool operator ==(const iterator& other) const { return archive_ptr_ == other.archive_ptr_; }
+					bool operator !=(const iterator& other) const { return archive_ptr_ != other.archive_ptr_; }
+
+				private:
+					void advance() {
+						if (archive_ptr_ && archive_ptr_->next() != ARCHIVE_OK)
+							archive_ptr_ = NULL;
+					}
+			};
+
 		public:
 			Archive() { init(); }
-			~Archive() { clearup(); }
+			virtual ~Archive() { clearup(); }
 
-			void open(std::string filename) {
-				int r;
-				if ((r = archive_read_open_file(a_, filename.c_str(), 10240))) {
-					std::cerr << archive_error_string(a_) << std::endl;
-					exit(r);
+			/**
+			 * @brief open the file, the archive can be opened again after close()
+			 */
+			int open(const std::string& filename, size_t block_size = 10240) {
+				// a libarchive handle is only opened once, a new one is set up after
+				// that; a failed open leaves the handle unusable as well
+				if (used_ || !a_) {
+					clearup();
+					init();
+					if (a_)
+						setup();
 				}
+				if (!a_)
+					return status_ = ARCHIVE_FATAL;
+				used_ = true;
+				if ((status_ = archive_read_open_filename(a_, filename.c_str(), block_size)) == ARCHIVE_WARN)
+					status_ = ARCHIVE_OK;
+				opened_ = (status_ == ARCHIVE_OK);
+				started_ = at_entry_ = false;
+				current_ = Entry();
+				return status_;
 			}
 
+			/**
+			 * @brief close and free the handle, open() sets up a new one
+			 */
 			void close() {
-				archive_read_close(a_);
-				archive_read_finish(a_);
+				clearup();
 			}
 
-			result_type find(std::string entryname) {
-				int r;
-				char *bname;
+			/**
+			 * @brief the status of the last operation, the iteration stops with
+			 * ARCHIVE_EOF when all the entries are consumed
+			 */
+			int status() const { return status_; }
+			bool good() const { return status_ == ARCHIVE_OK; }
 
-				for (;;) {
-					r = archive_read_next_header(a_, &entry_);
-					if (r == ARCHIVE_EOF)
-						break;
-					if (r != ARCHIVE_OK) {
-						std::cout << archive_error_string(a_) << std::endl;
-						exit(1);
-					}
+			const char* error_string() {
+				const char* msg = a_ ? archive_error_string(a_) : NULL;
+				return msg ? msg : "";
+			}
+
+			/**
+			 * @brief the first entry, or the current one if the reading has
+			 * already started
+			 */
+			iterator begin() {
+				if (!started_)
+					return iterator(this, true);
+				return at_entry_ ? iterator(this, false) : end();
+			}
+
+			iterator end() { return iterator(); }
+
+			const Entry& entry() const { return current_; }
+
+			/**
+			 * @brief move to the header of the next entry, the content of the previous
+			 * entry if not read is skipped by libarchive
+			 */
+			int next() {
+				if (!opened_)
+					return status_ = ARCHIVE_FATAL;
 
-					//cout << archive_entry_pathname(entry) << endl;
-					char *name = (char*)archive_entry_pathname(entry_);
-					bname = basename(name);
-					//if (string(archive_entry_pathname(entry)).find(entryname) != string::npos) {
-					if (std::string(bname) == std::string(entryname)) {
-
-						const void *buff;
-						size_t size;
-						off_t offset;
-
-						for (;;) {
-							r = archive_read_data_block(a_, &buff, &size, &offset);
-							if (r != ARCHIVE_EOF && r== ARCHIVE_OK) {
-								//cout << static_cast<const char*>(buff);
-								return make_pair(true, std::string(static_cast<const char*>(buff)));
-							}else {
-								std::cout << archive_error_string(a_) << std::endl;
-								break;
-							}
-						}
+				started_ = true;
+				status_ = archive_read_next_header(a_, &entry_);
+				if (status_ == ARCHIVE_WARN)
+					status_ = ARCHIVE_OK;
+				at_entry_ = (status_ == ARCHIVE_OK);
+
+				if (status_ == ARCHIVE_OK) {
+					const char* name = archive_entry_pathname(entry_);
+					current_.pathname = name ? name : "";
+					current_.size = archive_entry_size_is_set(entry_) ? archive_entry_size(entry_) : -1;
+					current_.regular = (archive_entry_filetype(entry_) == AE_IFREG);
+				}
+				else
+					current_ = Entry();
+				return status_;
+			}
+
+			/**
+			 * @brief read the next block of the current entry, the block stays valid
+			 * until the next call and ARCHIVE_EOF means the entry is done
+			 */
+			int read_block(const char*& data, size_t& size, int64_t& offset) {
+				const void *buff;
+#if ARCHIVE_VERSION_NUMBER < 3000000
+				off_t off;
+#else
+				int64_t off;
+#endif
+				status_ = archive_read_data_block(a_, &buff, &size, &off);
+				if (status_ == ARCHIVE_WARN)
+					status_ = ARCHIVE_OK;
+				data = static_cast<const char*>(buff);
+				offset = off;
+				return status_;
+			}
+
+			/**
+			 * @brief stream the whole content of the current entry block by block
+			 * into the consumer, which is called as consumer(const char* data, size_t size)
+			 * without any copy of the data in between
+			 *
+			 * the holes of sparse entries are passed to the consumer as zeros; the
+			 * consumer can be a temporary, like a lambda written in the call
+			 */
+			template <typename ConsumerT>
+			int read(ConsumerT&& consumer) {
+				static const char zeros[4096] = {0};
+				const char* data;
+				size_t size;
+				int64_t offset, expected = 0;
+
+				while (read_block(data, size, offset) == ARCHIVE_OK) {
+					while (expected < offset) {
+						size_t gap = (offset - expected) < (int64_t)sizeof(zeros) ? size_t(offset - expected) : sizeof(zeros);
+						consumer(zeros, gap);
+						expected += gap;
 					}
+					if (size > 0)
+						consumer(data, size);
+					expected = offset + size;
+				}
+				return status_ == ARCHIVE_EOF ? (status_ = ARCHIVE_OK) : status_;
+			}
+
+			/**
+			 * @brief read the content of the current entry into the buffer, the buffer
+			 * is cleared first but its capacity is kept so it can be reused across entries
+			 */
+			int read(std::string& buffer) {
+				buffer.clear();
+				if (current_.size > 0)
+					buffer.reserve(current_.size);
+				StringAppender appender(buffer);
+				return read(appender);
+			}
 
-				} // for
+			int skip() {
+				status_ = archive_read_data_skip(a_);
+				if (status_ == ARCHIVE_WARN)
+					status_ = ARCHIVE_OK;
+				return status_;
+			}
 
+			/**
+			 * @brief find the entry with the given base name and read the whole of it,
+			 * the reason of a failure is left in status() / error_string()
+			 */
+			result_type find(const std::string& entryname) {
+				std::string content;
+				while (next() == ARCHIVE_OK) {
+					if (current_.basename() == entryname) {
+						if (read(content) == ARCHIVE_OK)
+							return make_pair(true, content);
+						break;
+					}
+				}
 				return make_pair(false, std::string(""));
 			}
 
+		protected:
+			/**
+			 * @brief enable the filters and formats of a new handle
+			 */
+			virtual void setup() {}
+
 		private:
+			struct StringAppender {
+				std::string& buffer;
+				StringAppender(std::string& b) : buffer(b) {}
+				void operator ()(const char* data, size_t size) { buffer.append(data, size); }
+			};
+
 			void init() {
 				a_ = archive_read_new();
+				entry_ = NULL;
+				status_ = a_ ? ARCHIVE_OK : ARCHIVE_FATAL;
+				opened_ = used_ = false;
+				started_ = at_entry_ = false;
 			}
 
 			void clearup() {
+				if (a_) {
+					if (opened_)
+						archive_read_close(a_);
+					archive_read_free(a_);
+					a_ = NULL;
+				}
+				opened_ = false;
+				started_ = at_entry_ = false;
 			}
 	};
 
 	class TgzArchive: public Archive {
 		public:
 			TgzArchive() : Archive(){
-				init();
+				setup();
 			}
 			~TgzArchive() {}
 
-		private:
-			void init() {
-				archive_read_support_compression_gzip(a_);
+		protected:
+			virtual void setup() {
+				archive_read_support_filter_gzip(a_);
 				archive_read_support_format_tar(a_);
 			}
 
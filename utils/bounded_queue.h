@@ -0,0 +1,98 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_UTILS_BOUNDED_QUEUE_H_
+#define STPL_UTILS_BOUNDED_QUEUE_H_
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace utils {
+
+	/**
+	 * @brief a blocking FIFO queue with a fixed capacity, push() waits while the
+	 * queue is full so a fast producer is held back by slow consumers
+	 *
+	 * close() wakes everyone up; after that push() fails and pop() drains the
+	 * items left before failing.
+	 */
+	template <typename T>
+	class BoundedQueue {
+		private:
+			std::deque<T>				items_;
+			size_t						capacity_;
+			bool						closed_;
+			std::mutex					mutex_;
+			std::condition_variable		not_full_;
+			std::condition_variable		not_empty_;
+
+		public:
+			explicit BoundedQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : 1), closed_(false) {}
+			~BoundedQueue() {}
+
+			bool push(const T& item) {
+				std::unique_lock<std::mutex> lock(mutex_);
+				not_full_.wait(lock, [this]() { return closed_ || items_.size() < capacity_; });
+				if (closed_)
+					return false;
+				items_.push_back(item);
+				not_empty_.notify_one();
+				return true;
+			}
+
+			bool push(T&& item) {
+				std::unique_lock<std::mutex> lock(mutex_);
+				not_full_.wait(lock, [this]() { return closed_ || items_.size() < capacity_; });
+				if (closed_)
+					return false;
+				items_.push_back(std::move(item));
+				not_empty_.notify_one();
+				return true;
+			}
+
+			bool pop(T& item) {
+				std::unique_lock<std::mutex> lock(mutex_);
+				not_empty_.wait(lock, [this]() { return closed_ || !items_.empty(); });
+				if (items_.empty())
+					return false;
+				item = std::move(items_.front());
+				items_.pop_front();
+				not_full_.notify_one();
+				return true;
+			}
+
+			void close() {
+				std::lock_guard<std::mutex> lock(mutex_);
+				closed_ = true;
+				not_full_.notify_all();
+				not_empty_.notify_all();
+			}
+
+			size_t size() {
+				std::lock_guard<std::mutex> lock(mutex_);
+				return items_.size();
+			}
+
+			size_t capacity() const { return capacity_; }
+	};
+}
+
+#endif /* STPL_UTILS_BOUNDED_QUEUE_H_ */
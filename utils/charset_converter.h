@@ -8,141 +8,328 @@
 #include <iconv.h>
 #include <errno.h>
 #include <string.h>
-#include <iconv.h>
+#include <strings.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace stpl
 {
 	enum {BAD = -1, GOOD = 0};
-	
+
+	/**
+	 * @brief whether the n bytes are all ASCII, 16 bytes at a time with SSE2
+	 */
+	inline bool is_ascii(const char* s, size_t n) {
+		size_t i = 0;
+#ifdef __SSE2__
+		for (; i + 16 <= n; i += 16)
+			if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i))))
+				return false;
+#endif
+		for (; i < n; ++i)
+			if ((unsigned char) s[i] >= 0x80)
+				return false;
+		return true;
+	}
+
+	/**
+	 * @brief whether the n bytes are well formed UTF-8, no overlong forms,
+	 * surrogates or code points beyond U+10FFFF; the ASCII runs are skipped
+	 * 16 bytes at a time
+	 */
+	inline bool is_valid_utf8(const char* s, size_t n) {
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(s);
+		const unsigned char* end = p + n;
+		while (p < end) {
+#ifdef __SSE2__
+			while (p + 16 <= end && !_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))))
+				p += 16;
+			if (p == end)
+				break;
+#endif
+			unsigned char c = *p;
+			if (c < 0x80) {
+				++p;
+				continue;
+			}
+
+			size_t len;
+			unsigned char lo = 0x80, hi = 0xBF;	// the range of the second byte
+			if (c >= 0xC2 && c <= 0xDF)
+				len = 2;
+			else if (c >= 0xE0 && c <= 0xEF) {
+				len = 3;
+				if (c == 0xE0)
+					lo = 0xA0;
+				else if (c == 0xED)
+					hi = 0x9F;
+			}
+			else if (c >= 0xF0 && c <= 0xF4) {
+				len = 4;
+				if (c == 0xF0)
+					lo = 0x90;
+				else if (c == 0xF4)
+					hi = 0x8F;
+			}
+			else
+				return false;
+
+			if ((size_t) (end - p) < len || p[1] < lo || p[1] > hi)
+				return false;
+			for (size_t i = 2; i < len; ++i)
+				if ((p[i] & 0xC0) != 0x80)
+					return false;
+			p += len;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief a conversion between two charsets with iconv that can be fed in
+	 * chunks, the output is appended straight to the given string
+	 *
+	 * The conversion descriptor is kept open and reused as long as the charsets
+	 * don't change. A character split between two chunks is carried over to the
+	 * next one. Invalid input is replaced with U+FFFD (or '?' when the target
+	 * is not UTF-8), unless the converter is strict.
+	 */
+	class Transcoder
+	{
+		public:
+			enum { MAX_PENDING = 8 };
+
+		private:
+			iconv_t			cd_;
+			std::string		from_;
+			std::string		to_;
+			std::string		replacement_;
+			bool			strict_;
+			char			pending_[MAX_PENDING];
+			size_t			pending_len_;
+			size_t			invalid_;
+			std::string		error_;
+
+		public:
+			Transcoder() : cd_((iconv_t) -1), strict_(false), pending_len_(0), invalid_(0) {}
+			~Transcoder() { close(); }
+
+			/**
+			 * @return GOOD, or BAD if iconv doesn't know the charsets
+			 */
+			int open(const std::string& from, const std::string& to = "UTF-8") {
+				if (cd_ != (iconv_t) -1 && from == from_ && to == to_) {
+					reset();
+					return GOOD;
+				}
+
+				close();
+				error_.clear();
+				if ((cd_ = iconv_open(to.c_str(), from.c_str())) == (iconv_t) -1) {
+					error_ = "unsupported conversion from " + from + " to " + to;
+					return BAD;
+				}
+				from_ = from;
+				to_ = to;
+				replacement_ = (strcasecmp(to.c_str(), "UTF-8") == 0 || strcasecmp(to.c_str(), "UTF8") == 0) ? "\xEF\xBF\xBD" : "?";
+				reset();
+				return GOOD;
+			}
+
+			void close() {
+				if (cd_ != (iconv_t) -1)
+					iconv_close(cd_);
+				cd_ = (iconv_t) -1;
+				from_.clear();
+				to_.clear();
+			}
+
+			/**
+			 * @brief start a new input with the same charsets
+			 */
+			void reset() {
+				if (cd_ != (iconv_t) -1)
+					iconv(cd_, NULL, NULL, NULL, NULL);
+				pending_len_ = 0;
+				invalid_ = 0;
+			}
+
+			void strict(bool strict) { strict_ = strict; }
+
+			/**
+			 * @brief convert a chunk and append it to out, last is set for the
+			 * last chunk of the input
+			 *
+			 * @return GOOD, or BAD on invalid input in strict mode
+			 */
+			int convert(const char* in, size_t len, std::string& out, bool last = true) {
+				if (cd_ == (iconv_t) -1) {
+					error_ = "no conversion is open";
+					return BAD;
+				}
+
+				// finish the character left over from the previous chunk first
+				if (pending_len_ > 0) {
+					char joined[2 * MAX_PENDING];
+					size_t take = std::min(len, (size_t) MAX_PENDING);
+					size_t joined_len = pending_len_ + take;
+					memcpy(joined, pending_, pending_len_);
+					memcpy(joined + pending_len_, in, take);
+					pending_len_ = 0;
+
+					if (take == len)
+						return finish(joined, joined_len, out, last);
+
+					if (run(joined, joined_len, out, false) == BAD)
+						return BAD;
+					// the bytes left pending are still in this chunk
+					size_t consumed = take;
+					if (pending_len_ > take) {
+						pending_len_ = 0;
+						if (invalid(out) == BAD)
+							return BAD;
+					}
+					else
+						consumed -= pending_len_;
+					pending_len_ = 0;
+					in += consumed;
+					len -= consumed;
+				}
+
+				return finish(in, len, out, last);
+			}
+
+			int convert(const std::string& in, std::string& out) {
+				return convert(in.data(), in.length(), out, true);
+			}
+
+			/**
+			 * @brief the number of invalid sequences replaced since the last reset
+			 */
+			size_t invalid_count() const { return invalid_; }
+
+			const std::string& from() const { return from_; }
+			const std::string& error() const { return error_; }
+
+		private:
+			int finish(const char* in, size_t len, std::string& out, bool last) {
+				if (run(in, len, out, last) == BAD)
+					return BAD;
+
+				if (last) {
+					if (pending_len_ > 0) {
+						pending_len_ = 0;
+						if (invalid(out) == BAD)
+							return BAD;
+					}
+					flush(out);
+				}
+				return GOOD;
+			}
+
+			/**
+			 * convert as much as possible of [in, in + len), an incomplete
+			 * character at the end is kept in pending_ when more is to come
+			 */
+			int run(const char* in, size_t len, std::string& out, bool last) {
+				char* inbuf = const_cast<char*>(in);
+				size_t inleft = len;
+				size_t used = out.size();
+				out.resize(used + len + len / 2 + 16);
+
+				while (inleft > 0) {
+					char* outbuf = &out[used];
+					size_t outleft = out.size() - used;
+					size_t ret = iconv(cd_, &inbuf, &inleft, &outbuf, &outleft);
+					used = outbuf - &out[0];
+					if (ret != (size_t) -1)
+						break;
+
+					if (errno == E2BIG)
+						out.resize(out.size() * 2 + 16);
+					else if (errno == EINVAL) {
+						// an incomplete character at the end of the chunk
+						if (!last && inleft < MAX_PENDING) {
+							memcpy(pending_, inbuf, inleft);
+							pending_len_ = inleft;
+							inleft = 0;
+						}
+						else {
+							// a truncated character at the end of the input
+							out.resize(used);
+							if (invalid(out) == BAD)
+								return BAD;
+							used = out.size();
+							inleft = 0;
+						}
+					}
+					else if (errno == EILSEQ) {
+						out.resize(used);
+						if (invalid(out) == BAD)
+							return BAD;
+						used = out.size();
+						out.resize(used + inleft + 16);
+						++inbuf;
+						--inleft;
+					}
+					else {
+						out.resize(used);
+						error_ = strerror(errno);
+						return BAD;
+					}
+				}
+				out.resize(used);
+				return GOOD;
+			}
+
+			int invalid(std::string& out) {
+				++invalid_;
+				if (strict_) {
+					error_ = "invalid " + from_ + " input";
+					return BAD;
+				}
+				out.append(replacement_);
+				return GOOD;
+			}
+
+			/**
+			 * write out any shift state of a stateful target charset
+			 */
+			void flush(std::string& out) {
+				char buf[32];
+				char* outbuf = buf;
+				size_t outleft = sizeof(buf);
+				if (iconv(cd_, NULL, NULL, &outbuf, &outleft) != (size_t) -1)
+					out.append(buf, outbuf - buf);
+			}
+	};
+
 	template <typename StringT = std::string, typename IteratorT = typename StringT::iterator>
 	class CharsetConverter
 	{
-		public:			
+		public:
 			CharsetConverter(const StringT &from, const StringT &to) {}
 			~CharsetConverter() {}
-			
-			static int convert(char *fromcode, char *tocode, StringT& input, StringT& output) {
-			    iconv_t cd;                     /* conversion descriptor */
-			    //char *table;           /* ptr to translation table */
-			    int bytesread;                  /* num bytes read into input buffer */
-			    char inbuf[BUFSIZ];    /* input buffer */
-			    char *inchar;          /* ptr to input character */
-			    size_t inbytesleft;                /* num bytes left in input buffer */
-			    char outbuf[BUFSIZ];   /* output buffer */
-			    char *outchar;         /* ptr to output character */
-			    size_t outbytesleft;               /* num bytes left in output buffer */
-			    size_t ret_val;                 /* number of conversions */
-			    IteratorT begin_pos;
-			    IteratorT end_pos;
-			    IteratorT cur_pos = input.begin();
-			
-			    /* Initiate conversion -- get conversion descriptor */
-			    if ((cd = iconv_open(tocode, fromcode)) == (iconv_t)-1) {
-			        printf("iconv_open false: %s ==> %s\n", fromcode, tocode);
-			    }
-			
-			    inbytesleft = 0;                        /* no. of bytes converted */
-			    //begin_pos = input.begin();
-			    /* translate the characters */
-			    do {
-	                /*
-	                 * if any bytes are leftover, they will be in the
-	                 * beginning of the buffer on the next read().
-	                 */
-	
-	                inchar = inbuf;          /* points to input buffer */
-	                outchar = outbuf;        /* points to output buffer */
-	                outbytesleft = BUFSIZ;   /* no of bytes to be converted */
-	                
-	                /*
-	                if ((bytesread = read(Input, inbuf+inbytesleft,
-	                                      (size_t)BUFSIZ-inbytesleft)) < 0) {
-	                        perror("prog");
-	                        return BAD;
-	                }
-	                */
-	                
-	                if (inbytesleft < input.length())
-	                	begin_pos = cur_pos + inbytesleft;
-	                else
-	                	break;
-	                	//begin_pos = input.end();
-	                	
-	                if (BUFSIZ > input.length()) {
-	                	end_pos = cur_pos = input.end();
-	                }
-	                else {
-	                	end_pos = begin_pos + (BUFSIZ-inbytesleft);
-	                	cur_pos = end_pos++;
-	                }
-	                	
-	                bytesread = end_pos - begin_pos;
-	                inbytesleft = bytesread;
-	
-	                copy(begin_pos, end_pos, inbuf);
-	                
-	
-	                //cout << "(inbytesleft:" << inbytesleft << ":" << bytesread << ")" << inchar; 
-	                ret_val = iconv(cd, &inchar, &inbytesleft,
-	                                &outchar, &outbytesleft);
-	
-					/*
-	                if (write(1, outbuf, (size_t)BUFSIZ-outbytesleft) < 0) {
-	                        perror("prog");
-	                        return BAD;
-	                }
-	                */
-	                //cout << outchar;
-	                output.append(outbuf, (size_t)BUFSIZ-outbytesleft);
-	                
-	                /* iconv() returns the number of non-identical conversions
-	                 * performed. If the entire string in the input buffer is
-	                 * converted, the value pointed to by inbytesleft will be
-	                 * zero. If the conversion stopped due to any reason, the
-	                 * value pointed to by inbytesleft will be non-zero and
-	                 * errno is set to indicate the condition.
-	                 */
-	                if (((int)ret_val == -1) && (errno == EINVAL)) {
-	                        /* Input conversion stopped due to an incomplete
-	                         * character or shift sequence at the end of the
-	                         * input buffer.
-	                         */
-	                        /* Copy data left, to the start of buffer */
-	                        memcpy((char *)inbuf, (char *)inchar,
-	                               (size_t)inbytesleft);
-	                } else if (((int)ret_val == -1) && (errno == EILSEQ)) {
-	                        /* Input conversion stopped due to an input byte
-	                         * that does not belong to the input codeset.
-	                         */
-	                        //error(FATAL, BAD_CONVERSION);
-	                        //printf("bad conversion. \n");
-	                        memcpy((char *)inbuf, (char *)inchar,
-	                               (size_t)inbytesleft);	   
-	                        return BAD;                     
-	                } else if (((int)ret_val == -1) && (errno == E2BIG)) {
-	                        /* Input conversion stopped due to lack of space
-	                         * in the output buffer. inbytesleft has the
-	                         * number of bytes to be converted.
-	                         */
-	                        memcpy((char *)inbuf, (char *)inchar,
-	                               (size_t)inbytesleft);
-	                }
-	                
-	                if (inbytesleft >= input.length()) {
-	                        break;           /* end of conversions */
-	                }
-	                                
-	                /* Go back and read from the input file. */
-		        } while (cur_pos != input.end());        
-		
-		        /* end conversion & get rid of the conversion table */
-		        if (iconv_close(cd) == BAD) {
-		             //   error(FATAL, BAD_CLOSE);
-		             printf("error in closing iconv. \n");
-		        }
-		        return GOOD;
-			
+
+			/**
+			 * @brief convert the whole input, which has to be valid in fromcode
+			 *
+			 * @return GOOD, or BAD if the conversion is not supported or the
+			 * input is invalid
+			 */
+			static int convert(const char *fromcode, const char *tocode, StringT& input, StringT& output) {
+				Transcoder transcoder;
+				transcoder.strict(true);
+				if (transcoder.open(fromcode, tocode) == BAD)
+					return BAD;
+
+				std::string converted;
+				std::string source(input.begin(), input.end());
+				if (transcoder.convert(source, converted) == BAD)
+					return BAD;
+				output.append(converted.begin(), converted.end());
+				return GOOD;
 			}
 
 	};
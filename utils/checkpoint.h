@@ -0,0 +1,181 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_UTILS_CHECKPOINT_H_
+#define STPL_UTILS_CHECKPOINT_H_
+
+#include <string>
+#include <map>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+namespace utils {
+
+	/**
+	 * @brief the progress of a long running batch job: for each input the byte
+	 * offset right after the last record fully emitted, and for each output file
+	 * its size at that point
+	 *
+	 * An input compressed in independent streams, e.g. a multistream bz2 dump,
+	 * also has the compressed offset of the stream the record ends in, its
+	 * offset is then the one in that stream.
+	 *
+	 * A restarted job seeks each input to its offset and cuts each output back to
+	 * its recorded size, so the records after the checkpoint are produced again
+	 * exactly once. The file is replaced atomically, a crash while saving leaves
+	 * the previous checkpoint in place.
+	 */
+	class Checkpoint {
+		public:
+			enum { CHECKPOINT_OK = 0, CHECKPOINT_NONE = 1, CHECKPOINT_ERROR = -1 };
+
+			typedef std::map<std::string, long long>	position_map;
+
+		private:
+			std::string		filename_;
+			position_map	inputs_;
+			position_map	streams_;
+			position_map	outputs_;
+			long long		records_;
+
+		public:
+			Checkpoint(const std::string& filename = "") : filename_(filename), records_(0) {}
+			~Checkpoint() {}
+
+			const std::string& filename() const { return filename_; }
+
+			long long records() const { return records_; }
+			void records(long long records) { records_ = records; }
+
+			long long input(const std::string& name) const { return find(inputs_, name); }
+			void input(const std::string& name, long long offset) { inputs_[name] = offset; }
+
+			long long stream(const std::string& name) const { return find(streams_, name); }
+			void stream(const std::string& name, long long offset) { streams_[name] = offset; }
+
+			long long output(const std::string& name) const { return find(outputs_, name); }
+			void output(const std::string& name, long long position) { outputs_[name] = position; }
+
+			const position_map& inputs() const { return inputs_; }
+			const position_map& outputs() const { return outputs_; }
+
+			void clear() {
+				inputs_.clear();
+				streams_.clear();
+				outputs_.clear();
+				records_ = 0;
+			}
+
+			void clear_outputs() { outputs_.clear(); }
+
+			/**
+			 * @return CHECKPOINT_NONE if there is no checkpoint to resume from
+			 */
+			int load() {
+				clear();
+				FILE* fp = fopen(filename_.c_str(), "r");
+				if (!fp)
+					return CHECKPOINT_NONE;
+
+				char line[4096];
+				int ret = CHECKPOINT_OK;
+				while (fgets(line, sizeof(line), fp)) {
+					char* value = strchr(line, '\t');
+					char* name = value ? strchr(value + 1, '\t') : NULL;
+					if (!value) {
+						ret = CHECKPOINT_ERROR;
+						break;
+					}
+					*value++ = '\0';
+					if (name) {
+						*name++ = '\0';
+						size_t len = strlen(name);
+						if (len > 0 && name[len - 1] == '\n')
+							name[len - 1] = '\0';
+					}
+
+					if (strcmp(line, "records") == 0)
+						records_ = atoll(value);
+					else if (strcmp(line, "input") == 0 && name)
+						inputs_[name] = atoll(value);
+					else if (strcmp(line, "stream") == 0 && name)
+						streams_[name] = atoll(value);
+					else if (strcmp(line, "output") == 0 && name)
+						outputs_[name] = atoll(value);
+					else {
+						ret = CHECKPOINT_ERROR;
+						break;
+					}
+				}
+				fclose(fp);
+				return ret;
+			}
+
+			/**
+			 * @brief write the checkpoint to a temporary file and rename it over the old one
+			 */
+			int save() const {
+				std::string tmp = filename_ + ".tmp";
+				FILE* fp = fopen(tmp.c_str(), "w");
+				if (!fp)
+					return CHECKPOINT_ERROR;
+
+				fprintf(fp, "records\t%lld\n", records_);
+				position_map::const_iterator it;
+				for (it = inputs_.begin(); it != inputs_.end(); ++it)
+					fprintf(fp, "input\t%lld\t%s\n", it->second, it->first.c_str());
+				for (it = streams_.begin(); it != streams_.end(); ++it)
+					fprintf(fp, "stream\t%lld\t%s\n", it->second, it->first.c_str());
+				for (it = outputs_.begin(); it != outputs_.end(); ++it)
+					fprintf(fp, "output\t%lld\t%s\n", it->second, it->first.c_str());
+
+				bool ok = fflush(fp) == 0 && fsync(fileno(fp)) == 0;
+				ok = (fclose(fp) == 0) && ok;
+				if (!ok || rename(tmp.c_str(), filename_.c_str()) != 0) {
+					unlink(tmp.c_str());
+					return CHECKPOINT_ERROR;
+				}
+				return CHECKPOINT_OK;
+			}
+
+			/**
+			 * @brief cut the recorded output files back to their checkpoint size, the
+			 * data written after the checkpoint is dropped
+			 */
+			int restore_outputs() const {
+				for (position_map::const_iterator it = outputs_.begin(); it != outputs_.end(); ++it)
+					if (truncate(it->first.c_str(), it->second) != 0)
+						return CHECKPOINT_ERROR;
+				return CHECKPOINT_OK;
+			}
+
+		private:
+			static long long find(const position_map& positions, const std::string& name) {
+				position_map::const_iterator it = positions.find(name);
+				return it == positions.end() ? 0 : it->second;
+			}
+	};
+}
+
+#endif /* STPL_UTILS_CHECKPOINT_H_ */
@@ -0,0 +1,226 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_UTILS_DATRIE_H_
+#define STPL_UTILS_DATRIE_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace utils {
+
+	/**
+	 * @brief a static byte trie in a double array, for the longest match of a
+	 * set of keys at a position of a text
+	 *
+	 * A state s goes on with the byte c to t = base[s] + c + 1 if check[t] is s,
+	 * so a match costs two array reads a byte whatever the number of keys. The
+	 * trie is built once from all the keys and can't be added to afterwards.
+	 */
+	class DoubleArrayTrie {
+		public:
+			typedef std::pair<std::string, int32_t>		entry_type;
+
+			enum { NO_VALUE = -1 };
+
+		private:
+			std::vector<int32_t>		base_;
+			std::vector<int32_t>		check_;
+			std::vector<int32_t>		value_;		/// the value of the key ending at a state, NO_VALUE if none
+			bool						first_[256];	/// the bytes a key can start with
+			size_t						next_free_;
+			size_t						size_;
+
+		public:
+			DoubleArrayTrie() { clear(); }
+			~DoubleArrayTrie() {}
+
+			/**
+			 * @brief build the trie from the keys and their values, a value is
+			 * not negative; if a key is given twice, the last value is kept
+			 */
+			void build(std::vector<entry_type> entries) {
+				clear();
+				// stable, so the last of the duplicates is the last one given
+				std::stable_sort(entries.begin(), entries.end(),
+						[](const entry_type& a, const entry_type& b) { return a.first < b.first; });
+				std::vector<entry_type> keys;
+				keys.reserve(entries.size());
+				for (size_t i = 0; i < entries.size(); ++i) {
+					if (entries[i].first.empty() || entries[i].second < 0)
+						continue;
+					if (!keys.empty() && keys.back().first == entries[i].first)
+						keys.back().second = entries[i].second;
+					else
+						keys.push_back(entries[i]);
+				}
+				size_ = keys.size();
+				for (size_t i = 0; i < keys.size(); ++i)
+					first_[(unsigned char) keys[i].first[0]] = true;
+
+				resize(256 + 1);
+				check_[0] = 0;
+				next_free_ = 1;
+				if (!keys.empty())
+					insert(keys, 0, keys.size(), 0, 0);
+
+				// the states past the last one used can't be reached
+				size_t used = check_.size();
+				while (used > 1 && check_[used - 1] < 0)
+					--used;
+				base_.resize(used + 256 + 1, 0);
+				check_.resize(used + 256 + 1, -1);
+				value_.resize(used + 256 + 1, NO_VALUE);
+			}
+
+			/**
+			 * @brief the value of the longest key that [begin, end) starts with
+			 *
+			 * @param length the length of the key, left alone if there is none
+			 * @return NO_VALUE if no key matches
+			 */
+			int32_t longest_match(const char* begin, const char* end, size_t& length) const {
+				int32_t found = NO_VALUE;
+				if (begin >= end || !first_[(unsigned char) *begin])
+					return found;
+				size_t state = 0;
+				for (const char* p = begin; p < end; ++p) {
+					size_t next = (size_t) base_[state] + (unsigned char) *p + 1;
+					if ((int32_t) state != check_[next])
+						break;
+					state = next;
+					if (value_[state] != NO_VALUE) {
+						found = value_[state];
+						length = p + 1 - begin;
+					}
+				}
+				return found;
+			}
+
+			/**
+			 * @brief whether a key starts with the byte, to skip the text that
+			 * can't match quickly
+			 */
+			bool starts_with(char c) const {
+				return first_[(unsigned char) c];
+			}
+
+			size_t size() const {
+				return size_;
+			}
+
+			/**
+			 * @brief the bytes of the arrays
+			 */
+			size_t bytes() const {
+				return base_.size() * sizeof(int32_t) * 3;
+			}
+
+			void clear() {
+				base_.assign(256 + 1, 0);
+				check_.assign(256 + 1, -1);
+				value_.assign(256 + 1, NO_VALUE);
+				for (size_t i = 0; i < 256; ++i)
+					first_[i] = false;
+				next_free_ = 1;
+				size_ = 0;
+			}
+
+		private:
+			void resize(size_t size) {
+				if (size <= check_.size())
+					return;
+				size_t capacity = check_.size();
+				while (capacity < size)
+					capacity *= 2;
+				base_.resize(capacity, 0);
+				check_.resize(capacity, -1);
+				value_.resize(capacity, NO_VALUE);
+			}
+
+			/**
+			 * the keys [lo, hi) share their first depth bytes and lead to state
+			 */
+			void insert(const std::vector<entry_type>& keys, size_t lo, size_t hi, size_t depth, size_t state) {
+				if (keys[lo].first.length() == depth) {
+					value_[state] = keys[lo].second;
+					++lo;
+				}
+				if (lo == hi)
+					return;
+
+				// the bytes that follow, the keys are sorted so they come in order
+				unsigned char bytes[256];
+				size_t ranges[257];
+				size_t count = 0;
+				for (size_t i = lo; i < hi; ++i) {
+					unsigned char c = keys[i].first[depth];
+					if (count == 0 || bytes[count - 1] != c) {
+						bytes[count] = c;
+						ranges[count++] = i;
+					}
+				}
+				ranges[count] = hi;
+
+				// the first base where all of them are free; the cells scanned
+				// over are mostly used, the next search starts after them
+				size_t first = bytes[0] + 1;
+				size_t position = next_free_ > first ? next_free_ : first;
+				size_t used = 0;
+				bool first_free = true;
+				size_t base;
+				while (true) {
+					resize(position + 256 + 1);
+					if (check_[position] >= 0) {
+						++used;
+						++position;
+						continue;
+					}
+					if (first_free) {
+						next_free_ = position;
+						first_free = false;
+					}
+					base = position - first;
+					size_t i = 1;
+					while (i < count && check_[base + bytes[i] + 1] < 0)
+						++i;
+					if (i == count)
+						break;
+					++position;
+				}
+				if (used * 20 >= (position - next_free_ + 1) * 19)
+					next_free_ = position;
+
+				base_[state] = (int32_t) base;
+				for (size_t i = 0; i < count; ++i)
+					check_[base + bytes[i] + 1] = (int32_t) state;
+
+				for (size_t i = 0; i < count; ++i)
+					insert(keys, ranges[i], ranges[i + 1], depth + 1, base + bytes[i] + 1);
+			}
+	};
+}
+
+#endif /* STPL_UTILS_DATRIE_H_ */
@@ -6,6 +6,10 @@
 #include <cctype>
 #include <functional>
 #include <strings.h>
+#include <cstring>
+#include <cstddef>
+
+#include "simd.h"
 
 #ifdef _MSC_VER
 #define CICOMPARE(a, b) (stricmp((a), (b)))
@@ -60,11 +64,205 @@ std::ostream& operator << (std::ostream& strm, const icstring& s)
     return strm << std::string(s.data(),s.length());
 }
 
+/* a case-insensitive, non-owning view of a character range
+ *
+ * the view points into the parsed text, so building a name, an attribute or a
+ * text value costs no allocation and no copy; the text has to outlive the
+ * views taken from it, as with the iterators of the parser. A view that gets
+ * modified (append, insert, erase, ...) takes a private copy of its characters
+ * first and owns them from then on.
+ *
+ * comparisons fold ASCII case only, which is what HTML names need
+ */
+class icstring_view
+{
+public:
+    typedef char                value_type;
+    typedef std::size_t         size_type;
+    typedef std::ptrdiff_t      difference_type;
+    typedef const char*         iterator;
+    typedef const char*         const_iterator;
+    typedef const char&         reference;
+    typedef const char&         const_reference;
+
+    static const size_type npos = static_cast<size_type>(-1);
+
+private:
+    const char*             data_;
+    size_type               size_;
+    bool                    owned_;
+    std::string             storage_;
+
+public:
+    icstring_view() : data_(""), size_(0), owned_(false) {}
+    icstring_view(const char* s) : data_(s ? s : ""), size_(s ? std::strlen(s) : 0), owned_(false) {}
+    icstring_view(const char* s, size_type n) : data_(s), size_(n), owned_(false) {}
+    icstring_view(size_type n, char c) : owned_(true), storage_(n, c) { sync(); }
+    icstring_view(const std::string& s) : owned_(true), storage_(s) { sync(); }
+    icstring_view(const icstring& s) : owned_(true), storage_(s.data(), s.length()) { sync(); }
+
+    /* a view of [begin, end), the iterators have to be contiguous
+     * (pointers, string or vector iterators)
+     */
+    template <typename IteratorT>
+    icstring_view(IteratorT begin, IteratorT end) : owned_(false) {
+        size_ = end - begin;
+        data_ = size_ > 0 ? &*begin : "";
+    }
+
+    icstring_view(const icstring_view& other) : data_(other.data_), size_(other.size_), owned_(other.owned_) {
+        if (owned_) {
+            storage_ = other.storage_;
+            sync();
+        }
+    }
+
+    icstring_view& operator= (const icstring_view& other) {
+        if (this != &other) {
+            owned_ = other.owned_;
+            if (owned_) {
+                storage_ = other.storage_;
+                sync();
+            }
+            else {
+                storage_.clear();
+                data_ = other.data_;
+                size_ = other.size_;
+            }
+        }
+        return *this;
+    }
+
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+    size_type size() const { return size_; }
+    size_type length() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const char* data() const { return data_; }
+    const char& operator[] (size_type pos) const { return data_[pos]; }
+
+    /* a view is not necessarily null terminated, so this takes a copy of it
+     * and owns it from then on; not const, so a view shared between threads
+     * is never changed behind their back, copy it or use str() instead
+     */
+    const char* c_str() {
+        own();
+        sync();
+        return storage_.c_str();
+    }
+
+    std::string str() const { return std::string(data_, size_); }
+
+    int compare(const icstring_view& other) const {
+        return utils::ascii_icompare(data_, size_, other.data_, other.size_);
+    }
+
+    size_type find(char c, size_type pos = 0) const {
+        for (; pos < size_; ++pos)
+            if (utils::ascii_lower(data_[pos]) == utils::ascii_lower(c))
+                return pos;
+        return npos;
+    }
+
+    size_type find(const icstring_view& what, size_type pos = 0) const {
+        if (what.size_ > size_)
+            return npos;
+        for (; pos + what.size_ <= size_; ++pos)
+            if (utils::ascii_iequals(data_ + pos, what.data_, what.size_))
+                return pos;
+        return npos;
+    }
+
+    icstring_view substr(size_type pos = 0, size_type n = npos) const {
+        if (pos > size_)
+            pos = size_;
+        if (n > size_ - pos)
+            n = size_ - pos;
+        if (owned_)
+            return icstring_view(std::string(data_ + pos, n));
+        return icstring_view(data_ + pos, n);
+    }
+
+    icstring_view& append(const char* s, size_type n) { own(); storage_.append(s, n); return sync(); }
+    icstring_view& append(const icstring_view& s) { return append(s.data_, s.size_); }
+    icstring_view& append(const char* s) { return append(s, std::strlen(s)); }
+    icstring_view& append(size_type n, char c) { own(); storage_.append(n, c); return sync(); }
+    icstring_view& operator+= (const icstring_view& s) { return append(s); }
+    icstring_view& operator+= (char c) { push_back(c); return *this; }
+    void push_back(char c) { own(); storage_.push_back(c); sync(); }
+
+    icstring_view& insert(size_type pos, const icstring_view& s) {
+        own();
+        storage_.insert(pos, s.data_, s.size_);
+        return sync();
+    }
+
+    icstring_view& erase(size_type pos = 0, size_type n = npos) {
+        own();
+        storage_.erase(pos, n);
+        return sync();
+    }
+
+    icstring_view& replace(size_type pos, size_type n, const icstring_view& s) {
+        own();
+        storage_.replace(pos, n, s.data_, s.size_);
+        return sync();
+    }
+
+    void clear() {
+        storage_.clear();
+        owned_ = false;
+        data_ = "";
+        size_ = 0;
+    }
+
+    friend bool operator== (const icstring_view& x, const icstring_view& y) {
+        return x.size_ == y.size_ && utils::ascii_iequals(x.data_, y.data_, x.size_);
+    }
+    friend bool operator!= (const icstring_view& x, const icstring_view& y) { return !(x == y); }
+    friend bool operator< (const icstring_view& x, const icstring_view& y) { return x.compare(y) < 0; }
+    friend bool operator> (const icstring_view& x, const icstring_view& y) { return y.compare(x) < 0; }
+    friend bool operator<= (const icstring_view& x, const icstring_view& y) { return !(y < x); }
+    friend bool operator>= (const icstring_view& x, const icstring_view& y) { return !(x < y); }
+
+private:
+    void own() {
+        if (!owned_) {
+            storage_.assign(data_, size_);
+            owned_ = true;
+        }
+    }
+
+    icstring_view& sync() {
+        data_ = storage_.data();
+        size_ = storage_.size();
+        return *this;
+    }
+};
+
+inline
+std::ostream& operator << (std::ostream& strm, const icstring_view& s)
+{
+    return strm.write(s.data(), s.size());
+}
+
+struct icstring_view_hash
+{
+    std::size_t operator() (const icstring_view& s) const
+        { return utils::ascii_ihash(s.data(), s.size()); }
+};
+
+/* a strict weak ordering for the maps keyed by case-insensitive strings,
+ * the ordering also has to agree with the equality of the string type
+ */
 struct ignorcase_string_compare
-    : public std::binary_function<icstring, icstring, bool>
 {
     bool operator() (const icstring& x, const icstring& y) const
-        { return CICOMPARE(x.c_str(), y.c_str()); }
+        { return utils::ascii_icompare(x.data(), x.length(), y.data(), y.length()) < 0; }
+    bool operator() (const icstring_view& x, const icstring_view& y) const
+        { return x.compare(y) < 0; }
+    bool operator() (const std::string& x, const std::string& y) const
+        { return utils::ascii_icompare(x.data(), x.length(), y.data(), y.length()) < 0; }
 };
 
 #endif    // ICSTRING_HPP
@@ -0,0 +1,175 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+
+#ifndef STPL_UTILS_INTERN_H_
+#define STPL_UTILS_INTERN_H_
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace utils {
+
+	/**
+	 * @brief a table of unique strings, each one is stored once and known by
+	 * a 32 bit id from then on
+	 *
+	 * The strings are kept back to back in one pool, each followed by a NUL,
+	 * and looked up through an open addressing table of the ids. Nothing is
+	 * allocated for a string that has been seen before.
+	 */
+	class StringInterner {
+		public:
+			typedef uint32_t		id_type;
+
+			static const id_type	NO_ID = 0xffffffffu;
+
+		private:
+			std::string				pool_;
+			std::vector<size_t>		offsets_;		/// where each string starts in the pool
+			std::vector<uint32_t>	hashes_;
+			std::vector<id_type>	slots_;
+			size_t					mask_;
+
+		public:
+			StringInterner() { clear(); }
+			~StringInterner() {}
+
+			/**
+			 * @return the id of the string, a new one if it hasn't been seen
+			 */
+			id_type intern(const char* s, size_t length) {
+				uint32_t hash = hash_of(s, length);
+				size_t slot = lookup(s, length, hash);
+				if (slots_[slot] != NO_ID)
+					return slots_[slot];
+
+				id_type id = (id_type) offsets_.size();
+				offsets_.push_back(pool_.size());
+				hashes_.push_back(hash);
+				pool_.append(s, length);
+				pool_.push_back('\0');
+				slots_[slot] = id;
+
+				// at most half full
+				if (2 * offsets_.size() > slots_.size())
+					rehash(2 * slots_.size());
+				return id;
+			}
+
+			id_type intern(const std::string& s) {
+				return intern(s.data(), s.length());
+			}
+
+			/**
+			 * @return the id of the string, NO_ID if it hasn't been interned
+			 */
+			id_type find(const char* s, size_t length) const {
+				return slots_[lookup(s, length, hash_of(s, length))];
+			}
+
+			id_type find(const std::string& s) const {
+				return find(s.data(), s.length());
+			}
+
+			/**
+			 * @brief the NUL terminated string of an id, it is only valid until
+			 * the next string is interned
+			 */
+			const char* data(id_type id) const {
+				return pool_.data() + offsets_[id];
+			}
+
+			size_t length(id_type id) const {
+				size_t next = id + 1 < offsets_.size() ? offsets_[id + 1] : pool_.size();
+				return next - offsets_[id] - 1;
+			}
+
+			std::string str(id_type id) const {
+				return std::string(data(id), length(id));
+			}
+
+			size_t size() const {
+				return offsets_.size();
+			}
+
+			/**
+			 * @brief the bytes taken by the strings
+			 */
+			size_t bytes() const {
+				return pool_.size();
+			}
+
+			/**
+			 * @brief forget all the strings, the memory is kept for reuse
+			 */
+			void clear() {
+				pool_.clear();
+				offsets_.clear();
+				hashes_.clear();
+				slots_.assign(64, (id_type) NO_ID);
+				mask_ = slots_.size() - 1;
+			}
+
+		private:
+			/**
+			 * FNV-1a
+			 */
+			static uint32_t hash_of(const char* s, size_t length) {
+				uint32_t hash = 2166136261u;
+				for (size_t i = 0; i < length; ++i) {
+					hash ^= (unsigned char) s[i];
+					hash *= 16777619u;
+				}
+				return hash;
+			}
+
+			/**
+			 * the slot of the string, or the empty slot it would go in
+			 */
+			size_t lookup(const char* s, size_t length, uint32_t hash) const {
+				size_t slot = hash & mask_;
+				while (slots_[slot] != NO_ID) {
+					id_type id = slots_[slot];
+					if (hashes_[id] == hash && this->length(id) == length && memcmp(data(id), s, length) == 0)
+						break;
+					slot = (slot + 1) & mask_;
+				}
+				return slot;
+			}
+
+			void rehash(size_t size) {
+				slots_.assign(size, (id_type) NO_ID);
+				mask_ = size - 1;
+				for (id_type id = 0; id < offsets_.size(); ++id) {
+					size_t slot = hashes_[id] & mask_;
+					while (slots_[slot] != NO_ID)
+						slot = (slot + 1) & mask_;
+					slots_[slot] = id;
+				}
+			}
+	};
+}
+
+#endif /* STPL_UTILS_INTERN_H_ */
@@ -0,0 +1,308 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+
+#ifndef STPL_UTILS_SIMD_H_
+#define STPL_UTILS_SIMD_H_
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Byte scanning helpers for the parsers, 16 bytes at a time with SSE2 where
+ * available and a plain loop (or the libc routine) otherwise
+ */
+namespace utils {
+
+	inline char ascii_lower(char c) {
+		return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+	}
+
+#ifdef __SSE2__
+	inline unsigned int count_trailing_zeros(unsigned int mask) {
+		return __builtin_ctz(mask);
+	}
+
+	/**
+	 * @brief lower case the ASCII letters of 16 bytes, the bytes above 0x7f
+	 * compare as negative and are left alone
+	 */
+	inline __m128i ascii_lower(__m128i x) {
+		__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)),
+				_mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+		return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+	}
+#endif
+
+	/**
+	 * @brief the number of leading bytes of a and b that are equal ignoring
+	 * ASCII case, at most n
+	 */
+	inline size_t ascii_imismatch(const char* a, const char* b, size_t n) {
+		size_t i = 0;
+#ifdef __SSE2__
+		for (; i + 16 <= n; i += 16) {
+			__m128i x = ascii_lower(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+			__m128i y = ascii_lower(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+			unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xffff;
+			if (mask)
+				return i + count_trailing_zeros(mask);
+		}
+#endif
+		for (; i < n; ++i)
+			if (ascii_lower(a[i]) != ascii_lower(b[i]))
+				break;
+		return i;
+	}
+
+	/**
+	 * @brief ASCII case-insensitive comparison of n bytes
+	 */
+	inline bool ascii_iequals(const char* a, const char* b, size_t n) {
+		return ascii_imismatch(a, b, n) == n;
+	}
+
+	/**
+	 * @brief ASCII case-insensitive three way comparison of two byte ranges,
+	 * the bytes compare as unsigned
+	 */
+	inline int ascii_icompare(const char* a, size_t a_len, const char* b, size_t b_len) {
+		size_t n = a_len < b_len ? a_len : b_len;
+		size_t i = ascii_imismatch(a, b, n);
+		if (i < n) {
+			unsigned char x = ascii_lower(a[i]), y = ascii_lower(b[i]);
+			return x < y ? -1 : 1;
+		}
+		return a_len < b_len ? -1 : (a_len > b_len ? 1 : 0);
+	}
+
+	/**
+	 * @brief FNV-1a hash of the lower cased bytes, for the case-insensitive
+	 * containers
+	 */
+	inline size_t ascii_ihash(const char* s, size_t n) {
+		size_t h = 2166136261u;
+		for (size_t i = 0; i < n; ++i) {
+			h ^= (unsigned char) ascii_lower(s[i]);
+			h *= 16777619u;
+		}
+		return h;
+	}
+
+	/**
+	 * @brief the first occurrence of c in [begin, end), end if there is none
+	 */
+	inline const char* find_char(const char* begin, const char* end, char c) {
+		const char* p = begin < end ? static_cast<const char*>(memchr(begin, c, end - begin)) : NULL;
+		return p ? p : end;
+	}
+
+	/**
+	 * @brief the first byte of [begin, end) that is one of the n bytes of set,
+	 * end if there is none; meant for the handful of special bytes of a
+	 * scanner or an escaper, at most 8 are compared 16 bytes at a time
+	 */
+	inline const char* find_any(const char* begin, const char* end, const char* set, size_t n) {
+		const char* p = begin;
+		if (n == 1)
+			return find_char(begin, end, set[0]);
+#ifdef __SSE2__
+		if (n <= 8) {
+			__m128i needles[8];
+			for (size_t i = 0; i < n; ++i)
+				needles[i] = _mm_set1_epi8(set[i]);
+			for (; p + 16 <= end; p += 16) {
+				__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				__m128i hit = _mm_cmpeq_epi8(x, needles[0]);
+				for (size_t i = 1; i < n; ++i)
+					hit = _mm_or_si128(hit, _mm_cmpeq_epi8(x, needles[i]));
+				unsigned int mask = _mm_movemask_epi8(hit);
+				if (mask)
+					return p + count_trailing_zeros(mask);
+			}
+		}
+#endif
+		for (; p < end; ++p)
+			if (memchr(set, *p, n))
+				return p;
+		return end;
+	}
+
+	/**
+	 * @brief the first byte of [begin, end) above 0x7f, end if the range is
+	 * all ASCII
+	 */
+	inline const char* find_non_ascii(const char* begin, const char* end) {
+		const char* p = begin;
+#ifdef __SSE2__
+		for (; p + 16 <= end; p += 16) {
+			unsigned int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+			if (mask)
+				return p + count_trailing_zeros(mask);
+		}
+#endif
+		while (p < end && (unsigned char) *p < 0x80)
+			++p;
+		return p;
+	}
+
+	/**
+	 * @brief a fixed set of bytes, e.g. the markup bytes of a scanner, with a
+	 * table lookup for a single byte and a search for the first member in a
+	 * range that compares up to MAX_VECTOR bytes 16 bytes at a time
+	 */
+	class ByteSet {
+		public:
+			enum { MAX_VECTOR = 24 };
+
+		private:
+			bool				table_[256];
+			size_t				size_;
+#ifdef __SSE2__
+			__m128i				needles_[MAX_VECTOR];
+#endif
+
+		public:
+			explicit ByteSet(const char* set) : size_(0) {
+				memset(table_, 0, sizeof(table_));
+				for (; *set; ++set)
+					add(*set);
+			}
+
+			void add(char c) {
+				if (table_[(unsigned char) c])
+					return;
+				table_[(unsigned char) c] = true;
+#ifdef __SSE2__
+				if (size_ < MAX_VECTOR)
+					needles_[size_] = _mm_set1_epi8(c);
+#endif
+				++size_;
+			}
+
+			bool contains(char c) const {
+				return table_[(unsigned char) c];
+			}
+
+			size_t size() const {
+				return size_;
+			}
+
+			/**
+			 * @brief the first byte of [begin, end) in the set, end if there is none
+			 */
+			const char* find(const char* begin, const char* end) const {
+				const char* p = begin;
+#ifdef __SSE2__
+				if (size_ <= MAX_VECTOR) {
+					for (; p + 16 <= end; p += 16) {
+						__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+						__m128i hit = _mm_setzero_si128();
+						for (size_t i = 0; i < size_; ++i)
+							hit = _mm_or_si128(hit, _mm_cmpeq_epi8(x, needles_[i]));
+						unsigned int mask = _mm_movemask_epi8(hit);
+						if (mask)
+							return p + count_trailing_zeros(mask);
+					}
+				}
+#endif
+				while (p < end && !table_[(unsigned char) *p])
+					++p;
+				return p;
+			}
+	};
+
+	/**
+	 * @brief the first byte of [begin, end) that has to be escaped in a JSON
+	 * string: a quote, a backslash or a control character
+	 */
+	inline const char* find_json_special(const char* begin, const char* end) {
+		const char* p = begin;
+#ifdef __SSE2__
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+		const __m128i control = _mm_set1_epi8(0x1f);
+		for (; p + 16 <= end; p += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i hit = _mm_or_si128(_mm_cmpeq_epi8(x, quote), _mm_cmpeq_epi8(x, backslash));
+			// unsigned x <= 0x1f
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_max_epu8(x, control), control));
+			unsigned int mask = _mm_movemask_epi8(hit);
+			if (mask)
+				return p + count_trailing_zeros(mask);
+		}
+#endif
+		for (; p < end; ++p)
+			if (*p == '"' || *p == '\\' || (unsigned char) *p < 0x20)
+				return p;
+		return end;
+	}
+
+	/**
+	 * @brief the first "</" in [begin, end), end if there is none
+	 */
+	inline const char* find_end_tag_open(const char* begin, const char* end) {
+		const char* p = begin;
+#ifdef __SSE2__
+		const __m128i lt = _mm_set1_epi8('<');
+		const __m128i slash = _mm_set1_epi8('/');
+		for (; p + 17 <= end; p += 16) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 1));
+			unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, lt), _mm_cmpeq_epi8(b, slash)));
+			if (mask)
+				return p + count_trailing_zeros(mask);
+		}
+#endif
+		for (; p + 1 < end; ++p) {
+			p = find_char(p, end - 1, '<');
+			if (p >= end - 1)
+				break;
+			if (p[1] == '/')
+				return p;
+		}
+		return end;
+	}
+
+	/**
+	 * @brief the end tag </name> of a raw text element in [begin, end), the name
+	 * is compared case-insensitively and has to be followed by a space, '/' or '>'
+	 *
+	 * @return the position of the '<' of the end tag, end if there is none
+	 */
+	inline const char* find_end_tag(const char* begin, const char* end, const char* name, size_t len) {
+		const char* p = begin;
+		while ((p = find_end_tag_open(p, end)) < end) {
+			const char* q = p + 2;
+			if ((size_t)(end - q) >= len && ascii_iequals(q, name, len)) {
+				q += len;
+				if (q == end || *q == '>' || *q == '/' || *q == ' ' || *q == '\t' || *q == '\n' || *q == '\r' || *q == '\f')
+					return p;
+			}
+			p += 2;
+		}
+		return end;
+	}
+}
+
+#endif /* STPL_UTILS_SIMD_H_ */
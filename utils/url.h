@@ -0,0 +1,234 @@
+/******************************************************************************
+ * This file is part of the Simple Text Processing Library(STPL).
+ * (c) Copyright 2021 TYONLINE TECHNOLOGY PTY. LTD.
+ *
+ * This file may be distributed and/or modified under the terms of the
+ * GNU LESSER GENERAL PUBLIC LICENSE, Version 3 as published by the Free Software
+ * Foundation and appearing in the file LICENSE.LGPL included in the
+ * packaging of this file.
+ *
+ * This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+ * WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *
+ *******************************************************************************
+ *
+ * @author				Ling-Xiang(Eric) Tang
+ *
+ *******************************************************************************/
+
+#ifndef STPL_UTILS_URL_H_
+#define STPL_UTILS_URL_H_
+
+#include <string>
+
+#include <ctype.h>
+
+namespace utils {
+
+	/**
+	 * @brief the components of a URI reference (RFC 3986), and the resolution
+	 * of a reference against a base URI
+	 */
+	class Url {
+		public:
+			std::string		scheme;
+			std::string		authority;
+			std::string		path;
+			std::string		query;
+			std::string		fragment;
+			bool			has_authority;
+			bool			has_query;
+			bool			has_fragment;
+
+		public:
+			Url() { clear(); }
+			Url(const std::string& url) { parse(url); }
+			~Url() {}
+
+			void clear() {
+				scheme.clear();
+				authority.clear();
+				path.clear();
+				query.clear();
+				fragment.clear();
+				has_authority = has_query = has_fragment = false;
+			}
+
+			bool is_absolute() const { return !scheme.empty(); }
+
+			/**
+			 * @brief split a URI reference into its components, the scheme is
+			 * lower cased
+			 */
+			void parse(const std::string& url) {
+				parse(url.data(), url.data() + url.length());
+			}
+
+			void parse(const char* p, const char* end) {
+				clear();
+
+				const char* q = p;
+				if (q < end && isalpha((unsigned char) *q)) {
+					while (q < end && (isalnum((unsigned char) *q) || *q == '+' || *q == '-' || *q == '.'))
+						++q;
+					if (q < end && *q == ':') {
+						for (; p < q; ++p)
+							scheme.push_back(tolower((unsigned char) *p));
+						++p;
+					}
+				}
+
+				if (end - p >= 2 && p[0] == '/' && p[1] == '/') {
+					has_authority = true;
+					p += 2;
+					q = p;
+					while (q < end && *q != '/' && *q != '?' && *q != '#')
+						++q;
+					authority.assign(p, q);
+					p = q;
+				}
+
+				q = p;
+				while (q < end && *q != '?' && *q != '#')
+					++q;
+				path.assign(p, q);
+				p = q;
+
+				if (p < end && *p == '?') {
+					has_query = true;
+					q = ++p;
+					while (q < end && *q != '#')
+						++q;
+					query.assign(p, q);
+					p = q;
+				}
+
+				if (p < end && *p == '#') {
+					has_fragment = true;
+					fragment.assign(p + 1, end);
+				}
+			}
+
+			std::string to_string(bool with_fragment = true) const {
+				std::string url;
+				url.reserve(scheme.length() + authority.length() + path.length() + query.length() + fragment.length() + 8);
+				if (!scheme.empty()) {
+					url.append(scheme);
+					url.push_back(':');
+				}
+				if (has_authority) {
+					url.append("//");
+					url.append(authority);
+				}
+				url.append(path);
+				if (has_query) {
+					url.push_back('?');
+					url.append(query);
+				}
+				if (has_fragment && with_fragment) {
+					url.push_back('#');
+					url.append(fragment);
+				}
+				return url;
+			}
+
+			/**
+			 * @brief the target of the reference ref against this (base) URL,
+			 * RFC 3986 section 5.2
+			 */
+			Url resolve(const Url& ref) const {
+				Url target;
+				if (!ref.scheme.empty()) {
+					target = ref;
+					target.path = remove_dot_segments(ref.path);
+					return target;
+				}
+
+				target.scheme = scheme;
+				if (ref.has_authority) {
+					target.has_authority = true;
+					target.authority = ref.authority;
+					target.path = remove_dot_segments(ref.path);
+					target.has_query = ref.has_query;
+					target.query = ref.query;
+				}
+				else {
+					target.has_authority = has_authority;
+					target.authority = authority;
+					if (ref.path.empty()) {
+						target.path = path;
+						target.has_query = ref.has_query || has_query;
+						target.query = ref.has_query ? ref.query : query;
+					}
+					else {
+						if (ref.path[0] == '/')
+							target.path = remove_dot_segments(ref.path);
+						else
+							target.path = remove_dot_segments(merge(ref.path));
+						target.has_query = ref.has_query;
+						target.query = ref.query;
+					}
+				}
+				target.has_fragment = ref.has_fragment;
+				target.fragment = ref.fragment;
+				return target;
+			}
+
+			std::string resolve(const std::string& ref, bool with_fragment = true) const {
+				return resolve(Url(ref)).to_string(with_fragment);
+			}
+
+			static std::string remove_dot_segments(const std::string& path) {
+				if (path.find('.') == std::string::npos)
+					return path;
+
+				std::string output;
+				output.reserve(path.length());
+				size_t i = 0, n = path.length();
+				while (i < n) {
+					if (path.compare(i, 3, "../") == 0)
+						i += 3;
+					else if (path.compare(i, 2, "./") == 0)
+						i += 2;
+					else if (path.compare(i, 3, "/./") == 0)
+						i += 2;
+					else if (i + 2 == n && path.compare(i, 2, "/.") == 0) {
+						output.push_back('/');
+						break;
+					}
+					else if (path.compare(i, 4, "/../") == 0 || (i + 3 == n && path.compare(i, 3, "/..") == 0)) {
+						size_t last = output.rfind('/');
+						output.erase(last == std::string::npos ? 0 : last);
+						if (i + 3 == n) {
+							output.push_back('/');
+							break;
+						}
+						i += 3;
+					}
+					else if ((i + 1 == n && path[i] == '.') || (i + 2 == n && path.compare(i, 2, "..") == 0))
+						break;
+					else {
+						size_t next = path.find('/', i + 1);
+						if (next == std::string::npos)
+							next = n;
+						output.append(path, i, next - i);
+						i = next;
+					}
+				}
+				return output;
+			}
+
+		private:
+			std::string merge(const std::string& ref_path) const {
+				if (has_authority && path.empty())
+					return "/" + ref_path;
+				size_t last = path.rfind('/');
+				if (last == std::string::npos)
+					return ref_path;
+				return path.substr(0, last + 1) + ref_path;
+			}
+	};
+}
+
+#endif /* STPL_UTILS_URL_H_ */
@@ -25,21 +25,133 @@
 
 namespace utils {
 
-    inline void unescape_xml(std::string& source)
+    /**
+     * @brief the UTF-8 encoding of a code point, at most 4 bytes
+     */
+    inline std::size_t encode_utf8(unsigned int cp, char* out)
     {
-        static const char *entities[] = {"&quot;", "&lt;", "&gt;", "&apos;", "&amp;" };
-        static const char *to_chars[] = {"\"", "<", ">", "'", "&" };
+        if (cp < 0x80) {
+            out[0] = (char) cp;
+            return 1;
+        }
+        if (cp < 0x800) {
+            out[0] = (char) (0xC0 | (cp >> 6));
+            out[1] = (char) (0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            out[0] = (char) (0xE0 | (cp >> 12));
+            out[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+            out[2] = (char) (0x80 | (cp & 0x3F));
+            return 3;
+        }
+        out[0] = (char) (0xF0 | (cp >> 18));
+        out[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char) (0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+    /**
+     * @brief the predefined entity or, if numeric is set, the character
+     * reference starting with the '&' at p; the replacement goes to out,
+     * which has room for 4 bytes
+     *
+     * @return the length of the reference, 0 if there is no valid one at p
+     */
+    inline std::size_t match_xml_reference(const char* p, const char* end, char* out, std::size_t& out_len, bool numeric = true)
+    {
+        static const char *entities[] = {"quot;", "lt;", "gt;", "apos;", "amp;" };
+        static const char to_chars[] = {'"', '<', '>', '\'', '&' };
         static const std::size_t num = sizeof(entities)/sizeof(entities[0]);
 
-        std::size_t pos = 0;
-        for (std::size_t i = 0; i < num; ++i) 
-            {
-            for (;(pos = source.find(entities[i]), pos) != std::string::npos;)
-                {
-                source.replace(pos, strlen(entities[i]), to_chars[i]);
-                }
-            pos = 0;
+        const char* q = p + 1;
+        if (q < end && *q == '#') {
+            if (!numeric)
+                return 0;
+            bool hex = ++q < end && *q == 'x';
+            if (hex)
+                ++q;
+            const char* digits = q;
+            unsigned long cp = 0;
+            for (; q < end && *q != ';'; ++q) {
+                int d;
+                if (*q >= '0' && *q <= '9')
+                    d = *q - '0';
+                else if (hex && *q >= 'a' && *q <= 'f')
+                    d = *q - 'a' + 10;
+                else if (hex && *q >= 'A' && *q <= 'F')
+                    d = *q - 'A' + 10;
+                else
+                    return 0;
+                cp = cp * (hex ? 16 : 10) + d;
+                if (cp > 0x10FFFF)
+                    return 0;
+            }
+            // a character reference needs its ';' and has to be a valid character
+            if (q == digits || q == end || cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF))
+                return 0;
+            out_len = encode_utf8((unsigned int) cp, out);
+            return q + 1 - p;
+        }
+
+        for (std::size_t i = 0; i < num; ++i) {
+            std::size_t len = strlen(entities[i]);
+            if ((std::size_t) (end - q) >= len && memcmp(q, entities[i], len) == 0) {
+                out[0] = to_chars[i];
+                out_len = 1;
+                return len + 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief whether [begin, end) has anything to decode
+     */
+    inline bool needs_xml_decoding(const char* begin, const char* end)
+    {
+        return begin < end && memchr(begin, '&', end - begin) != NULL;
+    }
+
+    /**
+     * @brief append [begin, end) to out with the predefined entities and
+     * (if numeric is set) the character references decoded in one pass,
+     * anything that is not a valid reference is copied as it is
+     */
+    inline void decode_xml(const char* begin, const char* end, std::string& out, bool numeric = true)
+    {
+        char buf[4];
+        std::size_t buf_len;
+        const char* p = begin;
+        while (p < end) {
+            const char* amp = static_cast<const char*>(memchr(p, '&', end - p));
+            if (!amp) {
+                out.append(p, end - p);
+                break;
+            }
+            out.append(p, amp - p);
+            std::size_t len = match_xml_reference(amp, end, buf, buf_len, numeric);
+            if (len > 0) {
+                out.append(buf, buf_len);
+                p = amp + len;
+            }
+            else {
+                out.push_back('&');
+                p = amp + 1;
             }
+        }
+    }
+
+    inline void unescape_xml(std::string& source)
+    {
+        if (!needs_xml_decoding(source.data(), source.data() + source.length()))
+            return;
+
+        std::string decoded;
+        decoded.reserve(source.length());
+        decode_xml(source.data(), source.data() + source.length(), decoded, false);
+        source.swap(decoded);
     }
 
 }